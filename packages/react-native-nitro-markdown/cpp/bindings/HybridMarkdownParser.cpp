@@ -1,112 +1,350 @@
 #include "HybridMarkdownParser.hpp"
-#include <sstream>
-#include <iomanip>
+#include "../core/MarkdownJsonSerializer.hpp"
+#include "../core/Utf16.hpp"
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
 
 namespace margelo::nitro::Markdown {
 
 std::string HybridMarkdownParser::parse(const std::string& text) {
+    auto guard = lock();
     InternalParserOptions opts;
     opts.gfm = true;
     opts.math = true;
-    
-    auto ast = parser_->parse(text, opts);
-    return nodeToJson(ast);
+    return parseCached(text, opts, true);
 }
 
-std::string HybridMarkdownParser::parseWithOptions(const std::string& text, const ParserOptions& options) {
+namespace {
+
+using OffsetUnit = ::NitroMarkdown::ParseResultCache::OffsetUnit;
+
+InternalParserOptions toInternalOptions(const ParserOptions& options) {
     InternalParserOptions internalOpts;
     internalOpts.gfm = options.gfm.value_or(true);
     internalOpts.math = options.math.value_or(true);
-    
-    auto ast = parser_->parse(text, internalOpts);
-    return nodeToJson(ast);
-}
-
-static std::string escapeJson(const std::string& s) {
-    std::ostringstream o;
-    for (char c : s) {
-        switch (c) {
-            case '"': o << "\\\""; break;
-            case '\\': o << "\\\\"; break;
-            case '\b': o << "\\b"; break;
-            case '\f': o << "\\f"; break;
-            case '\n': o << "\\n"; break;
-            case '\r': o << "\\r"; break;
-            case '\t': o << "\\t"; break;
-            default:
-                if ('\x00' <= c && c <= '\x1f') {
-                    o << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)(unsigned char)c;
-                } else {
-                    o << c;
-                }
+    internalOpts.maxOperations = static_cast<size_t>(std::max(0.0, options.maxOperations.value_or(0)));
+    internalOpts.maxParseTimeMs = std::max(0.0, options.maxParseTimeMs.value_or(0));
+    internalOpts.deferInlines = options.deferInlines.value_or(false);
+    internalOpts.collectStats = options.collectStats.value_or(false);
+    return internalOpts;
+}
+
+// Deferred blocks' source ranges and the plain-text fallback are reported as
+// indices into the JS string, i.e. in UTF-16 code units. The parser reports
+// byte offsets, which differ from those only beyond ASCII.
+bool needsUtf16Offsets(std::string_view text, const InternalParserOptions& options) {
+    bool reportsOffsets = options.deferInlines || options.maxOperations > 0 || options.maxParseTimeMs > 0;
+    return reportsOffsets && std::any_of(text.begin(), text.end(), [](char c) { return (c & 0x80) != 0; });
+}
+
+// A larger input would be cut to its size modulo 2^32 and overflow source
+// offsets, so it is refused rather than parsed into a wrong tree.
+void checkInputSize(const char* method, size_t size) {
+    if (size > ::NitroMarkdown::MD4CParser::kMaxInputSize) {
+        throw std::invalid_argument(std::string(method) + " input of " + std::to_string(size) +
+                                    " bytes is larger than the 2 GiB the parser supports");
+    }
+}
+
+void toUtf16Offsets(InternalMarkdownNode& node, ::NitroMarkdown::Utf16::OffsetMap& offsets) {
+    if (node.sourceStart) node.sourceStart = static_cast<int>(offsets(static_cast<size_t>(*node.sourceStart)));
+    if (node.sourceEnd) node.sourceEnd = static_cast<int>(offsets(static_cast<size_t>(*node.sourceEnd)));
+    for (const auto& child : node.children) toUtf16Offsets(*child, offsets);
+}
+
+} // namespace
+
+std::string HybridMarkdownParser::parseWithOptions(const std::string& text, const ParserOptions& options) {
+    auto guard = lock();
+    return parseCached(text, toInternalOptions(options), true);
+}
+
+std::string HybridMarkdownParser::parseBuffer(const std::shared_ptr<ArrayBuffer>& buffer, const ParserOptions& options) {
+    auto guard = lock();
+    checkInputSize("parseBuffer", buffer->size());
+    std::string_view text(reinterpret_cast<const char*>(buffer->data()), buffer->size());
+    // A buffer owned by JS is only valid during the call, so the parser
+    // copies what it keeps of it; a native one is kept alive instead.
+    std::shared_ptr<const void> owner;
+    if (buffer->isOwner()) owner = buffer;
+    return parseCached(text, toInternalOptions(options), false, std::move(owner));
+}
+
+std::string HybridMarkdownParser::parseFile(const std::string& path, const ParserOptions& options) {
+    auto guard = lock();
+    if (path.empty()) {
+        throw std::invalid_argument("parseFile needs a file path");
+    }
+    auto file = ::NitroMarkdown::MappedFile::open(path);
+    if (!file) {
+        throw std::runtime_error("parseFile cannot read " + path);
+    }
+    checkInputSize("parseFile", file->size());
+    return parseCached(file->text(), toInternalOptions(options), false, file);
+}
+
+std::string HybridMarkdownParser::parseInlines(double blockId) {
+    auto guard = lock();
+    auto node = parser_->parseInlines(static_cast<int>(blockId));
+    if (!node) {
+        throw std::invalid_argument("Unknown blockId " + std::to_string(blockId) +
+                                    " (only blocks deferred by the last parse can be materialized)");
+    }
+    std::string json = finishParse(node);
+    // The fallback starts with the block, at the offset the parse reported
+    // for it, in UTF-16 code units for a JS string.
+    if (lastStats_.budgetExceeded && node->sourceStart) {
+        lastStats_.plainTextOffset = static_cast<size_t>(*node->sourceStart);
+    }
+    return json;
+}
+
+std::string HybridMarkdownParser::renderHtml(const std::string& text, const HtmlRenderOptions& options) {
+    InternalHtmlRenderOptions internalOpts;
+    internalOpts.gfm = options.gfm.value_or(true);
+    internalOpts.math = options.math.value_or(true);
+    internalOpts.headingAnchors = options.headingAnchors.value_or(false);
+    internalOpts.mathDelimiters = options.mathDelimiters.value_or(false);
+    auto html = ::NitroMarkdown::MarkdownHtmlRenderer::render(text, internalOpts);
+    if (!html) {
+        throw std::runtime_error("renderHtml failed to parse the markdown");
+    }
+    return std::move(*html);
+}
+
+BatchParseResult HybridMarkdownParser::parseBatch(const std::vector<std::string>& texts, const ParserOptions& options) {
+    auto guard = lock();
+    InternalParserOptions internalOpts = toInternalOptions(options);
+    if (internalOpts.deferInlines) {
+        throw std::invalid_argument("parseBatch does not support deferInlines; parseInlines() only knows the blocks "
+                                    "of a single parse");
+    }
+    bool cacheable = cache_.enabled() && ::NitroMarkdown::ParseResultCache::cacheable(internalOpts);
+    bool persistable = diskCache_.isOpen() && ::NitroMarkdown::ParseResultCache::cacheable(internalOpts);
+
+    std::vector<std::string> results(texts.size());
+    std::vector<::NitroMarkdown::ParseResultCache::Key> keys(texts.size());
+    std::vector<size_t> missed;
+    std::vector<::NitroMarkdown::BatchParser::Document> documents;
+    for (size_t i = 0; i < texts.size(); i++) {
+        if (cacheable || persistable) {
+            // Batch documents are parsed as UTF-8, so their offsets count bytes.
+            keys[i] = ::NitroMarkdown::ParseResultCache::makeKey(texts[i], internalOpts, OffsetUnit::Bytes);
+            if (auto json = findCached(keys[i], cacheable, persistable)) {
+                results[i] = std::move(*json);
+                continue;
+            }
         }
+        missed.push_back(i);
+        documents.push_back({texts[i]});
+    }
+
+    batchParser_.parse(documents, internalOpts, persistable);
+
+    // Stats of the batch as a whole; cached documents count as free.
+    InternalParseStats total;
+    for (size_t j = 0; j < documents.size(); j++) {
+        auto& document = documents[j];
+        size_t i = missed[j];
+        total.operations += document.stats.operations;
+        total.parseTimeMs += document.stats.parseTimeMs;
+        total.budgetExceeded = total.budgetExceeded || document.stats.budgetExceeded;
+        bool timedOut = document.stats.budgetExceeded && internalOpts.maxParseTimeMs > 0;
+        if (cacheable && !timedOut) cache_.insert(keys[i], document.json, document.stats);
+        if (persistable && !timedOut) diskCache_.add(keys[i], std::move(document.record), document.stats);
+        results[i] = std::move(document.json);
     }
-    return o.str();
+
+    std::vector<size_t> documentOffsets;
+    std::string json = ::NitroMarkdown::BatchParser::joinJson(results, documentOffsets);
+    std::vector<double> offsets(documentOffsets.begin(), documentOffsets.end());
+
+    if (internalOpts.collectStats) total.outputBytes = json.size();
+    lastStats_ = total;
+    return BatchParseResult(std::move(json), std::move(offsets));
 }
 
-std::string HybridMarkdownParser::nodeToJson(const std::shared_ptr<InternalMarkdownNode>& node) {
-    std::ostringstream json;
-    json << "{";
-    json << "\"type\":\"" << ::NitroMarkdown::nodeTypeToString(node->type) << "\"";
+ParseStats HybridMarkdownParser::getLastParseStats() {
+    auto guard = lock();
+    const auto& s = lastStats_;
+    return ParseStats(static_cast<double>(s.operations), s.parseTimeMs, s.budgetExceeded,
+                      static_cast<double>(s.plainTextOffset), s.blockAnalysisMs, s.inlineAnalysisMs,
+                      s.astBuildMs, s.serializationMs, static_cast<double>(s.nodeCount),
+                      static_cast<double>(s.maxDepth), static_cast<double>(s.outputBytes),
+                      static_cast<double>(s.estimatedAllocations));
+}
+
+MemoryFootprint HybridMarkdownParser::getMemoryFootprint() {
+    auto guard = lock();
+    auto f = parser_->memoryFootprint();
+    f.cacheBytes += cache_.memoryBytes() + diskCache_.memoryBytes();
+    return MemoryFootprint(static_cast<double>(f.inputBytes), static_cast<double>(f.nodeBytes),
+                           static_cast<double>(f.stringBytes), static_cast<double>(f.scratchBytes),
+                           static_cast<double>(f.cacheBytes), static_cast<double>(f.total()));
+}
+
+size_t HybridMarkdownParser::getExternalMemorySize() noexcept {
+    auto guard = lock();
+    return parser_->memoryFootprint().total() + cache_.memoryBytes() + diskCache_.memoryBytes();
+}
 
-    if (node->content.has_value()) {
-        json << ",\"content\":\"" << escapeJson(node->content.value()) << "\"";
+void HybridMarkdownParser::setCacheCapacity(double bytes) {
+    auto guard = lock();
+    size_t capacity = static_cast<size_t>(std::max(0.0, bytes));
+    cache_.setCapacity(capacity);
+    parser_->blockMemo().setCapacity(capacity);
+}
+
+ParseCacheStats HybridMarkdownParser::getCacheStats() {
+    auto guard = lock();
+    auto s = cache_.stats();
+    auto blocks = parser_->blockMemo().stats();
+    auto disk = diskCache_.stats();
+    return ParseCacheStats(static_cast<double>(s.hits), static_cast<double>(s.misses),
+                           static_cast<double>(s.evictions), static_cast<double>(s.entries),
+                           static_cast<double>(s.bytes), static_cast<double>(s.capacityBytes),
+                           static_cast<double>(blocks.hits), static_cast<double>(blocks.misses),
+                           static_cast<double>(blocks.bytes), static_cast<double>(disk.hits),
+                           static_cast<double>(disk.misses), static_cast<double>(disk.entries),
+                           static_cast<double>(disk.mappedBytes));
+}
+
+void HybridMarkdownParser::clearCache() {
+    auto guard = lock();
+    cache_.clear();
+    parser_->blockMemo().clear();
+}
+
+bool HybridMarkdownParser::openAstCache(const std::string& path, double maxBytes) {
+    auto guard = lock();
+    if (path.empty()) {
+        throw std::invalid_argument("openAstCache needs a file path");
     }
-    
-    if (node->level.has_value()) {
-        json << ",\"level\":" << node->level.value();
+    return diskCache_.open(path, static_cast<size_t>(std::max(0.0, maxBytes)));
+}
+
+bool HybridMarkdownParser::saveAstCache() {
+    auto guard = lock();
+    return diskCache_.save();
+}
+
+void HybridMarkdownParser::closeAstCache() {
+    auto guard = lock();
+    diskCache_.close();
+}
+
+void HybridMarkdownParser::trimMemory(bool critical) {
+    using Level = ::NitroMarkdown::MemoryPressure::Level;
+    ::NitroMarkdown::MemoryPressure::notify(critical ? Level::Critical : Level::Moderate);
+}
+
+std::unique_lock<std::mutex> HybridMarkdownParser::lock() {
+    std::unique_lock<std::mutex> guard(mutex_);
+    if (pendingTrim_.exchange(false)) trim(pendingCritical_.exchange(false));
+    return guard;
+}
+
+void HybridMarkdownParser::onMemoryPressure(::NitroMarkdown::MemoryPressure::Level level) {
+    bool critical = level == ::NitroMarkdown::MemoryPressure::Level::Critical;
+    std::unique_lock<std::mutex> guard(mutex_, std::try_to_lock);
+    if (guard) {
+        trim(critical || pendingCritical_.exchange(false));
+        pendingTrim_ = false;
+        return;
     }
-    
-    if (node->href.has_value()) {
-        json << ",\"href\":\"" << escapeJson(node->href.value()) << "\"";
+    // Set before the flag that lock() checks first.
+    if (critical) pendingCritical_ = true;
+    pendingTrim_ = true;
+}
+
+void HybridMarkdownParser::trim(bool critical) {
+    parser_->trim();
+    if (critical) {
+        // The tree stays for parseInlines(); cached results are parsed again.
+        cache_.clear();
+        parser_->blockMemo().clear();
     }
-    
-    if (node->title.has_value()) {
-        json << ",\"title\":\"" << escapeJson(node->title.value()) << "\"";
+}
+
+std::string HybridMarkdownParser::parseCached(std::string_view text, const InternalParserOptions& options, bool jsString,
+                                              std::shared_ptr<const void> owner) {
+    bool cacheable = cache_.enabled() && ::NitroMarkdown::ParseResultCache::cacheable(options);
+    bool persistable = diskCache_.isOpen() && ::NitroMarkdown::ParseResultCache::cacheable(options);
+    ::NitroMarkdown::ParseResultCache::Key key;
+    if (cacheable || persistable) {
+        key = ::NitroMarkdown::ParseResultCache::makeKey(text, options, jsString ? OffsetUnit::Utf16 : OffsetUnit::Bytes);
     }
-    
-    if (node->alt.has_value()) {
-        json << ",\"alt\":\"" << escapeJson(node->alt.value()) << "\"";
+    if (auto json = findCached(key, cacheable, persistable)) {
+        return std::move(*json);
     }
-    
-    if (node->language.has_value()) {
-        json << ",\"language\":\"" << escapeJson(node->language.value()) << "\"";
+
+    std::shared_ptr<InternalMarkdownNode> ast;
+    if (owner) {
+        ast = parser_->parse(text, options, std::move(owner));
+    } else {
+        ast = parser_->parse(text, options, ::NitroMarkdown::ExternalReferences{});
     }
-    
-    if (node->ordered.has_value()) {
-        json << ",\"ordered\":" << (node->ordered.value() ? "true" : "false");
+    bool utf16Offsets = jsString && needsUtf16Offsets(text, options);
+    // Deferred trees are never memoized, so their nodes are this parse's own.
+    if (utf16Offsets && options.deferInlines) {
+        ::NitroMarkdown::Utf16::OffsetMap offsets(text);
+        toUtf16Offsets(*ast, offsets);
     }
-    
-    if (node->start.has_value()) {
-        json << ",\"start\":" << node->start.value();
+    collectStats_ = options.collectStats;
+    std::string json = finishParse(ast);
+    if (utf16Offsets && lastStats_.budgetExceeded) {
+        lastStats_.plainTextOffset = ::NitroMarkdown::Utf16::length(text.substr(0, lastStats_.plainTextOffset));
     }
-    
-    if (node->checked.has_value()) {
-        json << ",\"checked\":" << (node->checked.value() ? "true" : "false");
+    // A time budget cuts the parse at a point that depends on the machine's
+    // load, so only deterministic results are kept.
+    bool timedOut = lastStats_.budgetExceeded && options.maxParseTimeMs > 0;
+    if (cacheable && !timedOut) {
+        cache_.insert(key, json, lastStats_);
     }
-    
-    if (node->isHeader.has_value()) {
-        json << ",\"isHeader\":" << (node->isHeader.value() ? "true" : "false");
+    if (persistable && !timedOut && ast) {
+        diskCache_.add(key, ::NitroMarkdown::AstCacheFile::encode(*ast), lastStats_);
     }
-    
-    if (node->align.has_value()) {
-        std::string alignStr = ::NitroMarkdown::textAlignToString(node->align.value());
-        if (!alignStr.empty()) {
-            json << ",\"align\":\"" << alignStr << "\"";
+    return json;
+}
+
+std::optional<std::string> HybridMarkdownParser::findCached(const ::NitroMarkdown::ParseResultCache::Key& key,
+                                                            bool cacheable, bool persistable) {
+    if (cacheable) {
+        if (const auto* entry = cache_.find(key)) {
+            lastStats_ = entry->stats;
+            return entry->json;
         }
     }
-
-    if (!node->children.empty()) {
-        json << ",\"children\":[";
-        for (size_t i = 0; i < node->children.size(); ++i) {
-            if (i > 0) json << ",";
-            json << nodeToJson(node->children[i]);
+    if (persistable) {
+        if (auto hit = diskCache_.find(key)) {
+            std::string json;
+            if (::NitroMarkdown::AstCacheFile::appendJson(json, hit->record)) {
+                lastStats_ = hit->stats;
+                if (cacheable) cache_.insert(key, json, lastStats_);
+                return json;
+            }
         }
-        json << "]";
+    }
+    return std::nullopt;
+}
+
+std::string HybridMarkdownParser::finishParse(const std::shared_ptr<InternalMarkdownNode>& node) {
+    lastStats_ = parser_->lastStats();
+    if (!collectStats_) {
+        return nodeToJson(node);
     }
     
-    json << "}";
-    return json.str();
+    auto start = std::chrono::steady_clock::now();
+    std::string json = nodeToJson(node);
+    lastStats_.serializationMs = std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - start).count();
+    lastStats_.outputBytes = json.size();
+    return json;
+}
+
+std::string HybridMarkdownParser::nodeToJson(const std::shared_ptr<InternalMarkdownNode>& node) {
+    return ::NitroMarkdown::MarkdownJsonSerializer::toJson(node, &parser_->blockMemo());
 }
 
 } // namespace margelo::nitro::Markdown
@@ -1,28 +1,93 @@
 #pragma once
 
 #include "HybridMarkdownParserSpec.hpp"
+#include "../core/AstCacheFile.hpp"
+#include "../core/BatchParser.hpp"
 #include "../core/MD4CParser.hpp"
+#include "../core/MappedFile.hpp"
+#include "../core/MarkdownHtmlRenderer.hpp"
+#include "../core/MemoryPressure.hpp"
+#include "../core/ParseResultCache.hpp"
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
 
 namespace margelo::nitro::Markdown {
 
 using InternalMarkdownNode = ::NitroMarkdown::MarkdownNode;
 using InternalParserOptions = ::NitroMarkdown::ParserOptions;
+using InternalParseStats = ::NitroMarkdown::ParseStats;
+using InternalHtmlRenderOptions = ::NitroMarkdown::HtmlRenderOptions;
 
 class HybridMarkdownParser : public HybridMarkdownParserSpec {
 public:
     HybridMarkdownParser() : HybridObject(TAG), HybridMarkdownParserSpec() {
         parser_ = std::make_unique<::NitroMarkdown::MD4CParser>();
+        parser_->blockMemo().setCapacity(::NitroMarkdown::BlockMemo::kDefaultCapacityBytes);
+        pressure_ = ::NitroMarkdown::MemoryPressure::subscribe(
+            [this](::NitroMarkdown::MemoryPressure::Level level) { onMemoryPressure(level); });
     }
     
     ~HybridMarkdownParser() override = default;
 
     std::string parse(const std::string& text) override;
     std::string parseWithOptions(const std::string& text, const ParserOptions& options) override;
+    std::string parseBuffer(const std::shared_ptr<ArrayBuffer>& buffer, const ParserOptions& options) override;
+    std::string parseFile(const std::string& path, const ParserOptions& options) override;
+    std::string parseInlines(double blockId) override;
+    std::string renderHtml(const std::string& text, const HtmlRenderOptions& options) override;
+    BatchParseResult parseBatch(const std::vector<std::string>& texts, const ParserOptions& options) override;
+    ParseStats getLastParseStats() override;
+    MemoryFootprint getMemoryFootprint() override;
+    void setCacheCapacity(double bytes) override;
+    ParseCacheStats getCacheStats() override;
+    void clearCache() override;
+    bool openAstCache(const std::string& path, double maxBytes) override;
+    bool saveAstCache() override;
+    void closeAstCache() override;
+    void trimMemory(bool critical) override;
+
+    // Lets the JS GC account for the retained tree and parser buffers.
+    size_t getExternalMemorySize() noexcept override;
 
 private:
+    // Held by every call that touches the state below, which memory-pressure
+    // handlers on other threads trim too.
+    std::mutex mutex_;
     std::unique_ptr<::NitroMarkdown::MD4CParser> parser_;
+    InternalParseStats lastStats_;
+    bool collectStats_ = false;
+    // Finished messages are parsed again on every remount; this returns
+    // their JSON without parsing.
+    ::NitroMarkdown::ParseResultCache cache_;
+    // Results persisted across app launches; consulted after cache_.
+    ::NitroMarkdown::AstCacheFile diskCache_;
+    ::NitroMarkdown::BatchParser batchParser_;
+    // owner, if set, keeps text alive for parseInlines(); otherwise the
+    // parser copies what it keeps. Offsets into a JS string count UTF-16
+    // code units, those into bytes count bytes.
+    std::string parseCached(std::string_view text, const InternalParserOptions& options, bool jsString,
+                            std::shared_ptr<const void> owner = nullptr);
+    // JSON of text from cache_ or diskCache_, or nullopt on a miss.
+    std::optional<std::string> findCached(const ::NitroMarkdown::ParseResultCache::Key& key, bool cacheable,
+                                          bool persistable);
     std::string nodeToJson(const std::shared_ptr<InternalMarkdownNode>& node);
+    std::string finishParse(const std::shared_ptr<InternalMarkdownNode>& node);
+    // Locks mutex_, first applying pressure that arrived while it was held.
+    std::unique_lock<std::mutex> lock();
+    // Notifications come on whatever thread calls MemoryPressure::notify(),
+    // e.g. trimMemory() on another runtime's JS thread. They trim right away
+    // unless a call holds mutex_, and otherwise leave it to the next call.
+    void onMemoryPressure(::NitroMarkdown::MemoryPressure::Level level);
+    // Requires mutex_.
+    void trim(bool critical);
+    std::atomic<bool> pendingTrim_{false};
+    std::atomic<bool> pendingCritical_{false};
+    // Last, so that no notification reaches a parser being destroyed.
+    ::NitroMarkdown::MemoryPressure::Subscription pressure_;
 };
 
 } // namespace margelo::nitro::Markdown
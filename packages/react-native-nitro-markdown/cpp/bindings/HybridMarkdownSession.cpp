@@ -0,0 +1,156 @@
+#include "HybridMarkdownSession.hpp"
+#include "HybridMarkdownSessionSnapshot.hpp"
+#include "../core/MarkdownJsonSerializer.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace margelo::nitro::Markdown {
+
+namespace {
+
+constexpr auto kDamagedText = "Damaged cold session text";
+
+size_t toIndex(double value) {
+    return static_cast<size_t>(std::max(0.0, value));
+}
+
+::NitroMarkdown::ParserOptions sessionOptions() {
+    ::NitroMarkdown::ParserOptions options;
+    options.gfm = true;
+    options.math = true;
+    return options;
+}
+
+} // namespace
+
+HybridMarkdownSession::HybridMarkdownSession()
+    : HybridObject(TAG), HybridMarkdownSessionSpec(), host_(::NitroMarkdown::SessionHost::shared()),
+      id_(host_.open(sessionOptions())) {}
+
+HybridMarkdownSession::HybridMarkdownSession(::NitroMarkdown::SessionHost& host,
+                                             ::NitroMarkdown::SessionHost::SessionId id)
+    : HybridObject(TAG), HybridMarkdownSessionSpec(), host_(host), id_(id) {}
+
+HybridMarkdownSession::~HybridMarkdownSession() {
+    host_.close(id_);
+}
+
+double HybridMarkdownSession::getHighlightPosition() {
+    return highlightPosition_.load();
+}
+
+void HybridMarkdownSession::setHighlightPosition(double highlightPosition) {
+    highlightPosition_.store(highlightPosition);
+}
+
+void HybridMarkdownSession::append(const std::string& chunk) {
+    // Listeners hear of it once the host has reparsed the session.
+    host_.append(id_, chunk);
+}
+
+void HybridMarkdownSession::clear() {
+    host_.clear(id_);
+    highlightPosition_.store(0);
+    notifyListeners(*listeners_);
+}
+
+std::string HybridMarkdownSession::getAllText() {
+    auto text = host_.text(id_);
+    if (!text) throw std::runtime_error(kDamagedText);
+    return std::move(*text);
+}
+
+std::string HybridMarkdownSession::getDocument() {
+    return ::NitroMarkdown::MarkdownJsonSerializer::toJson(host_.document(id_));
+}
+
+std::function<void()> HybridMarkdownSession::addListener(const std::function<void()>& listener) {
+    uint64_t id;
+    {
+        std::lock_guard<std::mutex> lock(listeners_->mutex);
+        id = listeners_->nextId++;
+        listeners_->byId.emplace(id, listener);
+    }
+    watch(host_, id_, listeners_);
+    return [&host = host_, sessionId = id_, weak = std::weak_ptr<Listeners>(listeners_), id] {
+        auto listeners = weak.lock();
+        if (!listeners) return;
+        {
+            std::lock_guard<std::mutex> lock(listeners->mutex);
+            listeners->byId.erase(id);
+        }
+        try {
+            watch(host, sessionId, listeners);
+        } catch (const std::invalid_argument&) {
+            // The session closed meanwhile.
+        }
+    };
+}
+
+std::shared_ptr<HybridMarkdownSessionSnapshotSpec> HybridMarkdownSession::snapshot() {
+    return std::make_shared<HybridMarkdownSessionSnapshot>(host_, host_.snapshot(id_));
+}
+
+std::shared_ptr<HybridMarkdownSessionSpec> HybridMarkdownSession::fork() {
+    return std::make_shared<HybridMarkdownSession>(host_, host_.open(host_.snapshot(id_)));
+}
+
+double HybridMarkdownSession::compact(std::optional<double> hotBytes) {
+    size_t hot = hotBytes ? toIndex(*hotBytes) : ::NitroMarkdown::MarkdownSessionCore::kDefaultHotBytes;
+    return static_cast<double>(host_.compact(id_, hot));
+}
+
+double HybridMarkdownSession::getColdBlockCount() {
+    return static_cast<double>(host_.coldBlockCount(id_));
+}
+
+std::string HybridMarkdownSession::getColdBlocks(double begin, double end) {
+    auto blocks = host_.coldBlocks(id_, toIndex(begin), toIndex(end));
+    if (!blocks) throw std::runtime_error(kDamagedText);
+    std::string json = "[";
+    for (size_t i = 0; i < blocks->size(); i++) {
+        if (i > 0) json += ',';
+        ::NitroMarkdown::MarkdownJsonSerializer::appendJson(json, *(*blocks)[i]);
+    }
+    json += ']';
+    return json;
+}
+
+size_t HybridMarkdownSession::getExternalMemorySize() noexcept {
+    return host_.memoryBytes(id_);
+}
+
+void HybridMarkdownSession::watch(::NitroMarkdown::SessionHost& host, ::NitroMarkdown::SessionHost::SessionId id,
+                                  const std::shared_ptr<Listeners>& listeners) {
+    std::lock_guard<std::mutex> hostLock(listeners->hostMutex);
+    bool watch;
+    {
+        std::lock_guard<std::mutex> lock(listeners->mutex);
+        watch = !listeners->byId.empty();
+    }
+    if (watch == listeners->watching) return;
+    ::NitroMarkdown::SessionHost::Listener listener;
+    if (watch) {
+        // Called on a host worker once the tree is published, so that
+        // getDocument() returns it at once.
+        listener = [weak = std::weak_ptr<Listeners>(listeners)](::NitroMarkdown::SessionHost::SessionId,
+                                                               const std::shared_ptr<::NitroMarkdown::MarkdownNode>&) {
+            if (auto listeners = weak.lock()) notifyListeners(*listeners);
+        };
+    }
+    host.setListener(id, std::move(listener));
+    listeners->watching = watch;
+}
+
+void HybridMarkdownSession::notifyListeners(Listeners& listeners) {
+    std::vector<std::function<void()>> current;
+    {
+        std::lock_guard<std::mutex> lock(listeners.mutex);
+        current.reserve(listeners.byId.size());
+        for (const auto& [id, listener] : listeners.byId) current.push_back(listener);
+    }
+    for (const auto& listener : current) listener();
+}
+
+} // namespace margelo::nitro::Markdown
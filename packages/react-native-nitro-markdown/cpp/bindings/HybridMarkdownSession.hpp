@@ -0,0 +1,68 @@
+#pragma once
+
+#include "HybridMarkdownSessionSpec.hpp"
+#include "../core/SessionHost.hpp"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace margelo::nitro::Markdown {
+
+class HybridMarkdownSession : public HybridMarkdownSessionSpec {
+public:
+    // Opens a session on SessionHost::shared(), which reparses it in the
+    // background as text is appended while it has listeners.
+    HybridMarkdownSession();
+    // Takes over id, a session already open on host.
+    HybridMarkdownSession(::NitroMarkdown::SessionHost& host, ::NitroMarkdown::SessionHost::SessionId id);
+    ~HybridMarkdownSession() override;
+
+    double getHighlightPosition() override;
+    void setHighlightPosition(double highlightPosition) override;
+
+    void append(const std::string& chunk) override;
+    void clear() override;
+    std::string getAllText() override;
+    std::string getDocument() override;
+    std::function<void()> addListener(const std::function<void()>& listener) override;
+    std::shared_ptr<HybridMarkdownSessionSnapshotSpec> snapshot() override;
+    // A new session with this one's text and tree; listeners and the
+    // highlight position are not copied.
+    std::shared_ptr<HybridMarkdownSessionSpec> fork() override;
+    double compact(std::optional<double> hotBytes) override;
+    double getColdBlockCount() override;
+    std::string getColdBlocks(double begin, double end) override;
+
+    // Lets the JS GC account for the session's text and tree in the host.
+    size_t getExternalMemorySize() noexcept override;
+
+private:
+    // Shared with the functions addListener() returns and the host's
+    // listener, which may outlive the session.
+    struct Listeners {
+        std::mutex mutex;
+        std::unordered_map<uint64_t, std::function<void()>> byId;
+        uint64_t nextId = 0;
+        // Held while the host listener is installed or removed, not by calls.
+        std::mutex hostMutex;
+        bool watching = false;
+    };
+
+    // Installs the host listener while there are listeners, removes it once
+    // there are none.
+    static void watch(::NitroMarkdown::SessionHost& host, ::NitroMarkdown::SessionHost::SessionId id,
+                      const std::shared_ptr<Listeners>& listeners);
+    static void notifyListeners(Listeners& listeners);
+
+    ::NitroMarkdown::SessionHost& host_;
+    ::NitroMarkdown::SessionHost::SessionId id_;
+    std::atomic<double> highlightPosition_{0};
+    std::shared_ptr<Listeners> listeners_ = std::make_shared<Listeners>();
+};
+
+} // namespace margelo::nitro::Markdown
@@ -0,0 +1,21 @@
+#include "HybridMarkdownSessionSnapshot.hpp"
+#include "HybridMarkdownSession.hpp"
+#include <stdexcept>
+
+namespace margelo::nitro::Markdown {
+
+double HybridMarkdownSessionSnapshot::getLength() {
+    return static_cast<double>(snapshot_.size());
+}
+
+std::string HybridMarkdownSessionSnapshot::getAllText() {
+    auto text = snapshot_.text();
+    if (!text) throw std::runtime_error("Damaged cold session text");
+    return std::move(*text);
+}
+
+std::shared_ptr<HybridMarkdownSessionSpec> HybridMarkdownSessionSnapshot::fork() {
+    return std::make_shared<HybridMarkdownSession>(host_, host_.open(snapshot_));
+}
+
+} // namespace margelo::nitro::Markdown
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "HybridMarkdownSessionSnapshotSpec.hpp"
+#include "../core/MarkdownSessionCore.hpp"
+#include "../core/SessionHost.hpp"
+#include <memory>
+#include <string>
+
+namespace margelo::nitro::Markdown {
+
+// Created by MarkdownSession.snapshot(); holds the immutable core snapshot,
+// which shares the session's text and tree instead of copying them.
+class HybridMarkdownSessionSnapshot : public HybridMarkdownSessionSnapshotSpec {
+public:
+    HybridMarkdownSessionSnapshot(::NitroMarkdown::SessionHost& host,
+                                  ::NitroMarkdown::MarkdownSessionCore::Snapshot snapshot)
+        : HybridObject(TAG), HybridMarkdownSessionSnapshotSpec(), host_(host), snapshot_(std::move(snapshot)) {}
+
+    double getLength() override;
+    std::string getAllText() override;
+    std::shared_ptr<HybridMarkdownSessionSpec> fork() override;
+
+private:
+    ::NitroMarkdown::SessionHost& host_;
+    const ::NitroMarkdown::MarkdownSessionCore::Snapshot snapshot_;
+};
+
+} // namespace margelo::nitro::Markdown
@@ -0,0 +1,194 @@
+#include "AllocationCounter.hpp"
+
+#ifdef NITRO_MARKDOWN_ALLOC_STATS
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace NitroMarkdown {
+
+size_t AllocationCounts::totalCount() const {
+    size_t total = 0;
+    for (size_t c : count) total += c;
+    return total;
+}
+
+size_t AllocationCounts::totalBytes() const {
+    size_t total = 0;
+    for (size_t b : bytes) total += b;
+    return total;
+}
+
+AllocationCounts AllocationCounts::operator-(const AllocationCounts& earlier) const {
+    AllocationCounts delta;
+    delta.liveBytes = liveBytes;
+    delta.peakBytes = peakBytes;
+    for (size_t i = 0; i < kAllocationCategoryCount; i++) {
+        delta.count[i] = count[i] - earlier.count[i];
+        delta.bytes[i] = bytes[i] - earlier.bytes[i];
+    }
+    return delta;
+}
+
+const char* AllocationCounter::categoryName(AllocationCategory category) {
+    switch (category) {
+        case AllocationCategory::Other: return "other";
+        case AllocationCategory::Md4c: return "md4c";
+        case AllocationCategory::Nodes: return "nodes";
+        case AllocationCategory::Strings: return "strings";
+        case AllocationCategory::Serializer: return "serializer";
+    }
+    return "unknown";
+}
+
+#ifdef NITRO_MARKDOWN_ALLOC_STATS
+
+namespace {
+
+// Constant-initialized, so that operator new can use them before any
+// dynamic initialization has run on the thread.
+thread_local AllocationCounts tlsCounts;
+thread_local AllocationCategory tlsCategory = AllocationCategory::Other;
+
+// Every counted block starts with a header holding its size, so that frees
+// can be subtracted from the live bytes. 16 bytes keep the alignment malloc
+// and operator new guarantee.
+constexpr size_t kHeaderSize = 16;
+
+void* allocateCounted(size_t size, AllocationCategory category) {
+    auto* base = static_cast<unsigned char*>(std::malloc(size + kHeaderSize));
+    if (!base) return nullptr;
+    *reinterpret_cast<size_t*>(base) = size;
+    AllocationCounter::record(category, size);
+    return base + kHeaderSize;
+}
+
+void* reallocateCounted(void* ptr, size_t size, AllocationCategory category) {
+    if (!ptr) return allocateCounted(size, category);
+    auto* base = static_cast<unsigned char*>(ptr) - kHeaderSize;
+    size_t previous = *reinterpret_cast<size_t*>(base);
+    auto* moved = static_cast<unsigned char*>(std::realloc(base, size + kHeaderSize));
+    if (!moved) return nullptr;
+    *reinterpret_cast<size_t*>(moved) = size;
+    tlsCounts.liveBytes -= static_cast<int64_t>(previous);
+    AllocationCounter::record(category, size);
+    return moved + kHeaderSize;
+}
+
+void releaseCounted(void* ptr) {
+    if (!ptr) return;
+    auto* base = static_cast<unsigned char*>(ptr) - kHeaderSize;
+    tlsCounts.liveBytes -= static_cast<int64_t>(*reinterpret_cast<size_t*>(base));
+    std::free(base);
+}
+
+} // namespace
+
+AllocationCounts AllocationCounter::snapshot() {
+    return tlsCounts;
+}
+
+void AllocationCounter::resetPeak() {
+    tlsCounts.peakBytes = tlsCounts.liveBytes;
+}
+
+void AllocationCounter::record(size_t bytes) {
+    record(tlsCategory, bytes);
+}
+
+void AllocationCounter::record(AllocationCategory category, size_t bytes) {
+    tlsCounts.count[static_cast<size_t>(category)]++;
+    tlsCounts.bytes[static_cast<size_t>(category)] += bytes;
+    tlsCounts.liveBytes += static_cast<int64_t>(bytes);
+    if (tlsCounts.liveBytes > tlsCounts.peakBytes) tlsCounts.peakBytes = tlsCounts.liveBytes;
+}
+
+AllocationCategory AllocationCounter::current() {
+    return tlsCategory;
+}
+
+void AllocationCounter::setCurrent(AllocationCategory category) {
+    tlsCategory = category;
+}
+
+#else
+
+AllocationCounts AllocationCounter::snapshot() {
+    return {};
+}
+
+void AllocationCounter::resetPeak() {}
+
+#endif
+
+} // namespace NitroMarkdown
+
+#ifdef NITRO_MARKDOWN_ALLOC_STATS
+
+using NitroMarkdown::AllocationCategory;
+using NitroMarkdown::AllocationCounter;
+using NitroMarkdown::allocateCounted;
+using NitroMarkdown::reallocateCounted;
+using NitroMarkdown::releaseCounted;
+
+extern "C" {
+
+void* md_hook_malloc(size_t size) {
+    return allocateCounted(size, AllocationCategory::Md4c);
+}
+
+void* md_hook_realloc(void* ptr, size_t size) {
+    return reallocateCounted(ptr, size, AllocationCategory::Md4c);
+}
+
+void md_hook_free(void* ptr) {
+    releaseCounted(ptr);
+}
+
+} // extern "C"
+
+// Replacing the global allocation functions counts every C++ allocation of
+// the process; AllocationScope decides which category it lands in. The
+// aligned variants are left alone; nothing in the parser uses them.
+void* operator new(size_t size) {
+    if (void* ptr = allocateCounted(size, AllocationCounter::current())) return ptr;
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size) {
+    return ::operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocateCounted(size, AllocationCounter::current());
+}
+
+void* operator new[](size_t size, const std::nothrow_t& tag) noexcept {
+    return ::operator new(size, tag);
+}
+
+void operator delete(void* ptr) noexcept {
+    releaseCounted(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    releaseCounted(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    releaseCounted(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    releaseCounted(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    releaseCounted(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    releaseCounted(ptr);
+}
+
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NitroMarkdown {
+
+enum class AllocationCategory {
+    // Parser bookkeeping not attributed to anything below.
+    Other,
+    // md4c's own buffers (marks, block and line storage, attribute builds).
+    Md4c,
+    // MarkdownNode objects and their children vectors.
+    Nodes,
+    // Text content and attribute strings.
+    Strings,
+    // The JSON output buffer.
+    Serializer,
+};
+
+inline constexpr size_t kAllocationCategoryCount = 5;
+
+/**
+ * Heap allocations made on the calling thread, per category. Only counted in
+ * builds with NITRO_MARKDOWN_ALLOC_STATS (the test and bench targets), which
+ * replace the global operator new and hook md4c's malloc; elsewhere all
+ * counts stay zero and AllocationScope compiles to nothing.
+ */
+struct AllocationCounts {
+    size_t count[kAllocationCategoryCount] = {};
+    size_t bytes[kAllocationCategoryCount] = {};
+    // Bytes currently allocated by the thread and their high-water mark since
+    // the last AllocationCounter::resetPeak(). Signed, as memory freed on
+    // another thread than it was allocated on is subtracted there.
+    int64_t liveBytes = 0;
+    int64_t peakBytes = 0;
+
+    size_t totalCount() const;
+    size_t totalBytes() const;
+    size_t countOf(AllocationCategory category) const { return count[static_cast<size_t>(category)]; }
+    size_t bytesOf(AllocationCategory category) const { return bytes[static_cast<size_t>(category)]; }
+
+    // Differences of count and bytes; live and peak are the later snapshot's.
+    AllocationCounts operator-(const AllocationCounts& earlier) const;
+};
+
+class AllocationCounter {
+public:
+    static constexpr bool kEnabled =
+#ifdef NITRO_MARKDOWN_ALLOC_STATS
+        true;
+#else
+        false;
+#endif
+
+    // Running totals for the calling thread; subtract two snapshots to get
+    // the allocations made in between.
+    static AllocationCounts snapshot();
+    // Starts a new high-water mark at the current live bytes.
+    static void resetPeak();
+
+    static const char* categoryName(AllocationCategory category);
+
+#ifdef NITRO_MARKDOWN_ALLOC_STATS
+    static void record(size_t bytes);
+    static void record(AllocationCategory category, size_t bytes);
+    static AllocationCategory current();
+    static void setCurrent(AllocationCategory category);
+#endif
+};
+
+// Attributes the calling thread's C++ allocations to a category until the
+// scope ends. md4c allocations are always counted as Md4c.
+class AllocationScope {
+public:
+#ifdef NITRO_MARKDOWN_ALLOC_STATS
+    explicit AllocationScope(AllocationCategory category) : previous_(AllocationCounter::current()) {
+        AllocationCounter::setCurrent(category);
+    }
+    ~AllocationScope() { AllocationCounter::setCurrent(previous_); }
+
+private:
+    AllocationCategory previous_;
+#else
+    explicit AllocationScope(AllocationCategory) {}
+#endif
+
+public:
+    AllocationScope(const AllocationScope&) = delete;
+    AllocationScope& operator=(const AllocationScope&) = delete;
+};
+
+} // namespace NitroMarkdown
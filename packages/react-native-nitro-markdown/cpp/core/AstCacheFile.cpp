@@ -0,0 +1,551 @@
+#include "AstCacheFile.hpp"
+#include "ContentHash.hpp"
+#include "MD4CParser.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include "MemoryAccounting.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace NitroMarkdown {
+
+namespace {
+
+// File layout, integers in the writer's byte order (the header's byte order
+// mark rejects files from a machine with the other one):
+//   header   magic, versions, byte order mark, entry count, file size,
+//            index checksum
+//   index    one IndexEntry per record, sorted by key
+//   records  back to back, in the order save() ranked them
+constexpr char kMagic[8] = {'N', 'M', 'D', 'A', 'S', 'T', 'C', '\0'};
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr size_t kHeaderBytes = 48;
+constexpr size_t kIndexEntryBytes = 64;
+
+constexpr uint32_t kBudgetExceededFlag = 1;
+
+// Bits of a node's field mask, in the order the fields follow it.
+enum FieldBit : uint32_t {
+    kContent = 1u << 0,
+    kLevel = 1u << 1,
+    kHref = 1u << 2,
+    kTitle = 1u << 3,
+    kAlt = 1u << 4,
+    kLanguage = 1u << 5,
+    kOrdered = 1u << 6,
+    kStart = 1u << 7,
+    kChecked = 1u << 8,
+    kIsHeader = 1u << 9,
+    kAlign = 1u << 10,
+    kBlockId = 1u << 11,
+    kSourceStart = 1u << 12,
+    kSourceEnd = 1u << 13,
+    // Values of the three booleans, meaningful only when they are set.
+    kOrderedValue = 1u << 14,
+    kCheckedValue = 1u << 15,
+    kIsHeaderValue = 1u << 16,
+};
+constexpr uint32_t kKnownFields = (1u << 17) - 1;
+
+void putVarint(std::string& out, uint64_t value) {
+    while (value >= 0x80) {
+        out += static_cast<char>((value & 0x7f) | 0x80);
+        value >>= 7;
+    }
+    out += static_cast<char>(value);
+}
+
+void putInt(std::string& out, int value) {
+    // Zigzag, so that small negative numbers stay short.
+    int64_t wide = value;
+    putVarint(out, static_cast<uint64_t>((wide << 1) ^ (wide >> 63)));
+}
+
+void putString(std::string& out, const std::string& value) {
+    putVarint(out, value.size());
+    out += value;
+}
+
+void encodeNode(std::string& out, const MarkdownNode& node) {
+    uint32_t mask = 0;
+    if (node.content) mask |= kContent;
+    if (node.level) mask |= kLevel;
+    if (node.href) mask |= kHref;
+    if (node.title) mask |= kTitle;
+    if (node.alt) mask |= kAlt;
+    if (node.language) mask |= kLanguage;
+    if (node.ordered) mask |= kOrdered | (*node.ordered ? static_cast<uint32_t>(kOrderedValue) : 0);
+    if (node.start) mask |= kStart;
+    if (node.checked) mask |= kChecked | (*node.checked ? static_cast<uint32_t>(kCheckedValue) : 0);
+    if (node.isHeader) mask |= kIsHeader | (*node.isHeader ? static_cast<uint32_t>(kIsHeaderValue) : 0);
+    if (node.align) mask |= kAlign;
+    if (node.blockId) mask |= kBlockId;
+    if (node.sourceStart) mask |= kSourceStart;
+    if (node.sourceEnd) mask |= kSourceEnd;
+
+    out += static_cast<char>(node.type);
+    putVarint(out, mask);
+    if (node.content) putString(out, *node.content);
+    if (node.level) putInt(out, *node.level);
+    if (node.href) putString(out, *node.href);
+    if (node.title) putString(out, *node.title);
+    if (node.alt) putString(out, *node.alt);
+    if (node.language) putString(out, *node.language);
+    if (node.start) putInt(out, *node.start);
+    if (node.align) out += static_cast<char>(*node.align);
+    if (node.blockId) putInt(out, *node.blockId);
+    if (node.sourceStart) putInt(out, *node.sourceStart);
+    if (node.sourceEnd) putInt(out, *node.sourceEnd);
+
+    putVarint(out, node.children.size());
+    for (const auto& child : node.children) encodeNode(out, *child);
+}
+
+// Bounds-checked cursor over a record; once a read fails, ok is false and
+// every later read fails too.
+struct Reader {
+    const unsigned char* p;
+    const unsigned char* end;
+    bool ok = true;
+
+    size_t remaining() const { return static_cast<size_t>(end - p); }
+
+    uint8_t byte() {
+        if (!ok || p == end) return fail();
+        return *p++;
+    }
+
+    uint64_t varint() {
+        uint64_t value = 0;
+        for (int shift = 0; shift < 64; shift += 7) {
+            uint8_t b = byte();
+            if (!ok) return 0;
+            value |= static_cast<uint64_t>(b & 0x7f) << shift;
+            if ((b & 0x80) == 0) return value;
+        }
+        return fail();
+    }
+
+    int integer() {
+        uint64_t zigzag = varint();
+        int64_t value = static_cast<int64_t>(zigzag >> 1) ^ -static_cast<int64_t>(zigzag & 1);
+        if (value < INT32_MIN || value > INT32_MAX) return fail();
+        return static_cast<int>(value);
+    }
+
+    std::string_view string() {
+        uint64_t size = varint();
+        if (!ok || size > remaining()) return fail(), std::string_view();
+        std::string_view value(reinterpret_cast<const char*>(p), size);
+        p += size;
+        return value;
+    }
+
+    uint8_t fail() {
+        ok = false;
+        p = end;
+        return 0;
+    }
+};
+
+bool readType(Reader& in, NodeType& type) {
+    uint8_t value = in.byte();
+    if (value > static_cast<uint8_t>(NodeType::HtmlInline)) in.fail();
+    type = static_cast<NodeType>(value);
+    return in.ok;
+}
+
+bool readMask(Reader& in, uint32_t& mask) {
+    uint64_t value = in.varint();
+    if (value & ~static_cast<uint64_t>(kKnownFields)) in.fail();
+    mask = static_cast<uint32_t>(value);
+    return in.ok;
+}
+
+bool readAlign(Reader& in, TextAlign& align) {
+    uint8_t value = in.byte();
+    if (value > static_cast<uint8_t>(TextAlign::Right)) in.fail();
+    align = static_cast<TextAlign>(value);
+    return in.ok;
+}
+
+// Every node takes at least three bytes: type, mask and child count.
+bool readChildCount(Reader& in, uint64_t& count) {
+    count = in.varint();
+    if (count > in.remaining() / 3) in.fail();
+    return in.ok;
+}
+
+std::shared_ptr<MarkdownNode> decodeNode(Reader& in) {
+    NodeType type;
+    uint32_t mask;
+    if (!readType(in, type) || !readMask(in, mask)) return nullptr;
+
+    auto node = std::make_shared<MarkdownNode>(type);
+    if (mask & kContent) node->content = std::string(in.string());
+    if (mask & kLevel) node->level = in.integer();
+    if (mask & kHref) node->href = std::string(in.string());
+    if (mask & kTitle) node->title = std::string(in.string());
+    if (mask & kAlt) node->alt = std::string(in.string());
+    if (mask & kLanguage) node->language = std::string(in.string());
+    if (mask & kOrdered) node->ordered = (mask & kOrderedValue) != 0;
+    if (mask & kStart) node->start = in.integer();
+    if (mask & kChecked) node->checked = (mask & kCheckedValue) != 0;
+    if (mask & kIsHeader) node->isHeader = (mask & kIsHeaderValue) != 0;
+    if (mask & kAlign) {
+        TextAlign align;
+        if (readAlign(in, align)) node->align = align;
+    }
+    if (mask & kBlockId) node->blockId = in.integer();
+    if (mask & kSourceStart) node->sourceStart = in.integer();
+    if (mask & kSourceEnd) node->sourceEnd = in.integer();
+
+    uint64_t count;
+    if (!readChildCount(in, count)) return nullptr;
+    node->children.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        auto child = decodeNode(in);
+        if (!child) return nullptr;
+        node->children.push_back(std::move(child));
+    }
+    return in.ok ? node : nullptr;
+}
+
+void jsonString(std::string& out, const char* name, std::string_view value) {
+    out += ",\"";
+    out += name;
+    out += "\":\"";
+    MarkdownJsonSerializer::appendEscaped(out, value);
+    out += '"';
+}
+
+void jsonInt(std::string& out, const char* name, int value) {
+    out += ",\"";
+    out += name;
+    out += "\":";
+    out += std::to_string(value);
+}
+
+void jsonBool(std::string& out, const char* name, bool value) {
+    out += ",\"";
+    out += name;
+    out += "\":";
+    out += value ? "true" : "false";
+}
+
+// Mirrors MarkdownJsonSerializer::appendJson field for field.
+bool nodeJson(std::string& out, Reader& in) {
+    NodeType type;
+    uint32_t mask;
+    if (!readType(in, type) || !readMask(in, mask)) return false;
+
+    out += "{\"type\":\"";
+    out += nodeTypeToString(type);
+    out += '"';
+    if (mask & kContent) jsonString(out, "content", in.string());
+    if (mask & kLevel) jsonInt(out, "level", in.integer());
+    if (mask & kHref) jsonString(out, "href", in.string());
+    if (mask & kTitle) jsonString(out, "title", in.string());
+    if (mask & kAlt) jsonString(out, "alt", in.string());
+    if (mask & kLanguage) jsonString(out, "language", in.string());
+    if (mask & kOrdered) jsonBool(out, "ordered", mask & kOrderedValue);
+    if (mask & kStart) jsonInt(out, "start", in.integer());
+    if (mask & kChecked) jsonBool(out, "checked", mask & kCheckedValue);
+    if (mask & kIsHeader) jsonBool(out, "isHeader", mask & kIsHeaderValue);
+    if (mask & kAlign) {
+        TextAlign align;
+        if (readAlign(in, align) && align != TextAlign::Default) {
+            out += ",\"align\":\"";
+            out += textAlignToString(align);
+            out += '"';
+        }
+    }
+    if (mask & kBlockId) jsonInt(out, "blockId", in.integer());
+    if (mask & kSourceStart) jsonInt(out, "sourceStart", in.integer());
+    if (mask & kSourceEnd) jsonInt(out, "sourceEnd", in.integer());
+
+    uint64_t count;
+    if (!readChildCount(in, count)) return false;
+    if (count > 0) {
+        out += ",\"children\":[";
+        for (uint64_t i = 0; i < count; ++i) {
+            if (i > 0) out += ',';
+            if (!nodeJson(out, in)) return false;
+        }
+        out += ']';
+    }
+    out += '}';
+    return in.ok;
+}
+
+uint32_t load32(const unsigned char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+uint64_t load64(const unsigned char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void store32(std::string& out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void store64(std::string& out, uint64_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool keyLess(const AstCacheFile::Key& a, const AstCacheFile::Key& b) {
+    return a.hash != b.hash ? a.hash < b.hash : a.size < b.size;
+}
+
+bool writeAll(FILE* file, const void* data, size_t size) {
+    return size == 0 || std::fwrite(data, 1, size, file) == size;
+}
+
+} // namespace
+
+AstCacheFile::~AstCacheFile() {
+    unmap();
+}
+
+std::string AstCacheFile::encode(const MarkdownNode& node) {
+    std::string out;
+    encodeNode(out, node);
+    return out;
+}
+
+std::shared_ptr<MarkdownNode> AstCacheFile::decode(std::string_view record) {
+    auto* begin = reinterpret_cast<const unsigned char*>(record.data());
+    Reader in{begin, begin + record.size()};
+    auto node = decodeNode(in);
+    // Trailing bytes mean the record is not what encode() wrote.
+    return node && in.remaining() == 0 ? node : nullptr;
+}
+
+bool AstCacheFile::appendJson(std::string& out, std::string_view record) {
+    auto* begin = reinterpret_cast<const unsigned char*>(record.data());
+    Reader in{begin, begin + record.size()};
+    return nodeJson(out, in) && in.remaining() == 0;
+}
+
+bool AstCacheFile::open(const std::string& path, size_t capacityBytes) {
+    close();
+    path_ = path;
+    capacityBytes_ = capacityBytes;
+    return mapFile();
+}
+
+void AstCacheFile::close() {
+    unmap();
+    path_.clear();
+    pending_.clear();
+    pendingBytes_ = 0;
+}
+
+std::optional<AstCacheFile::Hit> AstCacheFile::find(const Key& key) {
+    auto it = std::lower_bound(mapped_.begin(), mapped_.end(), key,
+                               [](const Mapped& entry, const Key& k) { return keyLess(entry.key, k); });
+    if (it != mapped_.end() && it->key == key) {
+        std::string_view record(reinterpret_cast<const char*>(data_ + it->offset), it->size);
+        if (ContentHash::hash(record) == it->checksum) {
+            it->used = true;
+            hits_++;
+            return Hit{record, it->stats};
+        }
+    }
+    for (auto p = pending_.rbegin(); p != pending_.rend(); ++p) {
+        if (p->key == key) {
+            hits_++;
+            return Hit{p->record, p->stats};
+        }
+    }
+    misses_++;
+    return std::nullopt;
+}
+
+void AstCacheFile::add(const Key& key, std::string record, const ParseStats& stats) {
+    if (!isOpen() || record.size() > capacityBytes_) return;
+    auto it = std::lower_bound(mapped_.begin(), mapped_.end(), key,
+                               [](const Mapped& entry, const Key& k) { return keyLess(entry.key, k); });
+    if (it != mapped_.end() && it->key == key) return;
+    for (const auto& p : pending_) {
+        if (p.key == key) return;
+    }
+
+    ParseStats kept;
+    kept.operations = stats.operations;
+    kept.budgetExceeded = stats.budgetExceeded;
+    kept.plainTextOffset = stats.plainTextOffset;
+    pendingBytes_ += record.size();
+    pending_.push_back(Pending{key, std::move(record), kept});
+    // save() could not write more than the capacity anyway.
+    while (pendingBytes_ > capacityBytes_) {
+        pendingBytes_ -= pending_.front().record.size();
+        pending_.pop_front();
+    }
+}
+
+bool AstCacheFile::save() {
+    if (!isOpen()) return false;
+
+    struct Chosen {
+        Key key;
+        std::string_view record;
+        ParseStats stats;
+        uint64_t offset = 0;
+    };
+    std::vector<Chosen> chosen;
+    size_t total = kHeaderBytes;
+    auto take = [&](const Key& key, std::string_view record, const ParseStats& stats) {
+        if (total + kIndexEntryBytes + record.size() > capacityBytes_) return;
+        total += kIndexEntryBytes + record.size();
+        chosen.push_back(Chosen{key, record, stats});
+    };
+
+    for (auto p = pending_.rbegin(); p != pending_.rend(); ++p) take(p->key, p->record, p->stats);
+    std::vector<const Mapped*> byOffset;
+    byOffset.reserve(mapped_.size());
+    for (const auto& entry : mapped_) byOffset.push_back(&entry);
+    std::sort(byOffset.begin(), byOffset.end(),
+              [](const Mapped* a, const Mapped* b) { return a->offset < b->offset; });
+    for (bool used : {true, false}) {
+        for (const Mapped* entry : byOffset) {
+            if (entry->used != used) continue;
+            std::string_view record(reinterpret_cast<const char*>(data_ + entry->offset), entry->size);
+            take(entry->key, record, entry->stats);
+        }
+    }
+
+    uint64_t offset = kHeaderBytes + chosen.size() * kIndexEntryBytes;
+    for (auto& c : chosen) {
+        c.offset = offset;
+        offset += c.record.size();
+    }
+
+    std::vector<const Chosen*> byKey;
+    byKey.reserve(chosen.size());
+    for (const auto& c : chosen) byKey.push_back(&c);
+    std::sort(byKey.begin(), byKey.end(), [](const Chosen* a, const Chosen* b) { return keyLess(a->key, b->key); });
+
+    std::string index;
+    index.reserve(chosen.size() * kIndexEntryBytes);
+    for (const Chosen* c : byKey) {
+        store64(index, c->key.hash);
+        store64(index, c->key.size);
+        store64(index, c->offset);
+        store64(index, c->record.size());
+        store64(index, ContentHash::hash(c->record));
+        store64(index, c->stats.operations);
+        store64(index, c->stats.plainTextOffset);
+        store64(index, c->stats.budgetExceeded ? kBudgetExceededFlag : 0);
+    }
+
+    std::string header(kMagic, sizeof(kMagic));
+    store32(header, kFormatVersion);
+    store32(header, MD4CParser::kOutputVersion);
+    store32(header, ContentHash::kVersion);
+    store32(header, kByteOrderMark);
+    store64(header, chosen.size());
+    store64(header, offset);
+    store64(header, ContentHash::hash(index));
+
+    // Written next to the file and renamed over it, so a crash or a full disk
+    // leaves the previous cache intact.
+    std::string temporary = path_ + ".tmp";
+    FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file) return false;
+    bool written = writeAll(file, header.data(), header.size()) && writeAll(file, index.data(), index.size());
+    for (size_t i = 0; written && i < chosen.size(); ++i) {
+        written = writeAll(file, chosen[i].record.data(), chosen[i].record.size());
+    }
+    written = std::fflush(file) == 0 && written;
+    written = ::fsync(fileno(file)) == 0 && written;
+    written = std::fclose(file) == 0 && written;
+    if (!written || std::rename(temporary.c_str(), path_.c_str()) != 0) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    pending_.clear();
+    pendingBytes_ = 0;
+    unmap();
+    return mapFile();
+}
+
+AstCacheFile::Stats AstCacheFile::stats() const {
+    return Stats{hits_, misses_, mapped_.size() + pending_.size(), size_, pendingBytes_};
+}
+
+size_t AstCacheFile::memoryBytes() const {
+    size_t bytes = MemoryFootprint::heapBytes(mapped_) + MemoryFootprint::heapBytes(path_);
+    for (const auto& p : pending_) bytes += sizeof(Pending) + MemoryFootprint::heapBytes(p.record);
+    return bytes;
+}
+
+void AstCacheFile::unmap() {
+    if (data_) ::munmap(const_cast<unsigned char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+    mapped_.clear();
+}
+
+bool AstCacheFile::mapFile() {
+    int fd = ::open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) return false;
+    struct stat info;
+    if (::fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(kHeaderBytes)) {
+        ::close(fd);
+        return false;
+    }
+    size_t size = static_cast<size_t>(info.st_size);
+    void* address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (address == MAP_FAILED) return false;
+    data_ = static_cast<const unsigned char*>(address);
+    size_ = size;
+
+    const unsigned char* h = data_;
+    uint64_t count = load64(h + 24);
+    bool valid = std::memcmp(h, kMagic, sizeof(kMagic)) == 0 && load32(h + 8) == kFormatVersion &&
+                 load32(h + 12) == MD4CParser::kOutputVersion && load32(h + 16) == ContentHash::kVersion &&
+                 load32(h + 20) == kByteOrderMark && load64(h + 32) == size &&
+                 count <= (size - kHeaderBytes) / kIndexEntryBytes;
+    size_t recordsStart = kHeaderBytes + static_cast<size_t>(count) * kIndexEntryBytes;
+    valid = valid && ContentHash::hash(data_ + kHeaderBytes, recordsStart - kHeaderBytes) == load64(h + 40);
+    if (!valid) {
+        unmap();
+        return false;
+    }
+
+    mapped_.reserve(count);
+    for (uint64_t i = 0; i < count; ++i) {
+        const unsigned char* e = data_ + kHeaderBytes + i * kIndexEntryBytes;
+        Mapped entry;
+        entry.key = Key{load64(e), static_cast<size_t>(load64(e + 8))};
+        entry.offset = load64(e + 16);
+        entry.size = load64(e + 24);
+        entry.checksum = load64(e + 32);
+        entry.stats.operations = load64(e + 40);
+        entry.stats.plainTextOffset = load64(e + 48);
+        entry.stats.budgetExceeded = (load64(e + 56) & kBudgetExceededFlag) != 0;
+        bool inBounds = entry.offset >= recordsStart && entry.offset <= size && entry.size <= size - entry.offset;
+        bool sorted = mapped_.empty() || keyLess(mapped_.back().key, entry.key);
+        if (!inBounds || !sorted) {
+            unmap();
+            return false;
+        }
+        mapped_.push_back(entry);
+    }
+    return true;
+}
+
+} // namespace NitroMarkdown
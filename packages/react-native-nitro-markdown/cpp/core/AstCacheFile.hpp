@@ -0,0 +1,126 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include "ParseResultCache.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Parse results persisted in a single file that is memory-mapped when
+ * opened, so an app restarting with a long history loads its messages
+ * without parsing them again.
+ *
+ * Each result is stored as a record: the tree in pre-order, every node a
+ * type byte, a varint mask of its set fields, the fields themselves and its
+ * child count. Records hold no pointers or absolute offsets, so they are
+ * read in place from wherever the file is mapped. The file starts with a
+ * header carrying the format, parser output and hash versions; a file
+ * written by any other version, truncated or otherwise damaged opens as
+ * empty. Records are checksummed and only decoded once their checksum
+ * matches.
+ *
+ * Results parsed while the file is open are added in memory and written out
+ * by save(), together with the records worth keeping from the mapped file.
+ */
+class AstCacheFile {
+public:
+    using Key = ParseResultCache::Key;
+
+    // 2: keys tell UTF-16 offsets from byte offsets.
+    static constexpr uint32_t kFormatVersion = 2;
+    static constexpr size_t kDefaultCapacityBytes = 32u << 20;
+
+    struct Hit {
+        // Valid until the next add, open, save or close.
+        std::string_view record;
+        ParseStats stats;
+    };
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        // Records in the mapped file and added since it was opened.
+        size_t entries = 0;
+        // Size of the mapped file.
+        size_t mappedBytes = 0;
+        // Records added since the file was opened, not yet saved.
+        size_t pendingBytes = 0;
+    };
+
+    AstCacheFile() = default;
+    ~AstCacheFile();
+    AstCacheFile(const AstCacheFile&) = delete;
+    AstCacheFile& operator=(const AstCacheFile&) = delete;
+
+    // Encodes node and its subtree as a record.
+    static std::string encode(const MarkdownNode& node);
+    // Rebuilds the tree of a record; nullptr if the record is malformed.
+    static std::shared_ptr<MarkdownNode> decode(std::string_view record);
+    // Appends the JSON MarkdownJsonSerializer produces for the tree of a
+    // record, without building the tree. Returns false, leaving out in an
+    // unspecified state, if the record is malformed.
+    static bool appendJson(std::string& out, std::string_view record);
+
+    // Maps the file at path, replacing whatever was open. save() writes back
+    // to path, bounded to capacityBytes. Returns whether the file held a valid
+    // cache; a missing or invalid one leaves the cache empty but open.
+    bool open(const std::string& path, size_t capacityBytes = kDefaultCapacityBytes);
+    bool isOpen() const { return !path_.empty(); }
+    // Unmaps the file and drops unsaved records.
+    void close();
+
+    // The record stored under key, or nothing on a miss or a damaged record.
+    std::optional<Hit> find(const Key& key);
+    void add(const Key& key, std::string record, const ParseStats& stats);
+
+    // Writes the added records, newest first, then the mapped ones read
+    // since opening and then the others in file order, until capacityBytes
+    // is reached. The file is replaced atomically and mapped again.
+    bool save();
+
+    Stats stats() const;
+    // Heap bytes of the added records and the index; the mapping itself is
+    // backed by the file and not counted.
+    size_t memoryBytes() const;
+
+private:
+    struct Pending {
+        Key key;
+        std::string record;
+        ParseStats stats;
+    };
+
+    struct Mapped {
+        Key key;
+        uint64_t offset;
+        uint64_t size;
+        uint64_t checksum;
+        ParseStats stats;
+        bool used = false;
+    };
+
+    void unmap();
+    bool mapFile();
+
+    std::string path_;
+    size_t capacityBytes_ = kDefaultCapacityBytes;
+    const unsigned char* data_ = nullptr;
+    size_t size_ = 0;
+    // Sorted by key.
+    std::vector<Mapped> mapped_;
+    // Oldest first.
+    std::deque<Pending> pending_;
+    size_t pendingBytes_ = 0;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,96 @@
+#include "BatchParser.hpp"
+#include "AstCacheFile.hpp"
+#include "MD4CParser.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include "Tracer.hpp"
+#include "Utf16.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <numeric>
+#include <stdexcept>
+
+namespace NitroMarkdown {
+
+BatchParser::BatchParser(size_t threads, TaskScheduler& scheduler) : scheduler_(scheduler) {
+    size_t available = scheduler.threads() + 1;
+    threads_ = std::min({threads == 0 ? available : threads, available, kMaxThreads});
+}
+
+std::string BatchParser::joinJson(const std::vector<std::string>& documents, std::vector<size_t>& offsets) {
+    size_t bytes = 2 + documents.size();
+    for (const auto& json : documents) bytes += json.size();
+    std::string json;
+    json.reserve(bytes);
+    offsets.clear();
+    offsets.reserve(documents.size() + 1);
+    size_t offset = 1;
+    json += '[';
+    for (size_t i = 0; i < documents.size(); i++) {
+        if (i > 0) {
+            json += ',';
+            offset++;
+        }
+        offsets.push_back(offset);
+        json += documents[i];
+        offset += Utf16::length(documents[i]);
+    }
+    json += ']';
+    offsets.push_back(offset + 1);
+    return json;
+}
+
+size_t BatchParser::threadsFor(size_t documents, size_t totalBytes) const {
+    return std::max<size_t>(1, std::min({threads_, documents, totalBytes / kMinBytesPerThread + 1}));
+}
+
+void BatchParser::parse(std::vector<Document>& documents, const ParserOptions& options, bool records,
+                        TaskScheduler::Priority priority) const {
+    if (options.deferInlines) {
+        throw std::invalid_argument("BatchParser cannot defer inlines");
+    }
+    NITRO_MARKDOWN_TRACE_SCOPE("parse batch", static_cast<int64_t>(documents.size()));
+
+    std::vector<size_t> order(documents.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&](size_t a, size_t b) { return documents[a].text.size() > documents[b].text.size(); });
+    size_t totalBytes = 0;
+    for (const auto& document : documents) totalBytes += document.text.size();
+
+    std::atomic<size_t> next{0};
+    std::exception_ptr error;
+    std::mutex errorMutex;
+    auto work = [&] {
+        try {
+            MD4CParser parser;
+            for (size_t i = next++; i < order.size(); i = next++) {
+                Document& document = documents[order[i]];
+                auto root = parser.parse(document.text, options, ExternalReferences{});
+                document.stats = parser.lastStats();
+                document.json = MarkdownJsonSerializer::toJson(root);
+                if (records && root) document.record = AstCacheFile::encode(*root);
+            }
+        } catch (...) {
+            // Let the other threads run out of documents.
+            next = order.size();
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (!error) error = std::current_exception();
+        }
+    };
+
+    TaskScheduler::Group helpers;
+    size_t count = threadsFor(documents.size(), totalBytes);
+    for (size_t i = 1; i < count; i++) {
+        if (!scheduler_.submit(helpers, priority, work)) break;
+    }
+    work();
+    // Helpers still queued behind other work would find nothing left to do.
+    helpers.cancel();
+    helpers.wait();
+    if (error) std::rethrow_exception(error);
+}
+
+} // namespace NitroMarkdown
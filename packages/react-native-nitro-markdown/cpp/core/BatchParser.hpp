@@ -0,0 +1,67 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include "TaskScheduler.hpp"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Parses and serializes many independent documents in one call, e.g. the
+ * history of a conversation, on the calling thread helped by tasks on a
+ * TaskScheduler. Each thread has its own MD4CParser and takes the next
+ * document from a shared counter, largest documents first so that one long
+ * message does not finish last on its own.
+ *
+ * Small batches are parsed on the calling thread alone: handing work to
+ * another thread costs about as much as parsing a few kilobytes.
+ */
+class BatchParser {
+public:
+    // Phone SoCs have at most four fast cores; more threads end up on the
+    // efficiency cores and mostly add contention.
+    static constexpr size_t kMaxThreads = 4;
+    // Input each additional thread needs to be worth starting.
+    static constexpr size_t kMinBytesPerThread = 32u << 10;
+
+    struct Document {
+        std::string_view text;
+        // Filled in by parse(); initialized so that {text} names every field.
+        std::string json{};
+        ParseStats stats{};
+        // AstCacheFile record of the tree, when parse() is asked for records.
+        std::string record{};
+    };
+
+    // Uses up to `threads` threads including the caller's, and no more than
+    // the scheduler has workers plus one; 0 uses as many as that allows.
+    explicit BatchParser(size_t threads = 0, TaskScheduler& scheduler = TaskScheduler::shared());
+
+    size_t threads() const { return threads_; }
+
+    // Parses every document with options, which must not defer inlines. The
+    // calling thread works too and returns once all documents are done; an
+    // exception thrown for any document is rethrown here. Helpers are queued
+    // with priority; when the queue is full, the calling thread does their
+    // share.
+    void parse(std::vector<Document>& documents, const ParserOptions& options, bool records = false,
+               TaskScheduler::Priority priority = TaskScheduler::Priority::Visible) const;
+
+    // Threads parse() would use for documents of these sizes.
+    size_t threadsFor(size_t documents, size_t totalBytes) const;
+
+    // Joins the JSON of documents into one array. offsets receives where
+    // each document starts in it, in UTF-16 code units as JS indexes the
+    // string, then the array's length: document i spans offsets[i] to
+    // offsets[i + 1] - 1, leaving out the comma or bracket after it.
+    static std::string joinJson(const std::vector<std::string>& documents, std::vector<size_t>& offsets);
+
+private:
+    TaskScheduler& scheduler_;
+    size_t threads_;
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,94 @@
+#include "BlockMemo.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include "MemoryAccounting.hpp"
+
+namespace NitroMarkdown {
+
+namespace {
+
+// A list node holds two pointers besides the entry; each index node holds a
+// next pointer, the key, the iterator and a cached hash.
+constexpr size_t kEntryOverhead = 2 * sizeof(void*) + 2 * (3 * sizeof(void*) + sizeof(uint64_t));
+
+} // namespace
+
+BlockMemo::BlockMemo(size_t capacityBytes) : capacityBytes_(capacityBytes) {}
+
+std::shared_ptr<MarkdownNode> BlockMemo::find(uint64_t key) {
+    auto it = byKey_.find(key);
+    if (it == byKey_.end()) {
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->node;
+}
+
+void BlockMemo::insert(uint64_t key, std::shared_ptr<MarkdownNode> node) {
+    if (capacityBytes_ == 0 || !node || byKey_.count(key) || byNode_.count(node.get())) return;
+
+    MemoryFootprint footprint;
+    footprint.addTree(*node);
+    size_t bytes = sizeof(Entry) + kEntryOverhead + footprint.nodeBytes + footprint.stringBytes;
+    if (bytes > capacityBytes_) return;
+
+    const MarkdownNode* raw = node.get();
+    entries_.push_front(Entry{key, std::move(node), std::string(), bytes});
+    byKey_[key] = entries_.begin();
+    byNode_[raw] = entries_.begin();
+    bytes_ += bytes;
+    evictToCapacity();
+}
+
+const std::string* BlockMemo::json(const MarkdownNode& node) {
+    auto it = byNode_.find(&node);
+    if (it == byNode_.end()) return nullptr;
+
+    Entry& entry = *it->second;
+    if (entry.json.empty()) {
+        MarkdownJsonSerializer::appendJson(entry.json, node);
+        size_t jsonBytes = MemoryFootprint::heapBytes(entry.json);
+        entry.bytes += jsonBytes;
+        bytes_ += jsonBytes;
+        if (bytes_ > capacityBytes_) {
+            // Keep this entry alive for the caller; it is the one in use.
+            entries_.splice(entries_.begin(), entries_, it->second);
+            evictToCapacity();
+            if (byNode_.count(&node) == 0) return nullptr;
+        }
+    }
+    return &entry.json;
+}
+
+void BlockMemo::setCapacity(size_t capacityBytes) {
+    capacityBytes_ = capacityBytes;
+    evictToCapacity();
+}
+
+void BlockMemo::clear() {
+    entries_.clear();
+    byKey_.clear();
+    byNode_.clear();
+    bytes_ = 0;
+}
+
+BlockMemo::Stats BlockMemo::stats() const {
+    return Stats{hits_, misses_, entries_.size(), bytes_};
+}
+
+size_t BlockMemo::memoryBytes() const {
+    return bytes_ + (byKey_.bucket_count() + byNode_.bucket_count()) * sizeof(void*);
+}
+
+void BlockMemo::evictToCapacity() {
+    while (bytes_ > capacityBytes_ && !entries_.empty()) {
+        const Entry& oldest = entries_.back();
+        bytes_ -= oldest.bytes;
+        byKey_.erase(oldest.key);
+        byNode_.erase(oldest.node.get());
+        entries_.pop_back();
+    }
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace NitroMarkdown {
+
+/**
+ * Subtrees of top-level blocks from earlier parses, keyed by a hash of the
+ * block's source and everything else its output depends on, together with
+ * their JSON once serialized. An edited or regenerated message mostly
+ * consists of blocks that are unchanged from its previous version; those are
+ * taken from here instead of being rebuilt and re-escaped.
+ *
+ * Bounded in bytes; least recently used blocks are dropped first.
+ */
+class BlockMemo {
+public:
+    static constexpr size_t kDefaultCapacityBytes = 4u << 20;
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+    explicit BlockMemo(size_t capacityBytes = 0);
+
+    // The subtree stored under key, marked most recently used, or nullptr.
+    std::shared_ptr<MarkdownNode> find(uint64_t key);
+    void insert(uint64_t key, std::shared_ptr<MarkdownNode> node);
+
+    // JSON of node if it is a subtree held here, serialized on first use;
+    // nullptr for any other node. Valid until the next call that modifies
+    // the memo.
+    const std::string* json(const MarkdownNode& node);
+    bool contains(const MarkdownNode& node) const { return byNode_.count(&node) != 0; }
+
+    // 0 disables the memo.
+    void setCapacity(size_t capacityBytes);
+    bool enabled() const { return capacityBytes_ > 0; }
+    void clear();
+
+    Stats stats() const;
+    // Heap bytes held by the subtrees, their JSON and the indexes.
+    size_t memoryBytes() const;
+
+private:
+    struct Entry {
+        uint64_t key;
+        std::shared_ptr<MarkdownNode> node;
+        std::string json;
+        size_t bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    void evictToCapacity();
+
+    size_t capacityBytes_;
+    size_t bytes_ = 0;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+    // Most recently used first.
+    EntryList entries_;
+    std::unordered_map<uint64_t, EntryList::iterator> byKey_;
+    std::unordered_map<const MarkdownNode*, EntryList::iterator> byNode_;
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,71 @@
+#include "ContentHash.hpp"
+
+#include <cstring>
+
+namespace NitroMarkdown {
+
+namespace {
+
+constexpr uint64_t kSecret0 = 0xa0761d6478bd642full;
+constexpr uint64_t kSecret1 = 0xe7037ed1a0b428dbull;
+constexpr uint64_t kSecret2 = 0x8ebc6af09c88c6e3ull;
+
+// Multiplies to 128 bits and folds the halves together.
+inline uint64_t mix(uint64_t a, uint64_t b) {
+#ifdef __SIZEOF_INT128__
+    __uint128_t product = static_cast<__uint128_t>(a) * b;
+    return static_cast<uint64_t>(product) ^ static_cast<uint64_t>(product >> 64);
+#else
+    // 32-bit targets, e.g. armeabi-v7a.
+    uint64_t aLow = a & 0xffffffffu, aHigh = a >> 32;
+    uint64_t bLow = b & 0xffffffffu, bHigh = b >> 32;
+    uint64_t lowLow = aLow * bLow, lowHigh = aLow * bHigh, highLow = aHigh * bLow, highHigh = aHigh * bHigh;
+    uint64_t middle = (lowLow >> 32) + (lowHigh & 0xffffffffu) + (highLow & 0xffffffffu);
+    uint64_t low = (lowLow & 0xffffffffu) | (middle << 32);
+    uint64_t high = highHigh + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+    return low ^ high;
+#endif
+}
+
+inline uint64_t read64(const unsigned char* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Reads 0 to 8 bytes.
+inline uint64_t readTail(const unsigned char* p, size_t size) {
+    uint64_t value = 0;
+    std::memcpy(&value, p, size);
+    return value;
+}
+
+} // namespace
+
+uint64_t ContentHash::hash(const void* data, size_t size, uint64_t seed) {
+    const auto* p = static_cast<const unsigned char*>(data);
+    size_t remaining = size;
+    uint64_t state = seed ^ mix(seed ^ kSecret0, kSecret1);
+
+    while (remaining > 16) {
+        state = mix(read64(p) ^ kSecret1, read64(p + 8) ^ state);
+        p += 16;
+        remaining -= 16;
+    }
+
+    uint64_t a = 0;
+    uint64_t b = 0;
+    if (remaining > 8) {
+        a = read64(p);
+        b = readTail(p + 8, remaining - 8);
+    } else {
+        a = readTail(p, remaining);
+    }
+    return mix(kSecret2 ^ static_cast<uint64_t>(size), mix(a ^ kSecret1, b ^ state));
+}
+
+uint64_t ContentHash::combine(uint64_t a, uint64_t b) {
+    return mix(a ^ kSecret0, b ^ kSecret2);
+}
+
+} // namespace NitroMarkdown
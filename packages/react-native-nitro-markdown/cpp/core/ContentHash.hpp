@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+/**
+ * Fast non-cryptographic 64-bit hash for cache keys over document text.
+ * Consumes 16 bytes per multiply, so hashing costs a small fraction of
+ * parsing the same text. Not stable across versions of this library; never
+ * persist a hash without also persisting kVersion.
+ */
+class ContentHash {
+public:
+    static constexpr uint32_t kVersion = 1;
+
+    static uint64_t hash(const void* data, size_t size, uint64_t seed = 0);
+
+    static uint64_t hash(std::string_view text, uint64_t seed = 0) {
+        return hash(text.data(), text.size(), seed);
+    }
+
+    // Combines two hashes, e.g. a text hash with one of its options.
+    static uint64_t combine(uint64_t a, uint64_t b);
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,90 @@
+#include "HtmlEntities.hpp"
+#include "HtmlEntityTable.hpp"
+
+#include <algorithm>
+
+namespace NitroMarkdown {
+
+namespace {
+
+// Must match fnv1a() in scripts/generate-html-entities.py.
+uint32_t fnv1a(std::string_view data, uint32_t seed) {
+    uint32_t hash = 2166136261u ^ seed;
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+} // namespace
+
+const char* HtmlEntities::lookupNamed(std::string_view name) {
+    using namespace HtmlEntityTable;
+    if (name.empty() || name.size() > kMaxNameLength) return nullptr;
+
+    int32_t displacement = kDisplacements[fnv1a(name, 0) % kBucketCount];
+    uint32_t slot = displacement < 0
+        ? static_cast<uint32_t>(-displacement - 1)
+        : fnv1a(name, static_cast<uint32_t>(displacement)) % kEntryCount;
+
+    const Entry& entry = kEntries[slot];
+    return name == entry.name ? entry.utf8 : nullptr;
+}
+
+void HtmlEntities::appendUtf8(std::string& out, uint32_t codepoint) {
+    if (codepoint == 0 || (codepoint >= 0xD800 && codepoint <= 0xDFFF) || codepoint > 0x10FFFF) {
+        codepoint = 0xFFFD;
+    }
+
+    if (codepoint < 0x80) {
+        out += static_cast<char>(codepoint);
+    } else if (codepoint < 0x800) {
+        out += static_cast<char>(0xC0 | (codepoint >> 6));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else if (codepoint < 0x10000) {
+        out += static_cast<char>(0xE0 | (codepoint >> 12));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    } else {
+        out += static_cast<char>(0xF0 | (codepoint >> 18));
+        out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+        out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+        out += static_cast<char>(0x80 | (codepoint & 0x3F));
+    }
+}
+
+void HtmlEntities::appendDecoded(std::string& out, std::string_view entity) {
+    if (entity.size() < 3 || entity.front() != '&' || entity.back() != ';') {
+        out.append(entity);
+        return;
+    }
+    std::string_view body = entity.substr(1, entity.size() - 2);
+
+    if (body[0] == '#') {
+        uint32_t codepoint = 0;
+        bool hex = body.size() > 1 && (body[1] == 'x' || body[1] == 'X');
+        for (size_t i = hex ? 2 : 1; i < body.size(); i++) {
+            char c = body[i];
+            uint32_t digit;
+            if (c >= '0' && c <= '9') digit = c - '0';
+            else if (hex && c >= 'a' && c <= 'f') digit = c - 'a' + 10;
+            else if (hex && c >= 'A' && c <= 'F') digit = c - 'A' + 10;
+            else {
+                out.append(entity);
+                return;
+            }
+            codepoint = std::min<uint32_t>(codepoint * (hex ? 16 : 10) + digit, 0x110000);
+        }
+        appendUtf8(out, codepoint);
+        return;
+    }
+
+    if (const char* text = lookupNamed(body)) {
+        out += text;
+    } else {
+        out.append(entity);
+    }
+}
+
+} // namespace NitroMarkdown
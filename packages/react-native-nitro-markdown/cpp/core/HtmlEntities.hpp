@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+/**
+ * Decoding of the character references md4c reports as MD_TEXT_ENTITY:
+ * named ("&amp;"), decimal ("&#35;") and hexadecimal ("&#x1F600;").
+ */
+class HtmlEntities {
+public:
+    // Appends the UTF-8 text the entity stands for. Unknown named entities are
+    // appended verbatim, as CommonMark treats them as literal text.
+    static void appendDecoded(std::string& out, std::string_view entity);
+
+    // Appends the UTF-8 encoding of a code point; invalid code points (zero,
+    // surrogates, beyond U+10FFFF) become U+FFFD.
+    static void appendUtf8(std::string& out, uint32_t codepoint);
+
+    // Returns the UTF-8 text of a named entity without '&' and ';', or nullptr.
+    static const char* lookupNamed(std::string_view name);
+};
+
+} // namespace NitroMarkdown
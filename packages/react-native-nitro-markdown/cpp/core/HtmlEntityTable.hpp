@@ -0,0 +1,2198 @@
+///
+/// HtmlEntityTable.hpp
+/// This file was generated by scripts/generate-html-entities.py. DO NOT MODIFY THIS FILE.
+///
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NitroMarkdown::HtmlEntityTable {
+
+struct Entry {
+    const char* name;
+    const char* utf8;
+};
+
+inline constexpr uint32_t kEntryCount = 2125;
+inline constexpr uint32_t kBucketCount = 532;
+inline constexpr size_t kMaxNameLength = 31;
+
+inline constexpr int32_t kDisplacements[kBucketCount] = {
+    37, 8, 3, 444, 14, 423, 86, 8, -4, -60, 6, 16,
+    14, 53, -104, 214, -125, 150, 31, 19, -158, 16, 6, 1,
+    1, -185, 6, 126, 302, 11, 117, 6, 116, 33, 1, 181,
+    81, 214, 1, 89, 11, 12, 1, 26, 69, 150, 0, 42,
+    1, 142, 133, 17, 1, 12, 4, 124, 3, 9, -265, 1,
+    54, 22, 64, 106, 2, 97, 163, 27, -294, -351, 81, 1,
+    0, 89, 2, 68, 6, 12, 190, 255, 1, 37, 1, 1,
+    3, 16, 3, 33, 30, 1, 94, 3, 28, 6, 17, 193,
+    24, 0, 1, 6, 3, 4, 24, -371, 2, 380, 205, 1,
+    26, 4, 11, 1, 7, 12, 4, 55, 24, -392, 48, 11,
+    338, 7, 14, 8, 14, 35, 1, 0, 19, 223, 62, 9,
+    1, 392, 182, 148, 34, 16, 583, 1, 165, 3, 535, -415,
+    128, -434, 26, 200, 14, 49, 143, 1, 64, 208, 34, 3,
+    1, 239, 8, 322, -454, 120, 3, -485, 163, 150, 22, 1,
+    36, 369, 5, 2, 21, 22, 38, 44, 11, 1, 12, 8,
+    15, -534, 7, 142, 60, 2, 8, -544, 1, 306, 1, 44,
+    49, -558, 35, 1, 1, 439, 111, 73, 275, 9, 114, 6,
+    4, -581, 9, 38, 67, 218, 9, 878, 141, 9, 1, -593,
+    142, -595, 109, 905, 32, 19, 3, 11, 119, 1, 1018, -684,
+    520, 97, 8, 2, -688, 10, 37, 1, 18, 89, 4, 36,
+    71, 20, 52, 481, 2, 3, 128, 6, 52, 21, 2, 252,
+    34, 232, 91, 90, 21, 213, 2, 1, 142, -842, 4, 64,
+    41, 470, 23, 45, 2, -859, 185, 153, 122, 2, -1150, 20,
+    179, 12, 1, 125, 60, 1, 1, 8, 83, 20, 208, 9,
+    28, 143, 409, 58, 3, 273, 72, 46, 2, 1, 144, 180,
+    -1166, 113, 135, 3, 1360, 0, -1283, 242, 7, 366, 14, 5,
+    88, 189, 372, 1, -1295, 9, 67, 107, 150, 2, 43, 518,
+    52, 512, 91, 213, 491, 83, 174, 803, 559, 14, 7, 754,
+    144, 14, 388, 5, 300, 374, 319, 203, -1305, -1364, -1366, 497,
+    213, 4, 7, 1603, 268, 678, 64, 67, 267, 32, 110, 579,
+    398, 35, 91, 20, 12, 4, 228, 116, 565, 38, 4, 437,
+    157, 0, 214, 769, 610, 202, 48, 61, 110, 188, 15, 338,
+    14, 535, 252, 1, 9, 876, -1409, -1450, 1, -1460, 1951, 9,
+    268, 6, 1, 133, 1080, 576, 730, 3, -1582, 6, 498, 66,
+    345, 1220, 8, 190, 2, 236, 2, 10, 208, 47, 10, 134,
+    87, 1, 3, 21, 171, 173, -1674, -1710, 2, 8, 235, 20,
+    4, 73, 754, 6, -1726, -1872, -2004, 164, 425, 39, 1, 1886,
+    1981, 519, 441, 242, 56, 9, 1, 224, 11, -2039, 1036, 1,
+    701, 31, 1288, 7, 2548, 902, 95, 609, 129, 556, -2040, 87,
+    2404, 3, 3, 579, 26, 164, 1, 113, 2825, 5, 73, 76,
+    479, 430, 109, 24, 53, 7, 1, 130, 25, 17, 3, 25,
+    6279, 0, 37, 76, 1166, 200, 942, 956, 426, 20, 38, 2333,
+    669, 1399, 9, 278, 19, 15, 278, 5, 18, 52, -2105, 564,
+    421, 3, 186, 101, 1, 23, 0, 46, 3490, 9, 665, 4,
+    51, 119, 14, 354,
+};
+
+inline constexpr Entry kEntries[kEntryCount] = {
+    {"downdownarrows", "\342\207\212"},
+    {"gscr", "\342\204\212"},
+    {"bigsqcup", "\342\250\206"},
+    {"harrcir", "\342\245\210"},
+    {"oS", "\342\223\210"},
+    {"olt", "\342\247\200"},
+    {"laquo", "\302\253"},
+    {"gammad", "\317\235"},
+    {"Zacute", "\305\271"},
+    {"SOFTcy", "\320\254"},
+    {"LessFullEqual", "\342\211\246"},
+    {"acy", "\320\260"},
+    {"ForAll", "\342\210\200"},
+    {"ifr", "\360\235\224\246"},
+    {"apE", "\342\251\260"},
+    {"iinfin", "\342\247\234"},
+    {"aelig", "\303\246"},
+    {"mp", "\342\210\223"},
+    {"quot", "\042"},
+    {"Eacute", "\303\211"},
+    {"notin", "\342\210\211"},
+    {"Implies", "\342\207\222"},
+    {"sub", "\342\212\202"},
+    {"Psi", "\316\250"},
+    {"tfr", "\360\235\224\261"},
+    {"propto", "\342\210\235"},
+    {"DScy", "\320\205"},
+    {"ZeroWidthSpace", "\342\200\213"},
+    {"trianglerighteq", "\342\212\265"},
+    {"searhk", "\342\244\245"},
+    {"smashp", "\342\250\263"},
+    {"UnderBracket", "\342\216\265"},
+    {"CircleDot", "\342\212\231"},
+    {"Element", "\342\210\210"},
+    {"Kcy", "\320\232"},
+    {"varepsilon", "\317\265"},
+    {"timesd", "\342\250\260"},
+    {"LeftTeeArrow", "\342\206\244"},
+    {"bigoplus", "\342\250\201"},
+    {"Longleftarrow", "\342\237\270"},
+    {"mfr", "\360\235\224\252"},
+    {"FilledSmallSquare", "\342\227\274"},
+    {"subE", "\342\253\205"},
+    {"szlig", "\303\237"},
+    {"Rscr", "\342\204\233"},
+    {"beth", "\342\204\266"},
+    {"hstrok", "\304\247"},
+    {"gtlPar", "\342\246\225"},
+    {"measuredangle", "\342\210\241"},
+    {"cuesc", "\342\213\237"},
+    {"mDDot", "\342\210\272"},
+    {"sup", "\342\212\203"},
+    {"GreaterGreater", "\342\252\242"},
+    {"rtri", "\342\226\271"},
+    {"sdote", "\342\251\246"},
+    {"oast", "\342\212\233"},
+    {"glE", "\342\252\222"},
+    {"IJlig", "\304\262"},
+    {"oint", "\342\210\256"},
+    {"leq", "\342\211\244"},
+    {"icirc", "\303\256"},
+    {"rpargt", "\342\246\224"},
+    {"lfloor", "\342\214\212"},
+    {"Hscr", "\342\204\213"},
+    {"acd", "\342\210\277"},
+    {"blacktriangleleft", "\342\227\202"},
+    {"Fcy", "\320\244"},
+    {"PartialD", "\342\210\202"},
+    {"Lcaron", "\304\275"},
+    {"fflig", "\357\254\200"},
+    {"NotGreaterFullEqual", "\342\211\247\314\270"},
+    {"Amacr", "\304\200"},
+    {"sfr", "\360\235\224\260"},
+    {"iuml", "\303\257"},
+    {"plustwo", "\342\250\247"},
+    {"apid", "\342\211\213"},
+    {"ffllig", "\357\254\204"},
+    {"homtht", "\342\210\273"},
+    {"vprop", "\342\210\235"},
+    {"gvnE", "\342\211\251\357\270\200"},
+    {"ngeqslant", "\342\251\276\314\270"},
+    {"afr", "\360\235\224\236"},
+    {"cylcty", "\342\214\255"},
+    {"boxUR", "\342\225\232"},
+    {"thksim", "\342\210\274"},
+    {"circlearrowright", "\342\206\273"},
+    {"nsqsube", "\342\213\242"},
+    {"sharp", "\342\231\257"},
+    {"doublebarwedge", "\342\214\206"},
+    {"LongLeftRightArrow", "\342\237\267"},
+    {"ecir", "\342\211\226"},
+    {"vscr", "\360\235\223\213"},
+    {"tcaron", "\305\245"},
+    {"subnE", "\342\253\213"},
+    {"cong", "\342\211\205"},
+    {"NotCupCap", "\342\211\255"},
+    {"bumpe", "\342\211\217"},
+    {"nvge", "\342\211\245\342\203\222"},
+    {"nsub", "\342\212\204"},
+    {"shy", "\302\255"},
+    {"DiacriticalDot", "\313\231"},
+    {"LowerLeftArrow", "\342\206\231"},
+    {"succneqq", "\342\252\266"},
+    {"lesdot", "\342\251\277"},
+    {"nleqq", "\342\211\246\314\270"},
+    {"boxhd", "\342\224\254"},
+    {"easter", "\342\251\256"},
+    {"lg", "\342\211\266"},
+    {"rbrace", "}"},
+    {"sup2", "\302\262"},
+    {"DZcy", "\320\217"},
+    {"RightDownTeeVector", "\342\245\235"},
+    {"nVdash", "\342\212\256"},
+    {"bbrktbrk", "\342\216\266"},
+    {"profsurf", "\342\214\223"},
+    {"uarr", "\342\206\221"},
+    {"CirclePlus", "\342\212\225"},
+    {"DiacriticalGrave", "`"},
+    {"lparlt", "\342\246\223"},
+    {"nsubE", "\342\253\205\314\270"},
+    {"nleftrightarrow", "\342\206\256"},
+    {"iquest", "\302\277"},
+    {"times", "\303\227"},
+    {"scap", "\342\252\270"},
+    {"rarr", "\342\206\222"},
+    {"ofr", "\360\235\224\254"},
+    {"Yfr", "\360\235\224\234"},
+    {"lsquo", "\342\200\230"},
+    {"DownRightTeeVector", "\342\245\237"},
+    {"hearts", "\342\231\245"},
+    {"cdot", "\304\213"},
+    {"SubsetEqual", "\342\212\206"},
+    {"puncsp", "\342\200\210"},
+    {"ordm", "\302\272"},
+    {"bottom", "\342\212\245"},
+    {"Lscr", "\342\204\222"},
+    {"OverBrace", "\342\217\236"},
+    {"Bernoullis", "\342\204\254"},
+    {"varsigma", "\317\202"},
+    {"succsim", "\342\211\277"},
+    {"Proportional", "\342\210\235"},
+    {"parsl", "\342\253\275"},
+    {"kappa", "\316\272"},
+    {"rtimes", "\342\213\212"},
+    {"Darr", "\342\206\241"},
+    {"blk12", "\342\226\222"},
+    {"Upsi", "\317\222"},
+    {"pr", "\342\211\272"},
+    {"gesdot", "\342\252\200"},
+    {"InvisibleTimes", "\342\201\242"},
+    {"Cayleys", "\342\204\255"},
+    {"wcirc", "\305\265"},
+    {"lrarr", "\342\207\206"},
+    {"lang", "\342\237\250"},
+    {"NotRightTriangleEqual", "\342\213\255"},
+    {"lozenge", "\342\227\212"},
+    {"ltrif", "\342\227\202"},
+    {"Nopf", "\342\204\225"},
+    {"imof", "\342\212\267"},
+    {"ldquor", "\342\200\236"},
+    {"ecolon", "\342\211\225"},
+    {"supdot", "\342\252\276"},
+    {"isinv", "\342\210\210"},
+    {"Kopf", "\360\235\225\202"},
+    {"GreaterTilde", "\342\211\263"},
+    {"dopf", "\360\235\225\225"},
+    {"ldca", "\342\244\266"},
+    {"eDDot", "\342\251\267"},
+    {"MediumSpace", "\342\201\237"},
+    {"phiv", "\317\225"},
+    {"urcorner", "\342\214\235"},
+    {"copysr", "\342\204\227"},
+    {"Lacute", "\304\271"},
+    {"boxUl", "\342\225\234"},
+    {"Rfr", "\342\204\234"},
+    {"MinusPlus", "\342\210\223"},
+    {"bkarow", "\342\244\215"},
+    {"smeparsl", "\342\247\244"},
+    {"Oacute", "\303\223"},
+    {"cupcap", "\342\251\206"},
+    {"boxhU", "\342\225\250"},
+    {"rAarr", "\342\207\233"},
+    {"boxVr", "\342\225\237"},
+    {"TildeTilde", "\342\211\210"},
+    {"Jfr", "\360\235\224\215"},
+    {"tridot", "\342\227\254"},
+    {"vartriangleleft", "\342\212\262"},
+    {"HARDcy", "\320\252"},
+    {"scE", "\342\252\264"},
+    {"rarrfs", "\342\244\236"},
+    {"angmsd", "\342\210\241"},
+    {"check", "\342\234\223"},
+    {"Oopf", "\360\235\225\206"},
+    {"Uacute", "\303\232"},
+    {"xcirc", "\342\227\257"},
+    {"gt", ">"},
+    {"nlarr", "\342\206\232"},
+    {"hellip", "\342\200\246"},
+    {"odash", "\342\212\235"},
+    {"duhar", "\342\245\257"},
+    {"squf", "\342\226\252"},
+    {"capcup", "\342\251\207"},
+    {"rbrkslu", "\342\246\220"},
+    {"trianglelefteq", "\342\212\264"},
+    {"CircleMinus", "\342\212\226"},
+    {"Therefore", "\342\210\264"},
+    {"Ocirc", "\303\224"},
+    {"otilde", "\303\265"},
+    {"fjlig", "fj"},
+    {"NotGreaterEqual", "\342\211\261"},
+    {"uwangle", "\342\246\247"},
+    {"tritime", "\342\250\273"},
+    {"HumpEqual", "\342\211\217"},
+    {"drcrop", "\342\214\214"},
+    {"QUOT", "\042"},
+    {"boxDL", "\342\225\227"},
+    {"RightDownVector", "\342\207\202"},
+    {"vsupne", "\342\212\213\357\270\200"},
+    {"Poincareplane", "\342\204\214"},
+    {"mcomma", "\342\250\251"},
+    {"wr", "\342\211\200"},
+    {"Egrave", "\303\210"},
+    {"xotime", "\342\250\202"},
+    {"RightCeiling", "\342\214\211"},
+    {"nmid", "\342\210\244"},
+    {"ltdot", "\342\213\226"},
+    {"Acy", "\320\220"},
+    {"rarrap", "\342\245\265"},
+    {"zigrarr", "\342\207\235"},
+    {"ltri", "\342\227\203"},
+    {"backsim", "\342\210\275"},
+    {"nles", "\342\251\275\314\270"},
+    {"zfr", "\360\235\224\267"},
+    {"Iukcy", "\320\206"},
+    {"lbbrk", "\342\235\262"},
+    {"notinvb", "\342\213\267"},
+    {"int", "\342\210\253"},
+    {"simgE", "\342\252\240"},
+    {"rlarr", "\342\207\204"},
+    {"LeftRightVector", "\342\245\216"},
+    {"otimes", "\342\212\227"},
+    {"boxbox", "\342\247\211"},
+    {"Zeta", "\316\226"},
+    {"ncedil", "\305\206"},
+    {"lcaron", "\304\276"},
+    {"nearhk", "\342\244\244"},
+    {"ctdot", "\342\213\257"},
+    {"vsupnE", "\342\253\214\357\270\200"},
+    {"swarr", "\342\206\231"},
+    {"SquareIntersection", "\342\212\223"},
+    {"angrtvb", "\342\212\276"},
+    {"xwedge", "\342\213\200"},
+    {"rtrif", "\342\226\270"},
+    {"utrif", "\342\226\264"},
+    {"Sfr", "\360\235\224\226"},
+    {"not", "\302\254"},
+    {"Ubreve", "\305\254"},
+    {"nvap", "\342\211\215\342\203\222"},
+    {"ngeq", "\342\211\261"},
+    {"NestedGreaterGreater", "\342\211\253"},
+    {"DoubleLongRightArrow", "\342\237\271"},
+    {"nGt", "\342\211\253\342\203\222"},
+    {"nge", "\342\211\261"},
+    {"fllig", "\357\254\202"},
+    {"DoubleLeftArrow", "\342\207\220"},
+    {"GJcy", "\320\203"},
+    {"lrcorner", "\342\214\237"},
+    {"rsquo", "\342\200\231"},
+    {"nsubseteqq", "\342\253\205\314\270"},
+    {"sqcaps", "\342\212\223\357\270\200"},
+    {"shortparallel", "\342\210\245"},
+    {"ShortLeftArrow", "\342\206\220"},
+    {"scaron", "\305\241"},
+    {"Sc", "\342\252\274"},
+    {"boxVH", "\342\225\254"},
+    {"uscr", "\360\235\223\212"},
+    {"ccaron", "\304\215"},
+    {"NotExists", "\342\210\204"},
+    {"vfr", "\360\235\224\263"},
+    {"wreath", "\342\211\200"},
+    {"commat", "@"},
+    {"ii", "\342\205\210"},
+    {"LeftArrowBar", "\342\207\244"},
+    {"phi", "\317\206"},
+    {"Lopf", "\360\235\225\203"},
+    {"Efr", "\360\235\224\210"},
+    {"twixt", "\342\211\254"},
+    {"angmsdab", "\342\246\251"},
+    {"mapstodown", "\342\206\247"},
+    {"vsubne", "\342\212\212\357\270\200"},
+    {"Ncy", "\320\235"},
+    {"OverParenthesis", "\342\217\234"},
+    {"Ropf", "\342\204\235"},
+    {"boxvL", "\342\225\241"},
+    {"ntilde", "\303\261"},
+    {"delta", "\316\264"},
+    {"YUcy", "\320\256"},
+    {"Dot", "\302\250"},
+    {"THORN", "\303\236"},
+    {"cwconint", "\342\210\262"},
+    {"omicron", "\316\277"},
+    {"reg", "\302\256"},
+    {"Dcy", "\320\224"},
+    {"nsucc", "\342\212\201"},
+    {"Bfr", "\360\235\224\205"},
+    {"verbar", "|"},
+    {"Escr", "\342\204\260"},
+    {"hscr", "\360\235\222\275"},
+    {"Rarrtl", "\342\244\226"},
+    {"ycirc", "\305\267"},
+    {"nsupseteqq", "\342\253\206\314\270"},
+    {"Uopf", "\360\235\225\214"},
+    {"swarhk", "\342\244\246"},
+    {"leftrightharpoons", "\342\207\213"},
+    {"YAcy", "\320\257"},
+    {"Sacute", "\305\232"},
+    {"lneqq", "\342\211\250"},
+    {"circledcirc", "\342\212\232"},
+    {"UpDownArrow", "\342\206\225"},
+    {"cacute", "\304\207"},
+    {"leftrightarrows", "\342\207\206"},
+    {"top", "\342\212\244"},
+    {"larrtl", "\342\206\242"},
+    {"isinE", "\342\213\271"},
+    {"iiint", "\342\210\255"},
+    {"sce", "\342\252\260"},
+    {"yfr", "\360\235\224\266"},
+    {"varrho", "\317\261"},
+    {"nLeftrightarrow", "\342\207\216"},
+    {"supseteq", "\342\212\207"},
+    {"Sum", "\342\210\221"},
+    {"CloseCurlyDoubleQuote", "\342\200\235"},
+    {"zcy", "\320\267"},
+    {"angmsdad", "\342\246\253"},
+    {"Rrightarrow", "\342\207\233"},
+    {"Jscr", "\360\235\222\245"},
+    {"complexes", "\342\204\202"},
+    {"nltrie", "\342\213\254"},
+    {"hcirc", "\304\245"},
+    {"map", "\342\206\246"},
+    {"mapsto", "\342\206\246"},
+    {"Ntilde", "\303\221"},
+    {"downharpoonleft", "\342\207\203"},
+    {"gcirc", "\304\235"},
+    {"Alpha", "\316\221"},
+    {"NegativeThinSpace", "\342\200\213"},
+    {"Ofr", "\360\235\224\222"},
+    {"Lambda", "\316\233"},
+    {"Conint", "\342\210\257"},
+    {"Gamma", "\316\223"},
+    {"duarr", "\342\207\265"},
+    {"RightUpVectorBar", "\342\245\224"},
+    {"kfr", "\360\235\224\250"},
+    {"iocy", "\321\221"},
+    {"rarrbfs", "\342\244\240"},
+    {"solb", "\342\247\204"},
+    {"Gt", "\342\211\253"},
+    {"urtri", "\342\227\271"},
+    {"rightarrowtail", "\342\206\243"},
+    {"nshortparallel", "\342\210\246"},
+    {"Gg", "\342\213\231"},
+    {"hairsp", "\342\200\212"},
+    {"para", "\302\266"},
+    {"uArr", "\342\207\221"},
+    {"Tau", "\316\244"},
+    {"ntrianglelefteq", "\342\213\254"},
+    {"ReverseUpEquilibrium", "\342\245\257"},
+    {"leftarrow", "\342\206\220"},
+    {"looparrowleft", "\342\206\253"},
+    {"Phi", "\316\246"},
+    {"rx", "\342\204\236"},
+    {"Omacr", "\305\214"},
+    {"Mopf", "\360\235\225\204"},
+    {"circledR", "\302\256"},
+    {"bump", "\342\211\216"},
+    {"cupdot", "\342\212\215"},
+    {"Agrave", "\303\200"},
+    {"NotLeftTriangleBar", "\342\247\217\314\270"},
+    {"mapstoup", "\342\206\245"},
+    {"daleth", "\342\204\270"},
+    {"NotEqualTilde", "\342\211\202\314\270"},
+    {"lesges", "\342\252\223"},
+    {"uplus", "\342\212\216"},
+    {"LT", "<"},
+    {"dagger", "\342\200\240"},
+    {"gg", "\342\211\253"},
+    {"boxUL", "\342\225\235"},
+    {"isins", "\342\213\264"},
+    {"mapstoleft", "\342\206\244"},
+    {"frac25", "\342\205\226"},
+    {"Bscr", "\342\204\254"},
+    {"Vdash", "\342\212\251"},
+    {"aacute", "\303\241"},
+    {"smile", "\342\214\243"},
+    {"models", "\342\212\247"},
+    {"jcirc", "\304\265"},
+    {"triangleleft", "\342\227\203"},
+    {"ratail", "\342\244\232"},
+    {"ldrdhar", "\342\245\247"},
+    {"infin", "\342\210\236"},
+    {"precsim", "\342\211\276"},
+    {"DoubleLeftTee", "\342\253\244"},
+    {"NotSquareSupersetEqual", "\342\213\243"},
+    {"leftleftarrows", "\342\207\207"},
+    {"nleqslant", "\342\251\275\314\270"},
+    {"GT", ">"},
+    {"solbar", "\342\214\277"},
+    {"fnof", "\306\222"},
+    {"Lleftarrow", "\342\207\232"},
+    {"lbrace", "{"},
+    {"hookleftarrow", "\342\206\251"},
+    {"kjcy", "\321\234"},
+    {"rtrie", "\342\212\265"},
+    {"lessdot", "\342\213\226"},
+    {"ncup", "\342\251\202"},
+    {"imped", "\306\265"},
+    {"GreaterLess", "\342\211\267"},
+    {"gnE", "\342\211\251"},
+    {"dharr", "\342\207\202"},
+    {"SucceedsEqual", "\342\252\260"},
+    {"lobrk", "\342\237\246"},
+    {"timesbar", "\342\250\261"},
+    {"smtes", "\342\252\254\357\270\200"},
+    {"downarrow", "\342\206\223"},
+    {"capcap", "\342\251\213"},
+    {"zwj", "\342\200\215"},
+    {"Tcaron", "\305\244"},
+    {"SucceedsSlantEqual", "\342\211\275"},
+    {"Hfr", "\342\204\214"},
+    {"kcy", "\320\272"},
+    {"xuplus", "\342\250\204"},
+    {"fcy", "\321\204"},
+    {"xhArr", "\342\237\272"},
+    {"cupcup", "\342\251\212"},
+    {"curarr", "\342\206\267"},
+    {"NotHumpEqual", "\342\211\217\314\270"},
+    {"gsiml", "\342\252\220"},
+    {"nldr", "\342\200\245"},
+    {"ffilig", "\357\254\203"},
+    {"oopf", "\360\235\225\240"},
+    {"scy", "\321\201"},
+    {"kscr", "\360\235\223\200"},
+    {"nsup", "\342\212\205"},
+    {"DownTee", "\342\212\244"},
+    {"fork", "\342\213\224"},
+    {"Assign", "\342\211\224"},
+    {"leftrightarrow", "\342\206\224"},
+    {"NotEqual", "\342\211\240"},
+    {"sqsubset", "\342\212\217"},
+    {"male", "\342\231\202"},
+    {"NotSquareSubsetEqual", "\342\213\242"},
+    {"nequiv", "\342\211\242"},
+    {"lmidot", "\305\200"},
+    {"iukcy", "\321\226"},
+    {"SHcy", "\320\250"},
+    {"xrarr", "\342\237\266"},
+    {"khcy", "\321\205"},
+    {"gtrdot", "\342\213\227"},
+    {"iecy", "\320\265"},
+    {"bsemi", "\342\201\217"},
+    {"nearr", "\342\206\227"},
+    {"dlcorn", "\342\214\236"},
+    {"lat", "\342\252\253"},
+    {"xnis", "\342\213\273"},
+    {"curlyeqprec", "\342\213\236"},
+    {"ngt", "\342\211\257"},
+    {"boxDR", "\342\225\224"},
+    {"drcorn", "\342\214\237"},
+    {"kgreen", "\304\270"},
+    {"GreaterEqual", "\342\211\245"},
+    {"Lmidot", "\304\277"},
+    {"zcaron", "\305\276"},
+    {"TripleDot", "\342\203\233"},
+    {"intlarhk", "\342\250\227"},
+    {"sbquo", "\342\200\232"},
+    {"lEg", "\342\252\213"},
+    {"nsubseteq", "\342\212\210"},
+    {"barwed", "\342\214\205"},
+    {"esim", "\342\211\202"},
+    {"boxdR", "\342\225\222"},
+    {"oscr", "\342\204\264"},
+    {"cfr", "\360\235\224\240"},
+    {"larrpl", "\342\244\271"},
+    {"nshortmid", "\342\210\244"},
+    {"gtrarr", "\342\245\270"},
+    {"varpi", "\317\226"},
+    {"demptyv", "\342\246\261"},
+    {"Umacr", "\305\252"},
+    {"Odblac", "\305\220"},
+    {"cupbrcap", "\342\251\210"},
+    {"curlyvee", "\342\213\216"},
+    {"Vvdash", "\342\212\252"},
+    {"bowtie", "\342\213\210"},
+    {"nLeftarrow", "\342\207\215"},
+    {"Nu", "\316\235"},
+    {"umacr", "\305\253"},
+    {"larrfs", "\342\244\235"},
+    {"Auml", "\303\204"},
+    {"Gdot", "\304\240"},
+    {"bigcap", "\342\213\202"},
+    {"NotSuperset", "\342\212\203\342\203\222"},
+    {"suphsub", "\342\253\227"},
+    {"NegativeVeryThinSpace", "\342\200\213"},
+    {"Vscr", "\360\235\222\261"},
+    {"wedge", "\342\210\247"},
+    {"DiacriticalAcute", "\302\264"},
+    {"succapprox", "\342\252\270"},
+    {"exist", "\342\210\203"},
+    {"acute", "\302\264"},
+    {"cudarrl", "\342\244\270"},
+    {"NegativeThickSpace", "\342\200\213"},
+    {"emsp", "\342\200\203"},
+    {"DownArrowUpArrow", "\342\207\265"},
+    {"Chi", "\316\247"},
+    {"omid", "\342\246\266"},
+    {"veeeq", "\342\211\232"},
+    {"awint", "\342\250\221"},
+    {"larr", "\342\206\220"},
+    {"gtcc", "\342\252\247"},
+    {"bigodot", "\342\250\200"},
+    {"xsqcup", "\342\250\206"},
+    {"cirfnint", "\342\250\220"},
+    {"ocir", "\342\212\232"},
+    {"sqsup", "\342\212\220"},
+    {"div", "\303\267"},
+    {"prnsim", "\342\213\250"},
+    {"trpezium", "\342\217\242"},
+    {"notni", "\342\210\214"},
+    {"curarrm", "\342\244\274"},
+    {"Ascr", "\360\235\222\234"},
+    {"el", "\342\252\231"},
+    {"dscy", "\321\225"},
+    {"nspar", "\342\210\246"},
+    {"jukcy", "\321\224"},
+    {"lrm", "\342\200\216"},
+    {"rdca", "\342\244\267"},
+    {"oacute", "\303\263"},
+    {"ang", "\342\210\240"},
+    {"nsupset", "\342\212\203\342\203\222"},
+    {"circledast", "\342\212\233"},
+    {"simdot", "\342\251\252"},
+    {"veebar", "\342\212\273"},
+    {"ni", "\342\210\213"},
+    {"divonx", "\342\213\207"},
+    {"ropar", "\342\246\206"},
+    {"nang", "\342\210\240\342\203\222"},
+    {"rsaquo", "\342\200\272"},
+    {"lcy", "\320\273"},
+    {"nsube", "\342\212\210"},
+    {"infintie", "\342\247\235"},
+    {"boxHD", "\342\225\246"},
+    {"olarr", "\342\206\272"},
+    {"part", "\342\210\202"},
+    {"epsiv", "\317\265"},
+    {"LeftCeiling", "\342\214\210"},
+    {"gne", "\342\252\210"},
+    {"sdot", "\342\213\205"},
+    {"LeftTeeVector", "\342\245\232"},
+    {"period", "."},
+    {"VerticalBar", "\342\210\243"},
+    {"Beta", "\316\222"},
+    {"multimap", "\342\212\270"},
+    {"DoubleLongLeftArrow", "\342\237\270"},
+    {"Scy", "\320\241"},
+    {"nharr", "\342\206\256"},
+    {"bnot", "\342\214\220"},
+    {"ThinSpace", "\342\200\211"},
+    {"trisb", "\342\247\215"},
+    {"boxhD", "\342\225\245"},
+    {"Kcedil", "\304\266"},
+    {"rpar", ")"},
+    {"comma", ","},
+    {"tbrk", "\342\216\264"},
+    {"caron", "\313\207"},
+    {"iiota", "\342\204\251"},
+    {"longleftrightarrow", "\342\237\267"},
+    {"LeftDownVectorBar", "\342\245\231"},
+    {"Ucy", "\320\243"},
+    {"ufisht", "\342\245\276"},
+    {"forkv", "\342\253\231"},
+    {"ltquest", "\342\251\273"},
+    {"RightVectorBar", "\342\245\223"},
+    {"nGtv", "\342\211\253\314\270"},
+    {"horbar", "\342\200\225"},
+    {"isinsv", "\342\213\263"},
+    {"gimel", "\342\204\267"},
+    {"cscr", "\360\235\222\270"},
+    {"ccirc", "\304\211"},
+    {"NotLessLess", "\342\211\252\314\270"},
+    {"LeftTriangleBar", "\342\247\217"},
+    {"Tcedil", "\305\242"},
+    {"Vbar", "\342\253\253"},
+    {"angmsdae", "\342\246\254"},
+    {"Cdot", "\304\212"},
+    {"supdsub", "\342\253\230"},
+    {"gescc", "\342\252\251"},
+    {"varpropto", "\342\210\235"},
+    {"LeftUpTeeVector", "\342\245\240"},
+    {"nvgt", ">\342\203\222"},
+    {"emptyv", "\342\210\205"},
+    {"intercal", "\342\212\272"},
+    {"simg", "\342\252\236"},
+    {"eqcolon", "\342\211\225"},
+    {"gdot", "\304\241"},
+    {"nltri", "\342\213\252"},
+    {"napid", "\342\211\213\314\270"},
+    {"LJcy", "\320\211"},
+    {"nvrArr", "\342\244\203"},
+    {"nsc", "\342\212\201"},
+    {"efr", "\360\235\224\242"},
+    {"emptyset", "\342\210\205"},
+    {"UnderBar", "_"},
+    {"boxdr", "\342\224\214"},
+    {"thkap", "\342\211\210"},
+    {"NegativeMediumSpace", "\342\200\213"},
+    {"eogon", "\304\231"},
+    {"PrecedesTilde", "\342\211\276"},
+    {"cudarrr", "\342\244\265"},
+    {"loplus", "\342\250\255"},
+    {"nvdash", "\342\212\254"},
+    {"cularrp", "\342\244\275"},
+    {"DoubleDownArrow", "\342\207\223"},
+    {"ogon", "\313\233"},
+    {"hamilt", "\342\204\213"},
+    {"Cscr", "\360\235\222\236"},
+    {"Bopf", "\360\235\224\271"},
+    {"nrtrie", "\342\213\255"},
+    {"ShortUpArrow", "\342\206\221"},
+    {"deg", "\302\260"},
+    {"chcy", "\321\207"},
+    {"nhpar", "\342\253\262"},
+    {"precnsim", "\342\213\250"},
+    {"dstrok", "\304\221"},
+    {"dbkarow", "\342\244\217"},
+    {"raquo", "\302\273"},
+    {"ohbar", "\342\246\265"},
+    {"gcy", "\320\263"},
+    {"clubsuit", "\342\231\243"},
+    {"rect", "\342\226\255"},
+    {"suplarr", "\342\245\273"},
+    {"racute", "\305\225"},
+    {"ndash", "\342\200\223"},
+    {"diamondsuit", "\342\231\246"},
+    {"Pi", "\316\240"},
+    {"UpTee", "\342\212\245"},
+    {"csupe", "\342\253\222"},
+    {"thickapprox", "\342\211\210"},
+    {"fltns", "\342\226\261"},
+    {"Uarr", "\342\206\237"},
+    {"vartheta", "\317\221"},
+    {"conint", "\342\210\256"},
+    {"harrw", "\342\206\255"},
+    {"RightTee", "\342\212\242"},
+    {"eqslantgtr", "\342\252\226"},
+    {"Diamond", "\342\213\204"},
+    {"Vopf", "\360\235\225\215"},
+    {"Dcaron", "\304\216"},
+    {"eqslantless", "\342\252\225"},
+    {"varsupsetneq", "\342\212\213\357\270\200"},
+    {"zdot", "\305\274"},
+    {"flat", "\342\231\255"},
+    {"Omega", "\316\251"},
+    {"cap", "\342\210\251"},
+    {"Uscr", "\360\235\222\260"},
+    {"Xscr", "\360\235\222\263"},
+    {"tprime", "\342\200\264"},
+    {"DownLeftRightVector", "\342\245\220"},
+    {"sol", "/"},
+    {"bigcup", "\342\213\203"},
+    {"InvisibleComma", "\342\201\243"},
+    {"longleftarrow", "\342\237\265"},
+    {"natur", "\342\231\256"},
+    {"plussim", "\342\250\246"},
+    {"andd", "\342\251\234"},
+    {"PrecedesEqual", "\342\252\257"},
+    {"cirscir", "\342\247\202"},
+    {"iiiint", "\342\250\214"},
+    {"wfr", "\360\235\224\264"},
+    {"sext", "\342\234\266"},
+    {"xcup", "\342\213\203"},
+    {"rarrsim", "\342\245\264"},
+    {"triangleright", "\342\226\271"},
+    {"ltimes", "\342\213\211"},
+    {"centerdot", "\302\267"},
+    {"cedil", "\302\270"},
+    {"FilledVerySmallSquare", "\342\226\252"},
+    {"sup1", "\302\271"},
+    {"NotTilde", "\342\211\201"},
+    {"angsph", "\342\210\242"},
+    {"zacute", "\305\272"},
+    {"DoubleLeftRightArrow", "\342\207\224"},
+    {"rightarrow", "\342\206\222"},
+    {"qfr", "\360\235\224\256"},
+    {"OElig", "\305\222"},
+    {"Abreve", "\304\202"},
+    {"ccupssm", "\342\251\220"},
+    {"NotNestedLessLess", "\342\252\241\314\270"},
+    {"gfr", "\360\235\224\244"},
+    {"CupCap", "\342\211\215"},
+    {"nvsim", "\342\210\274\342\203\222"},
+    {"gtrapprox", "\342\252\206"},
+    {"notindot", "\342\213\265\314\270"},
+    {"Emacr", "\304\222"},
+    {"minusd", "\342\210\270"},
+    {"sup3", "\302\263"},
+    {"Tscr", "\360\235\222\257"},
+    {"epar", "\342\213\225"},
+    {"Hacek", "\313\207"},
+    {"notinvc", "\342\213\266"},
+    {"gvertneqq", "\342\211\251\357\270\200"},
+    {"nvDash", "\342\212\255"},
+    {"circlearrowleft", "\342\206\272"},
+    {"utilde", "\305\251"},
+    {"orarr", "\342\206\273"},
+    {"LongLeftArrow", "\342\237\265"},
+    {"sstarf", "\342\213\206"},
+    {"Theta", "\316\230"},
+    {"lArr", "\342\207\220"},
+    {"prec", "\342\211\272"},
+    {"NotGreaterGreater", "\342\211\253\314\270"},
+    {"triminus", "\342\250\272"},
+    {"amalg", "\342\250\277"},
+    {"wedbar", "\342\251\237"},
+    {"iexcl", "\302\241"},
+    {"nprcue", "\342\213\240"},
+    {"mu", "\316\274"},
+    {"supmult", "\342\253\202"},
+    {"fopf", "\360\235\225\227"},
+    {"minus", "\342\210\222"},
+    {"NotSupersetEqual", "\342\212\211"},
+    {"lmoust", "\342\216\260"},
+    {"pcy", "\320\277"},
+    {"lsqb", "["},
+    {"erDot", "\342\211\223"},
+    {"ccups", "\342\251\214"},
+    {"bumpeq", "\342\211\217"},
+    {"GreaterFullEqual", "\342\211\247"},
+    {"tshcy", "\321\233"},
+    {"oline", "\342\200\276"},
+    {"hopf", "\360\235\225\231"},
+    {"upsih", "\317\222"},
+    {"ulcrop", "\342\214\217"},
+    {"exponentiale", "\342\205\207"},
+    {"dcy", "\320\264"},
+    {"cup", "\342\210\252"},
+    {"NotVerticalBar", "\342\210\244"},
+    {"filig", "\357\254\201"},
+    {"circledS", "\342\223\210"},
+    {"UnderParenthesis", "\342\217\235"},
+    {"semi", ";"},
+    {"DownLeftVectorBar", "\342\245\226"},
+    {"Colon", "\342\210\267"},
+    {"lbrke", "\342\246\213"},
+    {"ngsim", "\342\211\265"},
+    {"swnwar", "\342\244\252"},
+    {"bull", "\342\200\242"},
+    {"nbumpe", "\342\211\217\314\270"},
+    {"frac56", "\342\205\232"},
+    {"Dstrok", "\304\220"},
+    {"NotPrecedesEqual", "\342\252\257\314\270"},
+    {"subdot", "\342\252\275"},
+    {"trade", "\342\204\242"},
+    {"drbkarow", "\342\244\220"},
+    {"IOcy", "\320\201"},
+    {"edot", "\304\227"},
+    {"frac45", "\342\205\230"},
+    {"gtreqqless", "\342\252\214"},
+    {"Ncedil", "\305\205"},
+    {"rbrack", "]"},
+    {"rnmid", "\342\253\256"},
+    {"lbrkslu", "\342\246\215"},
+    {"dtri", "\342\226\277"},
+    {"DoubleLongLeftRightArrow", "\342\237\272"},
+    {"ge", "\342\211\245"},
+    {"par", "\342\210\245"},
+    {"UnionPlus", "\342\212\216"},
+    {"iota", "\316\271"},
+    {"intcal", "\342\212\272"},
+    {"plusdu", "\342\250\245"},
+    {"lcub", "{"},
+    {"mstpos", "\342\210\276"},
+    {"ntlg", "\342\211\270"},
+    {"Zfr", "\342\204\250"},
+    {"EmptySmallSquare", "\342\227\273"},
+    {"wp", "\342\204\230"},
+    {"upharpoonleft", "\342\206\277"},
+    {"ohm", "\316\251"},
+    {"varr", "\342\206\225"},
+    {"dtrif", "\342\226\276"},
+    {"lbarr", "\342\244\214"},
+    {"lscr", "\360\235\223\201"},
+    {"Coproduct", "\342\210\220"},
+    {"bemptyv", "\342\246\260"},
+    {"nearrow", "\342\206\227"},
+    {"rAtail", "\342\244\234"},
+    {"VeryThinSpace", "\342\200\212"},
+    {"ap", "\342\211\210"},
+    {"ltrPar", "\342\246\226"},
+    {"SquareSubsetEqual", "\342\212\221"},
+    {"harr", "\342\206\224"},
+    {"lhblk", "\342\226\204"},
+    {"larrb", "\342\207\244"},
+    {"npar", "\342\210\246"},
+    {"or", "\342\210\250"},
+    {"napprox", "\342\211\211"},
+    {"aring", "\303\245"},
+    {"lHar", "\342\245\242"},
+    {"eopf", "\360\235\225\226"},
+    {"gesl", "\342\213\233\357\270\200"},
+    {"lambda", "\316\273"},
+    {"awconint", "\342\210\263"},
+    {"Upsilon", "\316\245"},
+    {"rcaron", "\305\231"},
+    {"varphi", "\317\225"},
+    {"rdquo", "\342\200\235"},
+    {"Proportion", "\342\210\267"},
+    {"bbrk", "\342\216\265"},
+    {"Edot", "\304\226"},
+    {"icy", "\320\270"},
+    {"pre", "\342\252\257"},
+    {"angmsdag", "\342\246\256"},
+    {"rightleftharpoons", "\342\207\214"},
+    {"ldrushar", "\342\245\213"},
+    {"niv", "\342\210\213"},
+    {"nsucceq", "\342\252\260\314\270"},
+    {"lbrack", "["},
+    {"pertenk", "\342\200\261"},
+    {"SHCHcy", "\320\251"},
+    {"simeq", "\342\211\203"},
+    {"Nacute", "\305\203"},
+    {"vnsup", "\342\212\203\342\203\222"},
+    {"blacktriangledown", "\342\226\276"},
+    {"rightharpoondown", "\342\207\201"},
+    {"vDash", "\342\212\250"},
+    {"fscr", "\360\235\222\273"},
+    {"Iota", "\316\231"},
+    {"lE", "\342\211\246"},
+    {"excl", "!"},
+    {"female", "\342\231\200"},
+    {"Longrightarrow", "\342\237\271"},
+    {"DotDot", "\342\203\234"},
+    {"Sub", "\342\213\220"},
+    {"nis", "\342\213\274"},
+    {"nsqsupe", "\342\213\243"},
+    {"ange", "\342\246\244"},
+    {"leg", "\342\213\232"},
+    {"supsup", "\342\253\226"},
+    {"subrarr", "\342\245\271"},
+    {"larrsim", "\342\245\263"},
+    {"ContourIntegral", "\342\210\256"},
+    {"les", "\342\251\275"},
+    {"approx", "\342\211\210"},
+    {"npolint", "\342\250\224"},
+    {"RightArrow", "\342\206\222"},
+    {"late", "\342\252\255"},
+    {"squarf", "\342\226\252"},
+    {"DDotrahd", "\342\244\221"},
+    {"Ufr", "\360\235\224\230"},
+    {"Uparrow", "\342\207\221"},
+    {"bcong", "\342\211\214"},
+    {"andslope", "\342\251\230"},
+    {"epsi", "\316\265"},
+    {"sqcap", "\342\212\223"},
+    {"ClockwiseContourIntegral", "\342\210\262"},
+    {"Eogon", "\304\230"},
+    {"larrbfs", "\342\244\237"},
+    {"RightUpTeeVector", "\342\245\234"},
+    {"ccedil", "\303\247"},
+    {"bsime", "\342\213\215"},
+    {"bigvee", "\342\213\201"},
+    {"rhov", "\317\261"},
+    {"nbump", "\342\211\216\314\270"},
+    {"Cedilla", "\302\270"},
+    {"iscr", "\360\235\222\276"},
+    {"Ycy", "\320\253"},
+    {"gopf", "\360\235\225\230"},
+    {"nLt", "\342\211\252\342\203\222"},
+    {"Ll", "\342\213\230"},
+    {"sscr", "\360\235\223\210"},
+    {"Integral", "\342\210\253"},
+    {"xlarr", "\342\237\265"},
+    {"orv", "\342\251\233"},
+    {"varnothing", "\342\210\205"},
+    {"frac12", "\302\275"},
+    {"rightsquigarrow", "\342\206\235"},
+    {"spades", "\342\231\240"},
+    {"bcy", "\320\261"},
+    {"RightArrowBar", "\342\207\245"},
+    {"Rsh", "\342\206\261"},
+    {"sqsube", "\342\212\221"},
+    {"checkmark", "\342\234\223"},
+    {"lsquor", "\342\200\232"},
+    {"succcurlyeq", "\342\211\275"},
+    {"Dscr", "\360\235\222\237"},
+    {"xutri", "\342\226\263"},
+    {"circ", "\313\206"},
+    {"dArr", "\342\207\223"},
+    {"minusb", "\342\212\237"},
+    {"ape", "\342\211\212"},
+    {"NotSubsetEqual", "\342\212\210"},
+    {"eplus", "\342\251\261"},
+    {"Mellintrf", "\342\204\263"},
+    {"bigstar", "\342\230\205"},
+    {"elsdot", "\342\252\227"},
+    {"Zcaron", "\305\275"},
+    {"supedot", "\342\253\204"},
+    {"Lsh", "\342\206\260"},
+    {"lesssim", "\342\211\262"},
+    {"hyphen", "\342\200\220"},
+    {"loang", "\342\237\254"},
+    {"UpArrow", "\342\206\221"},
+    {"Dfr", "\360\235\224\207"},
+    {"topf", "\360\235\225\245"},
+    {"prime", "\342\200\262"},
+    {"empty", "\342\210\205"},
+    {"vBarv", "\342\253\251"},
+    {"Or", "\342\251\224"},
+    {"Yacute", "\303\235"},
+    {"Iacute", "\303\215"},
+    {"egsdot", "\342\252\230"},
+    {"Longleftrightarrow", "\342\237\272"},
+    {"reals", "\342\204\235"},
+    {"frasl", "\342\201\204"},
+    {"eng", "\305\213"},
+    {"COPY", "\302\251"},
+    {"Esim", "\342\251\263"},
+    {"lneq", "\342\252\207"},
+    {"Mscr", "\342\204\263"},
+    {"ecirc", "\303\252"},
+    {"efDot", "\342\211\222"},
+    {"dotplus", "\342\210\224"},
+    {"phone", "\342\230\216"},
+    {"uuml", "\303\274"},
+    {"glj", "\342\252\244"},
+    {"Fopf", "\360\235\224\275"},
+    {"hkswarow", "\342\244\246"},
+    {"integers", "\342\204\244"},
+    {"ltrie", "\342\212\264"},
+    {"pm", "\302\261"},
+    {"xi", "\316\276"},
+    {"lltri", "\342\227\272"},
+    {"prurel", "\342\212\260"},
+    {"andv", "\342\251\232"},
+    {"boxV", "\342\225\221"},
+    {"eth", "\303\260"},
+    {"ecaron", "\304\233"},
+    {"rarrc", "\342\244\263"},
+    {"hardcy", "\321\212"},
+    {"twoheadleftarrow", "\342\206\236"},
+    {"ThickSpace", "\342\201\237\342\200\212"},
+    {"shcy", "\321\210"},
+    {"bnequiv", "\342\211\241\342\203\245"},
+    {"lstrok", "\305\202"},
+    {"Yuml", "\305\270"},
+    {"congdot", "\342\251\255"},
+    {"uuarr", "\342\207\210"},
+    {"boxVL", "\342\225\243"},
+    {"simne", "\342\211\206"},
+    {"lopf", "\360\235\225\235"},
+    {"Utilde", "\305\250"},
+    {"CenterDot", "\302\267"},
+    {"RightTriangleEqual", "\342\212\265"},
+    {"SquareUnion", "\342\212\224"},
+    {"subset", "\342\212\202"},
+    {"equivDD", "\342\251\270"},
+    {"expectation", "\342\204\260"},
+    {"uopf", "\360\235\225\246"},
+    {"aleph", "\342\204\265"},
+    {"nexist", "\342\210\204"},
+    {"nwarr", "\342\206\226"},
+    {"apacir", "\342\251\257"},
+    {"sect", "\302\247"},
+    {"uacute", "\303\272"},
+    {"Star", "\342\213\206"},
+    {"realine", "\342\204\233"},
+    {"ncy", "\320\275"},
+    {"preccurlyeq", "\342\211\274"},
+    {"lsh", "\342\206\260"},
+    {"breve", "\313\230"},
+    {"Mu", "\316\234"},
+    {"ntriangleright", "\342\213\253"},
+    {"lacute", "\304\272"},
+    {"vartriangleright", "\342\212\263"},
+    {"dzigrarr", "\342\237\277"},
+    {"rharu", "\342\207\200"},
+    {"triangledown", "\342\226\277"},
+    {"LeftTriangleEqual", "\342\212\264"},
+    {"boxhu", "\342\224\264"},
+    {"piv", "\317\226"},
+    {"dlcrop", "\342\214\215"},
+    {"CircleTimes", "\342\212\227"},
+    {"rfloor", "\342\214\213"},
+    {"qprime", "\342\201\227"},
+    {"approxeq", "\342\211\212"},
+    {"forall", "\342\210\200"},
+    {"rho", "\317\201"},
+    {"NotLessSlantEqual", "\342\251\275\314\270"},
+    {"nexists", "\342\210\204"},
+    {"therefore", "\342\210\264"},
+    {"angmsdaa", "\342\246\250"},
+    {"nleq", "\342\211\260"},
+    {"thorn", "\303\276"},
+    {"thetasym", "\317\221"},
+    {"VerticalLine", "|"},
+    {"smid", "\342\210\243"},
+    {"Breve", "\313\230"},
+    {"Rho", "\316\241"},
+    {"cross", "\342\234\227"},
+    {"frown", "\342\214\242"},
+    {"longmapsto", "\342\237\274"},
+    {"ycy", "\321\213"},
+    {"ic", "\342\201\243"},
+    {"ufr", "\360\235\224\262"},
+    {"Lfr", "\360\235\224\217"},
+    {"DownLeftVector", "\342\206\275"},
+    {"diam", "\342\213\204"},
+    {"euml", "\303\253"},
+    {"Colone", "\342\251\264"},
+    {"rtriltri", "\342\247\216"},
+    {"TildeEqual", "\342\211\203"},
+    {"SquareSubset", "\342\212\217"},
+    {"siml", "\342\252\235"},
+    {"equiv", "\342\211\241"},
+    {"frac35", "\342\205\227"},
+    {"ggg", "\342\213\231"},
+    {"Euml", "\303\213"},
+    {"qint", "\342\250\214"},
+    {"plusacir", "\342\250\243"},
+    {"nvHarr", "\342\244\204"},
+    {"ssmile", "\342\214\243"},
+    {"osol", "\342\212\230"},
+    {"ee", "\342\205\207"},
+    {"precapprox", "\342\252\267"},
+    {"boxUr", "\342\225\231"},
+    {"NotNestedGreaterGreater", "\342\252\242\314\270"},
+    {"lthree", "\342\213\213"},
+    {"alefsym", "\342\204\265"},
+    {"straightepsilon", "\317\265"},
+    {"bfr", "\360\235\224\237"},
+    {"le", "\342\211\244"},
+    {"eg", "\342\252\232"},
+    {"tcedil", "\305\243"},
+    {"barwedge", "\342\214\205"},
+    {"dfr", "\360\235\224\241"},
+    {"ImaginaryI", "\342\205\210"},
+    {"Wedge", "\342\213\200"},
+    {"ecy", "\321\215"},
+    {"Equilibrium", "\342\207\214"},
+    {"supsetneqq", "\342\253\214"},
+    {"jscr", "\360\235\222\277"},
+    {"Union", "\342\213\203"},
+    {"imacr", "\304\253"},
+    {"Qscr", "\360\235\222\254"},
+    {"xmap", "\342\237\274"},
+    {"colon", ":"},
+    {"ngE", "\342\211\247\314\270"},
+    {"Int", "\342\210\254"},
+    {"scnap", "\342\252\272"},
+    {"kappav", "\317\260"},
+    {"becaus", "\342\210\265"},
+    {"RightTeeArrow", "\342\206\246"},
+    {"complement", "\342\210\201"},
+    {"NotPrecedes", "\342\212\200"},
+    {"RightVector", "\342\207\200"},
+    {"tilde", "\313\234"},
+    {"euro", "\342\202\254"},
+    {"Gfr", "\360\235\224\212"},
+    {"bopf", "\360\235\225\223"},
+    {"smt", "\342\252\252"},
+    {"iopf", "\360\235\225\232"},
+    {"topfork", "\342\253\232"},
+    {"eparsl", "\342\247\243"},
+    {"rightharpoonup", "\342\207\200"},
+    {"sdotb", "\342\212\241"},
+    {"succeq", "\342\252\260"},
+    {"dollar", "$"},
+    {"isin", "\342\210\210"},
+    {"comp", "\342\210\201"},
+    {"UpArrowBar", "\342\244\222"},
+    {"blacktriangleright", "\342\226\270"},
+    {"notnivc", "\342\213\275"},
+    {"odot", "\342\212\231"},
+    {"angrt", "\342\210\237"},
+    {"rmoustache", "\342\216\261"},
+    {"LowerRightArrow", "\342\206\230"},
+    {"copf", "\360\235\225\224"},
+    {"Dashv", "\342\253\244"},
+    {"lvnE", "\342\211\250\357\270\200"},
+    {"oslash", "\303\270"},
+    {"angmsdaf", "\342\246\255"},
+    {"caret", "\342\201\201"},
+    {"nwnear", "\342\244\247"},
+    {"darr", "\342\206\223"},
+    {"Cross", "\342\250\257"},
+    {"Gscr", "\360\235\222\242"},
+    {"loz", "\342\227\212"},
+    {"Ffr", "\360\235\224\211"},
+    {"smallsetminus", "\342\210\226"},
+    {"UpTeeArrow", "\342\206\245"},
+    {"nsmid", "\342\210\244"},
+    {"dscr", "\360\235\222\271"},
+    {"Ycirc", "\305\266"},
+    {"NotPrecedesSlantEqual", "\342\213\240"},
+    {"fallingdotseq", "\342\211\222"},
+    {"angst", "\303\205"},
+    {"Rcy", "\320\240"},
+    {"subsetneqq", "\342\253\213"},
+    {"scnsim", "\342\213\251"},
+    {"Sigma", "\316\243"},
+    {"trie", "\342\211\234"},
+    {"ijlig", "\304\263"},
+    {"rHar", "\342\245\244"},
+    {"Tab", "\011"},
+    {"VerticalTilde", "\342\211\200"},
+    {"RightDoubleBracket", "\342\237\247"},
+    {"rdquor", "\342\200\235"},
+    {"bigotimes", "\342\250\202"},
+    {"parsim", "\342\253\263"},
+    {"xopf", "\360\235\225\251"},
+    {"Mcy", "\320\234"},
+    {"leftharpoonup", "\342\206\274"},
+    {"DiacriticalDoubleAcute", "\313\235"},
+    {"Map", "\342\244\205"},
+    {"lfisht", "\342\245\274"},
+    {"risingdotseq", "\342\211\223"},
+    {"topcir", "\342\253\261"},
+    {"lhard", "\342\206\275"},
+    {"nparallel", "\342\210\246"},
+    {"ocy", "\320\276"},
+    {"thinsp", "\342\200\211"},
+    {"Ncaron", "\305\207"},
+    {"NotDoubleVerticalBar", "\342\210\246"},
+    {"die", "\302\250"},
+    {"lozf", "\342\247\253"},
+    {"Dagger", "\342\200\241"},
+    {"LeftDoubleBracket", "\342\237\246"},
+    {"napE", "\342\251\260\314\270"},
+    {"rbrke", "\342\246\214"},
+    {"Idot", "\304\260"},
+    {"latail", "\342\244\231"},
+    {"LessSlantEqual", "\342\251\275"},
+    {"subsup", "\342\253\223"},
+    {"sqcups", "\342\212\224\357\270\200"},
+    {"lap", "\342\252\205"},
+    {"rdsh", "\342\206\263"},
+    {"hfr", "\360\235\224\245"},
+    {"between", "\342\211\254"},
+    {"straightphi", "\317\225"},
+    {"els", "\342\252\225"},
+    {"itilde", "\304\251"},
+    {"rscr", "\360\235\223\207"},
+    {"DownArrowBar", "\342\244\223"},
+    {"Cfr", "\342\204\255"},
+    {"mdash", "\342\200\224"},
+    {"hslash", "\342\204\217"},
+    {"equals", "="},
+    {"target", "\342\214\226"},
+    {"Sqrt", "\342\210\232"},
+    {"planckh", "\342\204\216"},
+    {"incare", "\342\204\205"},
+    {"nhArr", "\342\207\216"},
+    {"gneq", "\342\252\210"},
+    {"supsetneq", "\342\212\213"},
+    {"Zdot", "\305\273"},
+    {"disin", "\342\213\262"},
+    {"Lstrok", "\305\201"},
+    {"xscr", "\360\235\223\215"},
+    {"NotLeftTriangle", "\342\213\252"},
+    {"Jsercy", "\320\210"},
+    {"Scaron", "\305\240"},
+    {"DotEqual", "\342\211\220"},
+    {"lsim", "\342\211\262"},
+    {"hookrightarrow", "\342\206\252"},
+    {"prsim", "\342\211\276"},
+    {"lsaquo", "\342\200\271"},
+    {"micro", "\302\265"},
+    {"Congruent", "\342\211\241"},
+    {"nlArr", "\342\207\215"},
+    {"rsquor", "\342\200\231"},
+    {"vrtri", "\342\212\263"},
+    {"shchcy", "\321\211"},
+    {"rbarr", "\342\244\215"},
+    {"profline", "\342\214\222"},
+    {"sqcup", "\342\212\224"},
+    {"rarrlp", "\342\206\254"},
+    {"Uuml", "\303\234"},
+    {"uparrow", "\342\206\221"},
+    {"supseteqq", "\342\253\206"},
+    {"bsolhsub", "\342\237\210"},
+    {"bumpE", "\342\252\256"},
+    {"searrow", "\342\206\230"},
+    {"LeftArrowRightArrow", "\342\207\206"},
+    {"abreve", "\304\203"},
+    {"inodot", "\304\261"},
+    {"Leftrightarrow", "\342\207\224"},
+    {"rfr", "\360\235\224\257"},
+    {"ac", "\342\210\276"},
+    {"toea", "\342\244\250"},
+    {"cuepr", "\342\213\236"},
+    {"prnap", "\342\252\271"},
+    {"tstrok", "\305\247"},
+    {"lbrksld", "\342\246\217"},
+    {"prop", "\342\210\235"},
+    {"suphsol", "\342\237\211"},
+    {"RightTriangleBar", "\342\247\220"},
+    {"supplus", "\342\253\200"},
+    {"DownLeftTeeVector", "\342\245\236"},
+    {"digamma", "\317\235"},
+    {"ApplyFunction", "\342\201\241"},
+    {"yucy", "\321\216"},
+    {"sacute", "\305\233"},
+    {"brvbar", "\302\246"},
+    {"csube", "\342\253\221"},
+    {"sung", "\342\231\252"},
+    {"acirc", "\303\242"},
+    {"njcy", "\321\232"},
+    {"prod", "\342\210\217"},
+    {"lesseqqgtr", "\342\252\213"},
+    {"Cconint", "\342\210\260"},
+    {"compfn", "\342\210\230"},
+    {"isindot", "\342\213\265"},
+    {"numsp", "\342\200\207"},
+    {"yuml", "\303\277"},
+    {"sime", "\342\211\203"},
+    {"Equal", "\342\251\265"},
+    {"erarr", "\342\245\261"},
+    {"bernou", "\342\204\254"},
+    {"divideontimes", "\342\213\207"},
+    {"Yopf", "\360\235\225\220"},
+    {"sqsubseteq", "\342\212\221"},
+    {"cir", "\342\227\213"},
+    {"xharr", "\342\237\267"},
+    {"yopf", "\360\235\225\252"},
+    {"Sup", "\342\213\221"},
+    {"pointint", "\342\250\225"},
+    {"RightTriangle", "\342\212\263"},
+    {"dotminus", "\342\210\270"},
+    {"radic", "\342\210\232"},
+    {"ring", "\313\232"},
+    {"pi", "\317\200"},
+    {"marker", "\342\226\256"},
+    {"operp", "\342\246\271"},
+    {"boxVh", "\342\225\253"},
+    {"lharu", "\342\206\274"},
+    {"ord", "\342\251\235"},
+    {"LessLess", "\342\252\241"},
+    {"LeftVectorBar", "\342\245\222"},
+    {"Im", "\342\204\221"},
+    {"tdot", "\342\203\233"},
+    {"larrhk", "\342\206\251"},
+    {"nparsl", "\342\253\275\342\203\245"},
+    {"tscy", "\321\206"},
+    {"mlcp", "\342\253\233"},
+    {"nrarrc", "\342\244\263\314\270"},
+    {"auml", "\303\244"},
+    {"kcedil", "\304\267"},
+    {"zeetrf", "\342\204\250"},
+    {"boxuL", "\342\225\233"},
+    {"ovbar", "\342\214\275"},
+    {"angmsdac", "\342\246\252"},
+    {"npart", "\342\210\202\314\270"},
+    {"setminus", "\342\210\226"},
+    {"nsime", "\342\211\204"},
+    {"lharul", "\342\245\252"},
+    {"gtrless", "\342\211\267"},
+    {"dblac", "\313\235"},
+    {"geqslant", "\342\251\276"},
+    {"LessEqualGreater", "\342\213\232"},
+    {"nfr", "\360\235\224\253"},
+    {"blacklozenge", "\342\247\253"},
+    {"wopf", "\360\235\225\250"},
+    {"gamma", "\316\263"},
+    {"vsubnE", "\342\253\213\357\270\200"},
+    {"NotSquareSuperset", "\342\212\220\314\270"},
+    {"gtreqless", "\342\213\233"},
+    {"UnderBrace", "\342\217\237"},
+    {"pluscir", "\342\250\242"},
+    {"sopf", "\360\235\225\244"},
+    {"lessgtr", "\342\211\266"},
+    {"rmoust", "\342\216\261"},
+    {"dHar", "\342\245\245"},
+    {"omacr", "\305\215"},
+    {"lBarr", "\342\244\216"},
+    {"rationals", "\342\204\232"},
+    {"gnsim", "\342\213\247"},
+    {"natural", "\342\231\256"},
+    {"boxplus", "\342\212\236"},
+    {"mnplus", "\342\210\223"},
+    {"lgE", "\342\252\221"},
+    {"Ecaron", "\304\232"},
+    {"boxH", "\342\225\220"},
+    {"pound", "\302\243"},
+    {"lrhard", "\342\245\255"},
+    {"Hstrok", "\304\246"},
+    {"Icy", "\320\230"},
+    {"laemptyv", "\342\246\264"},
+    {"rharul", "\342\245\254"},
+    {"vltri", "\342\212\262"},
+    {"dwangle", "\342\246\246"},
+    {"bNot", "\342\253\255"},
+    {"bigtriangledown", "\342\226\275"},
+    {"nleftarrow", "\342\206\232"},
+    {"nwarrow", "\342\206\226"},
+    {"plusdo", "\342\210\224"},
+    {"olcir", "\342\246\276"},
+    {"NotLessEqual", "\342\211\260"},
+    {"bdquo", "\342\200\236"},
+    {"rbrksld", "\342\246\216"},
+    {"lvertneqq", "\342\211\250\357\270\200"},
+    {"pscr", "\360\235\223\205"},
+    {"clubs", "\342\231\243"},
+    {"ulcorn", "\342\214\234"},
+    {"Uarrocir", "\342\245\211"},
+    {"loarr", "\342\207\275"},
+    {"nsccue", "\342\213\241"},
+    {"because", "\342\210\265"},
+    {"Ccedil", "\303\207"},
+    {"ominus", "\342\212\226"},
+    {"subsetneq", "\342\212\212"},
+    {"iogon", "\304\257"},
+    {"eqcirc", "\342\211\226"},
+    {"ucirc", "\303\273"},
+    {"Verbar", "\342\200\226"},
+    {"frac58", "\342\205\235"},
+    {"NewLine", "\012"},
+    {"asymp", "\342\211\210"},
+    {"Xfr", "\360\235\224\233"},
+    {"OpenCurlyQuote", "\342\200\230"},
+    {"GreaterSlantEqual", "\342\251\276"},
+    {"order", "\342\204\264"},
+    {"heartsuit", "\342\231\245"},
+    {"scedil", "\305\237"},
+    {"boxdl", "\342\224\220"},
+    {"angle", "\342\210\240"},
+    {"midcir", "\342\253\260"},
+    {"boxDl", "\342\225\226"},
+    {"vangrt", "\342\246\234"},
+    {"succnapprox", "\342\252\272"},
+    {"TRADE", "\342\204\242"},
+    {"curren", "\302\244"},
+    {"nopf", "\360\235\225\237"},
+    {"RightTeeVector", "\342\245\233"},
+    {"nlt", "\342\211\256"},
+    {"Pfr", "\360\235\224\223"},
+    {"Aogon", "\304\204"},
+    {"ntrianglerighteq", "\342\213\255"},
+    {"there4", "\342\210\264"},
+    {"rfisht", "\342\245\275"},
+    {"YIcy", "\320\207"},
+    {"hybull", "\342\201\203"},
+    {"ncap", "\342\251\203"},
+    {"NonBreakingSpace", "\302\240"},
+    {"sqsub", "\342\212\217"},
+    {"ntgl", "\342\211\271"},
+    {"theta", "\316\270"},
+    {"DiacriticalTilde", "\313\234"},
+    {"nacute", "\305\204"},
+    {"lesseqgtr", "\342\213\232"},
+    {"square", "\342\226\241"},
+    {"leqq", "\342\211\246"},
+    {"seArr", "\342\207\230"},
+    {"roang", "\342\237\255"},
+    {"Nscr", "\360\235\222\251"},
+    {"nrarrw", "\342\206\235\314\270"},
+    {"Product", "\342\210\217"},
+    {"sqsupe", "\342\212\222"},
+    {"ugrave", "\303\271"},
+    {"uhblk", "\342\226\200"},
+    {"boxVR", "\342\225\240"},
+    {"boxvR", "\342\225\236"},
+    {"cemptyv", "\342\246\262"},
+    {"odsold", "\342\246\274"},
+    {"permil", "\342\200\260"},
+    {"cwint", "\342\210\261"},
+    {"AMP", "&"},
+    {"npre", "\342\252\257\314\270"},
+    {"ljcy", "\321\231"},
+    {"NotTildeEqual", "\342\211\204"},
+    {"capand", "\342\251\204"},
+    {"nwarhk", "\342\244\243"},
+    {"NotCongruent", "\342\211\242"},
+    {"kopf", "\360\235\225\234"},
+    {"rangd", "\342\246\222"},
+    {"LeftUpDownVector", "\342\245\221"},
+    {"NotTildeTilde", "\342\211\211"},
+    {"boxHu", "\342\225\247"},
+    {"planck", "\342\204\217"},
+    {"rthree", "\342\213\214"},
+    {"scsim", "\342\211\277"},
+    {"spar", "\342\210\245"},
+    {"Subset", "\342\213\220"},
+    {"rarrhk", "\342\206\252"},
+    {"Racute", "\305\224"},
+    {"notinE", "\342\213\271\314\270"},
+    {"rArr", "\342\207\222"},
+    {"aopf", "\360\235\225\222"},
+    {"nesear", "\342\244\250"},
+    {"Vdashl", "\342\253\246"},
+    {"DoubleRightTee", "\342\212\250"},
+    {"colone", "\342\211\224"},
+    {"sube", "\342\212\206"},
+    {"SucceedsTilde", "\342\211\277"},
+    {"PrecedesSlantEqual", "\342\211\274"},
+    {"otimesas", "\342\250\266"},
+    {"cirE", "\342\247\203"},
+    {"subplus", "\342\252\277"},
+    {"Lt", "\342\211\252"},
+    {"Lcy", "\320\233"},
+    {"image", "\342\204\221"},
+    {"LeftVector", "\342\206\274"},
+    {"scirc", "\305\235"},
+    {"nedot", "\342\211\220\314\270"},
+    {"Square", "\342\226\241"},
+    {"VerticalSeparator", "\342\235\230"},
+    {"eacute", "\303\251"},
+    {"percnt", "%"},
+    {"RightUpVector", "\342\206\276"},
+    {"dsol", "\342\247\266"},
+    {"boxvh", "\342\224\274"},
+    {"Itilde", "\304\250"},
+    {"Bcy", "\320\221"},
+    {"angmsdah", "\342\246\257"},
+    {"rightrightarrows", "\342\207\211"},
+    {"ubreve", "\305\255"},
+    {"agrave", "\303\240"},
+    {"LeftTee", "\342\212\243"},
+    {"subne", "\342\212\212"},
+    {"maltese", "\342\234\240"},
+    {"hArr", "\342\207\224"},
+    {"hksearow", "\342\244\245"},
+    {"squ", "\342\226\241"},
+    {"copy", "\302\251"},
+    {"EmptyVerySmallSquare", "\342\226\253"},
+    {"HumpDownHump", "\342\211\216"},
+    {"LessTilde", "\342\211\262"},
+    {"vert", "|"},
+    {"ZHcy", "\320\226"},
+    {"plankv", "\342\204\217"},
+    {"nsubset", "\342\212\202\342\203\222"},
+    {"dash", "\342\200\220"},
+    {"gE", "\342\211\247"},
+    {"Fscr", "\342\204\261"},
+    {"LessGreater", "\342\211\266"},
+    {"lesg", "\342\213\232\357\270\200"},
+    {"nless", "\342\211\256"},
+    {"Atilde", "\303\203"},
+    {"xrArr", "\342\237\271"},
+    {"Succeeds", "\342\211\273"},
+    {"plusmn", "\302\261"},
+    {"Bumpeq", "\342\211\216"},
+    {"upuparrows", "\342\207\210"},
+    {"pluse", "\342\251\262"},
+    {"oelig", "\305\223"},
+    {"bepsi", "\317\266"},
+    {"boxur", "\342\224\224"},
+    {"angzarr", "\342\215\274"},
+    {"ngeqq", "\342\211\247\314\270"},
+    {"Gammad", "\317\234"},
+    {"timesb", "\342\212\240"},
+    {"nabla", "\342\210\207"},
+    {"LeftTriangle", "\342\212\262"},
+    {"Kappa", "\316\232"},
+    {"RightArrowLeftArrow", "\342\207\204"},
+    {"asympeq", "\342\211\215"},
+    {"nbsp", "\302\240"},
+    {"yicy", "\321\227"},
+    {"Aring", "\303\205"},
+    {"ncaron", "\305\210"},
+    {"nvlArr", "\342\244\202"},
+    {"nsce", "\342\252\260\314\270"},
+    {"Not", "\342\253\254"},
+    {"Udblac", "\305\260"},
+    {"curvearrowleft", "\342\206\266"},
+    {"Copf", "\342\204\202"},
+    {"ast", "*"},
+    {"precneqq", "\342\252\265"},
+    {"SuchThat", "\342\210\213"},
+    {"range", "\342\246\245"},
+    {"doteqdot", "\342\211\221"},
+    {"UpperLeftArrow", "\342\206\226"},
+    {"capdot", "\342\251\200"},
+    {"nesim", "\342\211\202\314\270"},
+    {"boxtimes", "\342\212\240"},
+    {"Eta", "\316\227"},
+    {"Lcedil", "\304\273"},
+    {"subsim", "\342\253\207"},
+    {"lpar", "("},
+    {"rightleftarrows", "\342\207\204"},
+    {"xfr", "\360\235\224\265"},
+    {"smte", "\342\252\254"},
+    {"quest", "\077"},
+    {"popf", "\360\235\225\241"},
+    {"frac13", "\342\205\223"},
+    {"pfr", "\360\235\224\255"},
+    {"xvee", "\342\213\201"},
+    {"updownarrow", "\342\206\225"},
+    {"cups", "\342\210\252\357\270\200"},
+    {"LeftArrow", "\342\206\220"},
+    {"udarr", "\342\207\205"},
+    {"boxminus", "\342\212\237"},
+    {"notniva", "\342\210\214"},
+    {"Ubrcy", "\320\216"},
+    {"ETH", "\303\220"},
+    {"gtquest", "\342\251\274"},
+    {"UpperRightArrow", "\342\206\227"},
+    {"Kscr", "\360\235\222\246"},
+    {"OpenCurlyDoubleQuote", "\342\200\234"},
+    {"OverBar", "\342\200\276"},
+    {"NotTildeFullEqual", "\342\211\207"},
+    {"roplus", "\342\250\256"},
+    {"supsim", "\342\253\210"},
+    {"dtdot", "\342\213\261"},
+    {"Cacute", "\304\206"},
+    {"Del", "\342\210\207"},
+    {"mldr", "\342\200\246"},
+    {"djcy", "\321\222"},
+    {"rotimes", "\342\250\265"},
+    {"lsimg", "\342\252\217"},
+    {"af", "\342\201\241"},
+    {"dzcy", "\321\237"},
+    {"Uogon", "\305\262"},
+    {"dashv", "\342\212\243"},
+    {"rsh", "\342\206\261"},
+    {"frac16", "\342\205\231"},
+    {"Barwed", "\342\214\206"},
+    {"UpArrowDownArrow", "\342\207\205"},
+    {"diamond", "\342\213\204"},
+    {"subsub", "\342\253\225"},
+    {"lnap", "\342\252\211"},
+    {"ddagger", "\342\200\241"},
+    {"Nfr", "\360\235\224\221"},
+    {"Ccirc", "\304\210"},
+    {"CloseCurlyQuote", "\342\200\231"},
+    {"NotSucceedsTilde", "\342\211\277\314\270"},
+    {"Gbreve", "\304\236"},
+    {"notnivb", "\342\213\276"},
+    {"jmath", "\310\267"},
+    {"Gcedil", "\304\242"},
+    {"Iscr", "\342\204\220"},
+    {"topbot", "\342\214\266"},
+    {"mcy", "\320\274"},
+    {"ograve", "\303\262"},
+    {"elinters", "\342\217\247"},
+    {"uHar", "\342\245\243"},
+    {"minusdu", "\342\250\252"},
+    {"lmoustache", "\342\216\260"},
+    {"sqsupset", "\342\212\220"},
+    {"KHcy", "\320\245"},
+    {"gneqq", "\342\211\251"},
+    {"and", "\342\210\247"},
+    {"upsi", "\317\205"},
+    {"rsqb", "]"},
+    {"wedgeq", "\342\211\231"},
+    {"eDot", "\342\211\221"},
+    {"ocirc", "\303\264"},
+    {"bullet", "\342\200\242"},
+    {"sigma", "\317\203"},
+    {"DoubleUpArrow", "\342\207\221"},
+    {"lessapprox", "\342\252\205"},
+    {"subedot", "\342\253\203"},
+    {"vopf", "\360\235\225\247"},
+    {"succ", "\342\211\273"},
+    {"Pscr", "\360\235\222\253"},
+    {"vArr", "\342\207\225"},
+    {"imagline", "\342\204\220"},
+    {"macr", "\302\257"},
+    {"vzigzag", "\342\246\232"},
+    {"nrarr", "\342\206\233"},
+    {"realpart", "\342\204\234"},
+    {"lnapprox", "\342\252\211"},
+    {"LeftDownVector", "\342\207\203"},
+    {"setmn", "\342\210\226"},
+    {"opar", "\342\246\267"},
+    {"ccaps", "\342\251\215"},
+    {"gEl", "\342\252\214"},
+    {"NotLeftTriangleEqual", "\342\213\254"},
+    {"bigwedge", "\342\213\200"},
+    {"Leftarrow", "\342\207\220"},
+    {"Qfr", "\360\235\224\224"},
+    {"ltcir", "\342\251\271"},
+    {"rlm", "\342\200\217"},
+    {"ascr", "\360\235\222\266"},
+    {"leftarrowtail", "\342\206\242"},
+    {"bne", "=\342\203\245"},
+    {"gnap", "\342\252\212"},
+    {"amp", "&"},
+    {"rcy", "\321\200"},
+    {"Imacr", "\304\252"},
+    {"gtdot", "\342\213\227"},
+    {"KJcy", "\320\214"},
+    {"half", "\302\275"},
+    {"boxDr", "\342\225\223"},
+    {"crarr", "\342\206\265"},
+    {"acE", "\342\210\276\314\263"},
+    {"lrtri", "\342\212\277"},
+    {"Intersection", "\342\213\202"},
+    {"notinva", "\342\210\211"},
+    {"Ifr", "\342\204\221"},
+    {"Popf", "\342\204\231"},
+    {"lotimes", "\342\250\264"},
+    {"LeftUpVector", "\342\206\277"},
+    {"Prime", "\342\200\263"},
+    {"Ccaron", "\304\214"},
+    {"LongRightArrow", "\342\237\266"},
+    {"ulcorner", "\342\214\234"},
+    {"Gcy", "\320\223"},
+    {"frac15", "\342\205\225"},
+    {"curvearrowright", "\342\206\267"},
+    {"egs", "\342\252\226"},
+    {"roarr", "\342\207\276"},
+    {"RightFloor", "\342\214\213"},
+    {"zhcy", "\320\266"},
+    {"mho", "\342\204\247"},
+    {"Fouriertrf", "\342\204\261"},
+    {"plusb", "\342\212\236"},
+    {"DownArrow", "\342\206\223"},
+    {"questeq", "\342\211\237"},
+    {"NotGreater", "\342\211\257"},
+    {"plus", "+"},
+    {"Oscr", "\360\235\222\252"},
+    {"weierp", "\342\204\230"},
+    {"dotsquare", "\342\212\241"},
+    {"ReverseEquilibrium", "\342\207\213"},
+    {"DJcy", "\320\202"},
+    {"backprime", "\342\200\265"},
+    {"ratio", "\342\210\266"},
+    {"hbar", "\342\204\217"},
+    {"twoheadrightarrow", "\342\206\240"},
+    {"rightthreetimes", "\342\213\214"},
+    {"Tstrok", "\305\246"},
+    {"geq", "\342\211\245"},
+    {"nLl", "\342\213\230\314\270"},
+    {"hercon", "\342\212\271"},
+    {"Rcaron", "\305\230"},
+    {"backepsilon", "\317\266"},
+    {"nprec", "\342\212\200"},
+    {"Jcirc", "\304\264"},
+    {"ddarr", "\342\207\212"},
+    {"Pcy", "\320\237"},
+    {"nRightarrow", "\342\207\217"},
+    {"vnsub", "\342\212\202\342\203\222"},
+    {"subseteq", "\342\212\206"},
+    {"lfr", "\360\235\224\251"},
+    {"REG", "\302\256"},
+    {"blank", "\342\220\243"},
+    {"npreceq", "\342\252\257\314\270"},
+    {"epsilon", "\316\265"},
+    {"Zcy", "\320\227"},
+    {"ShortRightArrow", "\342\206\222"},
+    {"leftharpoondown", "\342\206\275"},
+    {"DoubleDot", "\302\250"},
+    {"gesdotol", "\342\252\204"},
+    {"coloneq", "\342\211\224"},
+    {"npr", "\342\212\200"},
+    {"udblac", "\305\261"},
+    {"cent", "\302\242"},
+    {"Updownarrow", "\342\207\225"},
+    {"Exists", "\342\210\203"},
+    {"scnE", "\342\252\266"},
+    {"RuleDelayed", "\342\247\264"},
+    {"zscr", "\360\235\223\217"},
+    {"leqslant", "\342\251\275"},
+    {"dcaron", "\304\217"},
+    {"Jcy", "\320\231"},
+    {"Acirc", "\303\202"},
+    {"yscr", "\360\235\223\216"},
+    {"amacr", "\304\201"},
+    {"ensp", "\342\200\202"},
+    {"Scirc", "\305\234"},
+    {"dot", "\313\231"},
+    {"lne", "\342\252\207"},
+    {"Vert", "\342\200\226"},
+    {"LeftUpVectorBar", "\342\245\230"},
+    {"Precedes", "\342\211\272"},
+    {"DoubleContourIntegral", "\342\210\257"},
+    {"Wscr", "\360\235\222\262"},
+    {"boxul", "\342\224\230"},
+    {"rcedil", "\305\227"},
+    {"Ouml", "\303\226"},
+    {"Xi", "\316\236"},
+    {"circleddash", "\342\212\235"},
+    {"TildeFullEqual", "\342\211\205"},
+    {"geqq", "\342\211\247"},
+    {"boxvH", "\342\225\252"},
+    {"frac78", "\342\205\236"},
+    {"lesdoto", "\342\252\201"},
+    {"ShortDownArrow", "\342\206\223"},
+    {"Barv", "\342\253\247"},
+    {"xoplus", "\342\250\201"},
+    {"real", "\342\204\234"},
+    {"lowbar", "_"},
+    {"capbrcup", "\342\251\211"},
+    {"cirmid", "\342\253\257"},
+    {"nlE", "\342\211\246\314\270"},
+    {"nscr", "\360\235\223\203"},
+    {"varkappa", "\317\260"},
+    {"equest", "\342\211\237"},
+    {"rangle", "\342\237\251"},
+    {"longrightarrow", "\342\237\266"},
+    {"Lang", "\342\237\252"},
+    {"eta", "\316\267"},
+    {"prnE", "\342\252\265"},
+    {"scpolint", "\342\250\223"},
+    {"bigcirc", "\342\227\257"},
+    {"Mfr", "\360\235\224\220"},
+    {"seswar", "\342\244\251"},
+    {"curlywedge", "\342\213\217"},
+    {"NotGreaterTilde", "\342\211\265"},
+    {"simplus", "\342\250\244"},
+    {"EqualTilde", "\342\211\202"},
+    {"jsercy", "\321\230"},
+    {"lnsim", "\342\213\246"},
+    {"pitchfork", "\342\213\224"},
+    {"blacktriangle", "\342\226\264"},
+    {"boxHU", "\342\225\251"},
+    {"emacr", "\304\223"},
+    {"ssetmn", "\342\210\226"},
+    {"Superset", "\342\212\203"},
+    {"Omicron", "\316\237"},
+    {"gacute", "\307\265"},
+    {"langd", "\342\246\221"},
+    {"napos", "\305\211"},
+    {"Aacute", "\303\201"},
+    {"RBarr", "\342\244\220"},
+    {"gsime", "\342\252\216"},
+    {"ldquo", "\342\200\234"},
+    {"succnsim", "\342\213\251"},
+    {"lrhar", "\342\207\213"},
+    {"Backslash", "\342\210\226"},
+    {"nlsim", "\342\211\264"},
+    {"ges", "\342\251\276"},
+    {"supe", "\342\212\207"},
+    {"ll", "\342\211\252"},
+    {"thetav", "\317\221"},
+    {"Gopf", "\360\235\224\276"},
+    {"shortmid", "\342\210\243"},
+    {"caps", "\342\210\251\357\270\200"},
+    {"iff", "\342\207\224"},
+    {"imath", "\304\261"},
+    {"ltcc", "\342\252\246"},
+    {"Epsilon", "\316\225"},
+    {"backsimeq", "\342\213\215"},
+    {"simlE", "\342\252\237"},
+    {"Hopf", "\342\204\215"},
+    {"cire", "\342\211\227"},
+    {"andand", "\342\251\225"},
+    {"boxh", "\342\224\200"},
+    {"igrave", "\303\254"},
+    {"uharr", "\342\206\276"},
+    {"TScy", "\320\246"},
+    {"rppolint", "\342\250\222"},
+    {"Sscr", "\360\235\222\256"},
+    {"NotSubset", "\342\212\202\342\203\222"},
+    {"AElig", "\303\206"},
+    {"psi", "\317\210"},
+    {"GreaterEqualLess", "\342\213\233"},
+    {"vdash", "\342\212\242"},
+    {"HorizontalLine", "\342\224\200"},
+    {"lowast", "\342\210\227"},
+    {"DD", "\342\205\205"},
+    {"ropf", "\360\235\225\243"},
+    {"gtrsim", "\342\211\263"},
+    {"supset", "\342\212\203"},
+    {"zopf", "\360\235\225\253"},
+    {"rceil", "\342\214\211"},
+    {"zwnj", "\342\200\214"},
+    {"simrarr", "\342\245\262"},
+    {"ltlarr", "\342\245\266"},
+    {"Pr", "\342\252\273"},
+    {"HilbertSpace", "\342\204\213"},
+    {"triplus", "\342\250\271"},
+    {"Vee", "\342\213\201"},
+    {"frac23", "\342\205\224"},
+    {"Xopf", "\360\235\225\217"},
+    {"nisd", "\342\213\272"},
+    {"midast", "*"},
+    {"utri", "\342\226\265"},
+    {"raemptyv", "\342\246\263"},
+    {"ddotseq", "\342\251\267"},
+    {"ucy", "\321\203"},
+    {"mid", "\342\210\243"},
+    {"emsp13", "\342\200\204"},
+    {"Supset", "\342\213\221"},
+    {"Sopf", "\360\235\225\212"},
+    {"varsubsetneqq", "\342\253\213\357\270\200"},
+    {"Ecy", "\320\255"},
+    {"sfrown", "\342\214\242"},
+    {"telrec", "\342\214\225"},
+    {"supne", "\342\212\213"},
+    {"nvinfin", "\342\247\236"},
+    {"blk14", "\342\226\221"},
+    {"perp", "\342\212\245"},
+    {"Gcirc", "\304\234"},
+    {"urcorn", "\342\214\235"},
+    {"utdot", "\342\213\260"},
+    {"barvee", "\342\212\275"},
+    {"Iuml", "\303\217"},
+    {"rdldhar", "\342\245\251"},
+    {"rrarr", "\342\207\211"},
+    {"yacy", "\321\217"},
+    {"xdtri", "\342\226\275"},
+    {"numero", "\342\204\226"},
+    {"angrtvbd", "\342\246\235"},
+    {"xodot", "\342\250\200"},
+    {"Rarr", "\342\206\240"},
+    {"Rcedil", "\305\226"},
+    {"Topf", "\360\235\225\213"},
+    {"uharl", "\342\206\277"},
+    {"lnE", "\342\211\250"},
+    {"blk34", "\342\226\223"},
+    {"vBar", "\342\253\250"},
+    {"gla", "\342\252\245"},
+    {"frac34", "\302\276"},
+    {"sim", "\342\210\274"},
+    {"LeftRightArrow", "\342\206\224"},
+    {"Ecirc", "\303\212"},
+    {"bscr", "\360\235\222\267"},
+    {"cularr", "\342\206\266"},
+    {"ubrcy", "\321\236"},
+    {"Aopf", "\360\235\224\270"},
+    {"iacute", "\303\255"},
+    {"NotLessGreater", "\342\211\270"},
+    {"Laplacetrf", "\342\204\222"},
+    {"lopar", "\342\246\205"},
+    {"ncongdot", "\342\251\255\314\270"},
+    {"fpartint", "\342\250\215"},
+    {"qscr", "\360\235\223\206"},
+    {"NotLessTilde", "\342\211\264"},
+    {"block", "\342\226\210"},
+    {"nsupe", "\342\212\211"},
+    {"star", "\342\230\206"},
+    {"ntriangleleft", "\342\213\252"},
+    {"naturals", "\342\204\225"},
+    {"nrArr", "\342\207\217"},
+    {"gesles", "\342\252\224"},
+    {"yen", "\302\245"},
+    {"hoarr", "\342\207\277"},
+    {"boxdL", "\342\225\225"},
+    {"gel", "\342\213\233"},
+    {"gnapprox", "\342\252\212"},
+    {"DoubleVerticalBar", "\342\210\245"},
+    {"ogt", "\342\247\201"},
+    {"SupersetEqual", "\342\212\207"},
+    {"lates", "\342\252\255\357\270\200"},
+    {"NotHumpDownHump", "\342\211\216\314\270"},
+    {"strns", "\302\257"},
+    {"gsim", "\342\211\263"},
+    {"quaternions", "\342\204\215"},
+    {"intprod", "\342\250\274"},
+    {"orderof", "\342\204\264"},
+    {"thicksim", "\342\210\274"},
+    {"ncong", "\342\211\207"},
+    {"Iopf", "\360\235\225\200"},
+    {"jcy", "\320\271"},
+    {"Delta", "\316\224"},
+    {"divide", "\303\267"},
+    {"dfisht", "\342\245\277"},
+    {"Tilde", "\342\210\274"},
+    {"ouml", "\303\266"},
+    {"Otilde", "\303\225"},
+    {"boxHd", "\342\225\244"},
+    {"searr", "\342\206\230"},
+    {"prap", "\342\252\267"},
+    {"Otimes", "\342\250\267"},
+    {"upharpoonright", "\342\206\276"},
+    {"tau", "\317\204"},
+    {"swArr", "\342\207\231"},
+    {"DoubleUpDownArrow", "\342\207\225"},
+    {"ell", "\342\204\223"},
+    {"NoBreak", "\342\201\240"},
+    {"nrightarrow", "\342\206\233"},
+    {"nwArr", "\342\207\226"},
+    {"Ograve", "\303\222"},
+    {"ne", "\342\211\240"},
+    {"lesdotor", "\342\252\203"},
+    {"escr", "\342\204\257"},
+    {"varsupsetneqq", "\342\253\214\357\270\200"},
+    {"mumap", "\342\212\270"},
+    {"lAarr", "\342\207\232"},
+    {"boxvr", "\342\224\234"},
+    {"apos", "'"},
+    {"ngtr", "\342\211\257"},
+    {"bsolb", "\342\247\205"},
+    {"OverBracket", "\342\216\264"},
+    {"cuwed", "\342\213\217"},
+    {"RightDownVectorBar", "\342\245\225"},
+    {"boxvl", "\342\224\244"},
+    {"nu", "\316\275"},
+    {"ultri", "\342\227\270"},
+    {"NotGreaterSlantEqual", "\342\251\276\314\270"},
+    {"grave", "`"},
+    {"LeftFloor", "\342\214\212"},
+    {"ENG", "\305\212"},
+    {"Ucirc", "\303\233"},
+    {"cuvee", "\342\213\216"},
+    {"nvlt", "<\342\203\222"},
+    {"PlusMinus", "\302\261"},
+    {"csub", "\342\253\217"},
+    {"Because", "\342\210\265"},
+    {"Uring", "\305\256"},
+    {"mopf", "\360\235\225\236"},
+    {"eqsim", "\342\211\202"},
+    {"Zscr", "\360\235\222\265"},
+    {"num", "#"},
+    {"DownBreve", "\314\221"},
+    {"ffr", "\360\235\224\243"},
+    {"lcedil", "\304\274"},
+    {"DoubleRightArrow", "\342\207\222"},
+    {"submult", "\342\253\201"},
+    {"bsim", "\342\210\275"},
+    {"luruhar", "\342\245\246"},
+    {"esdot", "\342\211\220"},
+    {"DownTeeArrow", "\342\206\247"},
+    {"tcy", "\321\202"},
+    {"olcross", "\342\246\273"},
+    {"nGg", "\342\213\231\314\270"},
+    {"wscr", "\360\235\223\214"},
+    {"Igrave", "\303\214"},
+    {"vellip", "\342\213\256"},
+    {"CHcy", "\320\247"},
+    {"jopf", "\360\235\225\233"},
+    {"sccue", "\342\211\275"},
+    {"sigmaf", "\317\202"},
+    {"mscr", "\360\235\223\202"},
+    {"neArr", "\342\207\227"},
+    {"lt", "<"},
+    {"ordf", "\302\252"},
+    {"nges", "\342\251\276\314\270"},
+    {"preceq", "\342\252\257"},
+    {"sigmav", "\317\202"},
+    {"Wfr", "\360\235\224\232"},
+    {"biguplus", "\342\250\204"},
+    {"upsilon", "\317\205"},
+    {"NotRightTriangleBar", "\342\247\220\314\270"},
+    {"doteq", "\342\211\220"},
+    {"supE", "\342\253\206"},
+    {"llarr", "\342\207\207"},
+    {"ruluhar", "\342\245\250"},
+    {"SquareSuperset", "\342\212\220"},
+    {"Vcy", "\320\222"},
+    {"beta", "\316\262"},
+    {"bsol", "\134"},
+    {"nVDash", "\342\212\257"},
+    {"NotRightTriangle", "\342\213\253"},
+    {"starf", "\342\230\205"},
+    {"lescc", "\342\252\250"},
+    {"oror", "\342\251\226"},
+    {"langle", "\342\237\250"},
+    {"yacute", "\303\275"},
+    {"frac18", "\342\205\233"},
+    {"qopf", "\360\235\225\242"},
+    {"Downarrow", "\342\207\223"},
+    {"backcong", "\342\211\214"},
+    {"softcy", "\321\214"},
+    {"NotLess", "\342\211\256"},
+    {"robrk", "\342\237\247"},
+    {"frac14", "\302\274"},
+    {"subseteqq", "\342\253\205"},
+    {"oplus", "\342\212\225"},
+    {"Eopf", "\360\235\224\274"},
+    {"coprod", "\342\210\220"},
+    {"Kfr", "\360\235\224\216"},
+    {"zeta", "\316\266"},
+    {"triangle", "\342\226\265"},
+    {"Ocy", "\320\236"},
+    {"varsubsetneq", "\342\212\212\357\270\200"},
+    {"ReverseElement", "\342\210\213"},
+    {"vcy", "\320\262"},
+    {"Iogon", "\304\256"},
+    {"bigtriangleup", "\342\226\263"},
+    {"rlhar", "\342\207\214"},
+    {"NotGreaterLess", "\342\211\271"},
+    {"rbbrk", "\342\235\263"},
+    {"TSHcy", "\320\213"},
+    {"NotSucceeds", "\342\212\201"},
+    {"imagpart", "\342\204\221"},
+    {"Tcy", "\320\242"},
+    {"triangleq", "\342\211\234"},
+    {"tosa", "\342\244\251"},
+    {"gtcir", "\342\251\272"},
+    {"tint", "\342\210\255"},
+    {"gl", "\342\211\267"},
+    {"precnapprox", "\342\252\271"},
+    {"RoundImplies", "\342\245\260"},
+    {"NJcy", "\320\212"},
+    {"nvltrie", "\342\212\264\342\203\222"},
+    {"leftrightsquigarrow", "\342\206\255"},
+    {"Cap", "\342\213\222"},
+    {"Scedil", "\305\236"},
+    {"gbreve", "\304\237"},
+    {"egrave", "\303\250"},
+    {"xcap", "\342\213\202"},
+    {"SmallCircle", "\342\210\230"},
+    {"cupor", "\342\251\205"},
+    {"CounterClockwiseContourIntegral", "\342\210\263"},
+    {"lsime", "\342\252\215"},
+    {"dharl", "\342\207\203"},
+    {"RightAngleBracket", "\342\237\251"},
+    {"nsupseteq", "\342\212\211"},
+    {"srarr", "\342\206\222"},
+    {"nrtri", "\342\213\253"},
+    {"nvle", "\342\211\244\342\203\222"},
+    {"Yscr", "\360\235\222\264"},
+    {"nle", "\342\211\260"},
+    {"LeftDownTeeVector", "\342\245\241"},
+    {"looparrowright", "\342\206\254"},
+    {"orslope", "\342\251\227"},
+    {"Ugrave", "\303\231"},
+    {"bprime", "\342\200\265"},
+    {"lceil", "\342\214\210"},
+    {"rarrpl", "\342\245\205"},
+    {"supnE", "\342\253\214"},
+    {"ldsh", "\342\206\262"},
+    {"llcorner", "\342\214\236"},
+    {"circeq", "\342\211\227"},
+    {"Cup", "\342\213\223"},
+    {"profalar", "\342\214\256"},
+    {"chi", "\317\207"},
+    {"in", "\342\210\210"},
+    {"eqvparsl", "\342\247\245"},
+    {"odblac", "\305\221"},
+    {"ExponentialE", "\342\205\207"},
+    {"RightUpDownVector", "\342\245\217"},
+    {"omega", "\317\211"},
+    {"ofcir", "\342\246\277"},
+    {"Larr", "\342\206\236"},
+    {"NotReverseElement", "\342\210\214"},
+    {"rhard", "\342\207\201"},
+    {"sc", "\342\211\273"},
+    {"Wcirc", "\305\264"},
+    {"nvrtrie", "\342\212\265\342\203\222"},
+    {"NestedLessLess", "\342\211\252"},
+    {"rang", "\342\237\251"},
+    {"Jopf", "\360\235\225\201"},
+    {"primes", "\342\204\231"},
+    {"rarrw", "\342\206\235"},
+    {"origof", "\342\212\266"},
+    {"odiv", "\342\250\270"},
+    {"Vfr", "\360\235\224\231"},
+    {"larrlp", "\342\206\253"},
+    {"VDash", "\342\212\253"},
+    {"DifferentialD", "\342\205\206"},
+    {"boxv", "\342\224\202"},
+    {"Oslash", "\303\230"},
+    {"prcue", "\342\211\274"},
+    {"rBarr", "\342\244\217"},
+    {"Hcirc", "\304\244"},
+    {"jfr", "\360\235\224\247"},
+    {"Hat", "^"},
+    {"middot", "\302\267"},
+    {"Icirc", "\303\216"},
+    {"phmmat", "\342\204\263"},
+    {"rarrb", "\342\207\245"},
+    {"boxuR", "\342\225\230"},
+    {"rcub", "}"},
+    {"aogon", "\304\205"},
+    {"Dopf", "\360\235\224\273"},
+    {"rarrtl", "\342\206\243"},
+    {"Afr", "\360\235\224\204"},
+    {"race", "\342\210\275\314\261"},
+    {"gap", "\342\252\206"},
+    {"Tfr", "\360\235\224\227"},
+    {"Jukcy", "\320\204"},
+    {"Wopf", "\360\235\225\216"},
+    {"spadesuit", "\342\231\240"},
+    {"atilde", "\303\243"},
+    {"dd", "\342\205\206"},
+    {"nsimeq", "\342\211\204"},
+    {"sqsupseteq", "\342\212\222"},
+    {"vee", "\342\210\250"},
+    {"Rightarrow", "\342\207\222"},
+    {"frac38", "\342\205\234"},
+    {"uml", "\302\250"},
+    {"emsp14", "\342\200\205"},
+    {"lAtail", "\342\244\233"},
+    {"nsim", "\342\211\201"},
+    {"lurdshar", "\342\245\212"},
+    {"SquareSupersetEqual", "\342\212\222"},
+    {"supsub", "\342\253\224"},
+    {"it", "\342\201\242"},
+    {"diams", "\342\231\246"},
+    {"bot", "\342\212\245"},
+    {"CapitalDifferentialD", "\342\205\205"},
+    {"NotElement", "\342\210\211"},
+    {"nap", "\342\211\211"},
+    {"malt", "\342\234\240"},
+    {"parallel", "\342\210\245"},
+    {"LeftAngleBracket", "\342\237\250"},
+    {"tscr", "\360\235\223\211"},
+    {"slarr", "\342\206\220"},
+    {"Zopf", "\342\204\244"},
+    {"gesdoto", "\342\252\202"},
+    {"prE", "\342\252\263"},
+    {"boxVl", "\342\225\242"},
+    {"quatint", "\342\250\226"},
+    {"Qopf", "\342\204\232"},
+    {"UpEquilibrium", "\342\245\256"},
+    {"downharpoonright", "\342\207\202"},
+    {"sum", "\342\210\221"},
+    {"leftthreetimes", "\342\213\213"},
+    {"Rang", "\342\237\253"},
+    {"iprod", "\342\250\274"},
+    {"xlArr", "\342\237\270"},
+    {"NotSquareSubset", "\342\212\217\314\270"},
+    {"csup", "\342\253\220"},
+    {"DownRightVector", "\342\207\201"},
+    {"uogon", "\305\263"},
+    {"Re", "\342\204\234"},
+    {"lagran", "\342\204\222"},
+    {"IEcy", "\320\225"},
+    {"curlyeqsucc", "\342\213\237"},
+    {"llhard", "\342\245\253"},
+    {"DownRightVectorBar", "\342\245\227"},
+    {"nLtv", "\342\211\252\314\270"},
+    {"blacksquare", "\342\226\252"},
+    {"And", "\342\251\223"},
+    {"nsupE", "\342\253\206\314\270"},
+    {"NotSucceedsSlantEqual", "\342\213\241"},
+    {"udhar", "\342\245\256"},
+    {"swarrow", "\342\206\231"},
+    {"NotSucceedsEqual", "\342\252\260\314\270"},
+    {"gjcy", "\321\223"},
+    {"uring", "\305\257"},
+    {"alpha", "\316\261"},
+    {"urcrop", "\342\214\216"},
+};
+
+} // namespace NitroMarkdown::HtmlEntityTable
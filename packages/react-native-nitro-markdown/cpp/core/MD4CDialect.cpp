@@ -0,0 +1,23 @@
+#include "MD4CDialect.hpp"
+
+namespace NitroMarkdown {
+
+unsigned int MD4CDialect::flags(bool gfm, bool math) {
+    unsigned int flags = MD_FLAG_NOHTML;
+    if (gfm) {
+        flags |= MD_FLAG_TABLES | MD_FLAG_STRIKETHROUGH | MD_FLAG_TASKLISTS | MD_FLAG_PERMISSIVEAUTOLINKS;
+    }
+    if (math) flags |= MD_FLAG_LATEXMATHSPANS;
+    return flags;
+}
+
+int MD4CDialect::parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata) {
+    switch (parser->flags) {
+        case MD_SPECIALIZED_FLAGS_GFM_MATH: return md_parse_gfm_math(text, size, parser, userdata);
+        case MD_SPECIALIZED_FLAGS_GFM: return md_parse_gfm(text, size, parser, userdata);
+        case MD_SPECIALIZED_FLAGS_COMMONMARK: return md_parse_commonmark(text, size, parser, userdata);
+        default: return md_parse(text, size, parser, userdata);
+    }
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "../md4c/md4c.h"
+
+namespace NitroMarkdown {
+
+/**
+ * How the library runs md4c, shared by MD4CParser and MarkdownHtmlRenderer
+ * so that rendered HTML shows what the AST holds.
+ */
+class MD4CDialect {
+public:
+    // md4c flags of the dialect the options select; raw HTML is always off.
+    static unsigned int flags(bool gfm, bool math);
+
+    // md_parse(), or the build of it with the flags fixed at compile time
+    // when parser's flags are those of one of the common dialects.
+    static int parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
+};
+
+} // namespace NitroMarkdown
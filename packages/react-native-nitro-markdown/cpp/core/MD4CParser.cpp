@@ -1,6 +1,14 @@
 #include "MD4CParser.hpp"
+#include "AllocationCounter.hpp"
+#include "ContentHash.hpp"
+#include "HtmlEntities.hpp"
+#include "MD4CDialect.hpp"
+#include "Tracer.hpp"
 #include "../md4c/md4c.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
 #include <stack>
 #include <cstring>
 
@@ -12,20 +20,234 @@ public:
     std::stack<std::shared_ptr<MarkdownNode>> nodeStack;
     std::string currentText;
     const char* inputText = nullptr;
+    ExternalReferences references;
+    std::vector<size_t> blockOffsets;
+    std::vector<ReferenceDefinitionTable::Entry> referenceDefinitions;
+    ParserOptions options;
+    ParseStats stats;
+    std::chrono::steady_clock::time_point startTime;
+    
+    // Phase timing for ParserOptions::collectStats. md4c analyzes all blocks
+    // before emitting the first one, and each leaf block's inlines right after
+    // entering it, so the gaps before those callbacks are the analysis phases.
+    bool timingPending = false;
+    bool blockAnalysisDone = false;
+    std::chrono::steady_clock::time_point inlineStart;
+    size_t depthBase = 0;
+    
+    struct DeferredBlock {
+        std::shared_ptr<MarkdownNode> node;
+        std::vector<MD_LINE_RANGE> lines;
+        // Where the inline children go; a tight list item's text has no
+        // paragraph of its own and precedes any nested blocks.
+        size_t childIndex = 0;
+        bool materialized = false;
+    };
+    // Kept from the last parse with deferInlines for parseInlines(). Text
+    // whose owner was given stays where it is, in deferredSource.
+    std::string deferredText;
+    std::shared_ptr<const void> deferredOwner;
+    std::string_view deferredSource;
+    std::vector<DeferredBlock> deferredBlocks;
+    ReferenceDefinitionTable deferredReferences;
+    
+    BlockMemo blockMemo;
+    
+    MemoryPolicy memoryPolicy;
+    // Largest input since the buffers were last shrunk, and the parses in a
+    // row since then that had much less.
+    size_t grownFor = 0;
+    size_t smallParses = 0;
+    // The results of the last parse were shrunk to fit; the next parse frees
+    // them instead of clearing them for reuse.
+    bool shrunk = false;
+    // Set for parses that consult blockMemo; the seed covers the options.
+    bool memoActive = false;
+    uint64_t memoSeed = 0;
+    std::optional<uint64_t> definitionsHash;
+    // Root child being built for a block the memo did not have, stored under
+    // pendingKey once the next top-level block starts.
+    uint64_t pendingKey = 0;
+    size_t pendingChild = SIZE_MAX;
+    
+    static constexpr int kBudgetExceeded = -2;
     
     void reset() {
-        root = std::make_shared<MarkdownNode>(NodeType::Document);
+        root = makeNode(NodeType::Document);
         while (!nodeStack.empty()) nodeStack.pop();
         nodeStack.push(root);
         currentText.clear();
-        currentText.reserve(256);
+        {
+            AllocationScope scope(AllocationCategory::Strings);
+            currentText.reserve(256);
+        }
+        blockOffsets.clear();
+        referenceDefinitions.clear();
+        stats = ParseStats{};
+        startTime = std::chrono::steady_clock::now();
+        timingPending = options.collectStats;
+        blockAnalysisDone = false;
+        if (options.collectStats) startCounting(0);
+        definitionsHash.reset();
+        pendingChild = SIZE_MAX;
+    }
+    
+    void resetDeferred() {
+        deferredText.clear();
+        deferredOwner.reset();
+        deferredSource = {};
+        deferredBlocks.clear();
+        deferredReferences.clear();
+    }
+    
+    void freeShrunkResults() {
+        if (!shrunk) return;
+        std::vector<size_t>().swap(blockOffsets);
+        std::vector<ReferenceDefinitionTable::Entry>().swap(referenceDefinitions);
+        std::vector<DeferredBlock>().swap(deferredBlocks);
+        std::string().swap(deferredText);
+        shrunk = false;
+    }
+    
+    // Heap bytes of the buffers a parse grows and the next one reuses.
+    size_t workingBytes() const {
+        size_t bytes = MemoryFootprint::heapBytes(currentText) + MemoryFootprint::heapBytes(blockOffsets) +
+                       MemoryFootprint::heapBytes(referenceDefinitions) +
+                       MemoryFootprint::heapBytes(deferredBlocks) + MemoryFootprint::heapBytes(deferredText);
+        return bytes + deferredReferences.memoryBytes();
+    }
+    
+    // Drops the capacity nothing uses; the results of the last parse stay.
+    void shrink() {
+        std::string().swap(currentText);
+        blockOffsets.shrink_to_fit();
+        referenceDefinitions.shrink_to_fit();
+        deferredBlocks.shrink_to_fit();
+        deferredText.shrink_to_fit();
+        if (deferredReferences.empty()) deferredReferences = ReferenceDefinitionTable();
+        shrunk = true;
+        grownFor = 0;
+        smallParses = 0;
+    }
+    
+    void applyMemoryPolicy(size_t inputSize) {
+        size_t bytes = workingBytes();
+        if (memoryPolicy.highWaterBytes > 0 && bytes > memoryPolicy.highWaterBytes) {
+            shrink();
+            return;
+        }
+        if (inputSize >= grownFor / 4) {
+            grownFor = std::max(grownFor, inputSize);
+            smallParses = 0;
+            return;
+        }
+        if (memoryPolicy.shrinkAfterSmallParses > 0 && bytes > memoryPolicy.baselineBytes &&
+            ++smallParses >= memoryPolicy.shrinkAfterSmallParses) {
+            shrink();
+        }
+    }
+    
+    double elapsedMs() const {
+        return std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - startTime).count();
+    }
+    
+    // Called first thing in every callback that can end an analysis phase.
+    void endAnalysisPhase() {
+        if (!timingPending) return;
+        timingPending = false;
+        auto now = std::chrono::steady_clock::now();
+        if (!blockAnalysisDone) {
+            blockAnalysisDone = true;
+            stats.blockAnalysisMs = std::chrono::duration<double, std::milli>(now - startTime).count();
+        } else {
+            stats.inlineAnalysisMs += std::chrono::duration<double, std::milli>(now - inlineStart).count();
+        }
+    }
+    
+    void beginInlineAnalysis() {
+        if (!options.collectStats) return;
+        timingPending = true;
+        inlineStart = std::chrono::steady_clock::now();
+    }
+    
+    void finishStats() {
+        stats.parseTimeMs = elapsedMs();
+        if (!options.collectStats) return;
+        stats.astBuildMs = std::max(0.0, stats.parseTimeMs - stats.blockAnalysisMs - stats.inlineAnalysisMs);
+    }
+    
+    // Tree shape is counted as nodes are attached; a walk over the finished
+    // tree would cost more than the parse's own cache misses.
+    void startCounting(size_t stackBase) {
+        depthBase = stackBase;
+        stats.nodeCount = 1;
+        stats.maxDepth = 1;
+        stats.estimatedAllocations = 1;
+    }
+    
+    void countString(const std::string& s) {
+        static const size_t inlineCapacity = std::string().capacity();
+        if (s.capacity() > inlineCapacity) stats.estimatedAllocations++;
+    }
+    
+    void countNode(const MarkdownNode& parent, const MarkdownNode& child, size_t depth) {
+        stats.nodeCount++;
+        stats.maxDepth = std::max(stats.maxDepth, depth);
+        stats.estimatedAllocations++;
+        if (parent.children.size() == parent.children.capacity()) stats.estimatedAllocations++;
+        if (child.content) countString(*child.content);
+        if (child.href) countString(*child.href);
+        if (child.title) countString(*child.title);
+        if (child.language) countString(*child.language);
+    }
+    
+    static std::shared_ptr<MarkdownNode> makeNode(NodeType type) {
+        AllocationScope scope(AllocationCategory::Nodes);
+        return std::make_shared<MarkdownNode>(type);
+    }
+    
+    // Attaches child to the innermost open node.
+    void appendChild(std::shared_ptr<MarkdownNode> child) {
+        AllocationScope scope(AllocationCategory::Nodes);
+        auto& parent = nodeStack.top();
+        if (options.collectStats) countNode(*parent, *child, nodeStack.size() - depthBase + 1);
+        parent->addChild(std::move(child));
+    }
+    
+    // Replaces the root child md4c was working on when the budget ran out,
+    // and everything after it, with the remaining source as plain text.
+    void fallBackToPlainText(std::string_view markdown) {
+        currentText.clear();
+        while (nodeStack.size() > 1) nodeStack.pop();
+        
+        size_t offset = 0;
+        if (!blockOffsets.empty()) {
+            offset = blockOffsets.back();
+            blockOffsets.pop_back();
+            root->children.pop_back();
+        }
+        stats.plainTextOffset = offset;
+        
+        std::string_view rest = markdown.substr(offset);
+        size_t end = rest.find_last_not_of(" \t\r\n");
+        if (end == std::string_view::npos) return;
+        
+        auto paragraph = makeNode(NodeType::Paragraph);
+        auto textNode = makeNode(NodeType::Text);
+        textNode->content = std::string(rest.substr(0, end + 1));
+        appendChild(paragraph);
+        nodeStack.push(std::move(paragraph));
+        appendChild(std::move(textNode));
+        nodeStack.pop();
+        blockOffsets.push_back(offset);
     }
     
     void flushText() {
         if (!currentText.empty() && !nodeStack.empty()) {
-            auto textNode = std::make_shared<MarkdownNode>(NodeType::Text);
+            auto textNode = makeNode(NodeType::Text);
             textNode->content = std::move(currentText);
-            nodeStack.top()->addChild(std::move(textNode));
+            appendChild(std::move(textNode));
             currentText.clear();
         }
     }
@@ -33,7 +255,7 @@ public:
     void pushNode(std::shared_ptr<MarkdownNode> node) {
         flushText();
         if (node && !nodeStack.empty()) {
-            nodeStack.top()->addChild(node);
+            appendChild(node);
             nodeStack.push(std::move(node));
         }
     }
@@ -46,42 +268,180 @@ public:
     }
     
     std::string getAttributeText(const MD_ATTRIBUTE* attr) {
-        if (!attr || attr->size == 0) return "";
+        if (!attr || !attr->text || attr->size == 0) return "";
 
+        AllocationScope scope(AllocationCategory::Strings);
         std::string result;
         result.reserve(attr->size);
         
-        for (unsigned i = 0; i < attr->size; i++) {
-            if (attr->substr_types[i] == MD_TEXT_NORMAL ||
-                attr->substr_types[i] == MD_TEXT_ENTITY ||
-                attr->substr_types[i] == MD_TEXT_NULLCHAR) {
-                result.append(attr->substr_offsets[i], 
-                    i + 1 < attr->size ? attr->substr_offsets[i + 1] - attr->substr_offsets[i] 
-                                       : attr->size - attr->substr_offsets[i]);
+        for (unsigned i = 0; attr->substr_offsets[i] < attr->size; i++) {
+            MD_OFFSET begin = attr->substr_offsets[i];
+            std::string_view part(attr->text + begin, attr->substr_offsets[i + 1] - begin);
+            switch (attr->substr_types[i]) {
+                case MD_TEXT_ENTITY:
+                    HtmlEntities::appendDecoded(result, part);
+                    break;
+                case MD_TEXT_NULLCHAR:
+                    HtmlEntities::appendUtf8(result, 0xFFFD);
+                    break;
+                default:
+                    result.append(part);
+                    break;
             }
         }
         
-        if (result.empty() && attr->text && attr->size > 0) {
-            result.assign(attr->text, attr->size);
+        return result;
+    }
+    
+    bool definesLabel(const MD_CHAR* label, MD_SIZE size) const {
+        for (const auto& entry : referenceDefinitions) {
+            const auto& defLabel = entry.definition.label;
+            if (md_ref_label_equal(defLabel.data(), static_cast<MD_SIZE>(defLabel.size()), label, size)) {
+                return true;
+            }
         }
+        return false;
+    }
+    
+    static void blockOffset(MD_BLOCKTYPE type, MD_OFFSET offset, void* userdata) {
+        (void)type;
+        auto* impl = static_cast<Impl*>(userdata);
         
-        return result;
+        // Only blocks opened directly under the document become root children.
+        if (impl->nodeStack.size() == 1) {
+            impl->blockOffsets.push_back(offset);
+        }
+    }
+    
+    // Links resolve against definitions anywhere in the document, so blocks
+    // that may contain one are keyed by these as well.
+    uint64_t referenceDefinitionsHash() {
+        if (!definitionsHash) {
+            uint64_t hash = 0;
+            for (const auto& entry : referenceDefinitions) {
+                const auto& definition = entry.definition;
+                hash = ContentHash::combine(hash, ContentHash::hash(definition.label));
+                hash = ContentHash::combine(hash, ContentHash::hash(definition.destination));
+                hash = ContentHash::combine(hash, ContentHash::hash(definition.title));
+            }
+            definitionsHash = hash;
+        }
+        return *definitionsHash;
+    }
+    
+    void memoizePendingBlock() {
+        if (pendingChild == SIZE_MAX) return;
+        if (nodeStack.size() == 1 && root->children.size() == pendingChild + 1) {
+            blockMemo.insert(pendingKey, root->children.back());
+        }
+        pendingChild = SIZE_MAX;
+    }
+    
+    static int skipBlock(MD_BLOCKTYPE type, MD_OFFSET beg, MD_OFFSET end, void* userdata) {
+        (void)type;
+        auto* impl = static_cast<Impl*>(userdata);
+        // Only whole root children can be stored or reused.
+        if (impl->nodeStack.size() != 1) {
+            impl->pendingChild = SIZE_MAX;
+            return 0;
+        }
+        impl->memoizePendingBlock();
+        
+        std::string_view source(impl->inputText + beg, end - beg);
+        uint64_t seed = impl->memoSeed;
+        if (source.find('[') != std::string_view::npos) {
+            seed = ContentHash::combine(seed, impl->referenceDefinitionsHash());
+        }
+        uint64_t key = ContentHash::hash(source, seed);
+        
+        if (auto node = impl->blockMemo.find(key)) {
+            impl->blockOffsets.push_back(beg);
+            impl->appendChild(std::move(node));
+            return 1;
+        }
+        impl->pendingKey = key;
+        impl->pendingChild = impl->root->children.size();
+        return 0;
+    }
+    
+    static int refDef(const MD_REF_DEF_DETAIL* def, void* userdata) {
+        auto* impl = static_cast<Impl*>(userdata);
+        
+        ReferenceDefinition definition;
+        definition.label.assign(def->label, def->label_size);
+        definition.destination.assign(def->dest, def->dest_size);
+        if (def->title && def->title_size > 0) {
+            definition.title.assign(def->title, def->title_size);
+        }
+        impl->referenceDefinitions.push_back({
+            static_cast<size_t>(def->dest - impl->inputText), std::move(definition)});
+        return 0;
+    }
+    
+    static int lookupRefDef(const MD_CHAR* label, MD_SIZE size, MD_REF_DEF_DETAIL* def, void* userdata) {
+        auto* impl = static_cast<Impl*>(userdata);
+        
+        const auto* entry = impl->references.table->find(label, size);
+        if (!entry) return 0;
+        
+        // A definition from a later block loses against one in this text.
+        if (entry->owner >= impl->references.offset && impl->definesLabel(label, size)) {
+            return 0;
+        }
+        
+        const auto& definition = entry->definition;
+        def->label = definition.label.data();
+        def->label_size = static_cast<MD_SIZE>(definition.label.size());
+        def->dest = definition.destination.data();
+        def->dest_size = static_cast<MD_SIZE>(definition.destination.size());
+        def->title = definition.title.data();
+        def->title_size = static_cast<MD_SIZE>(definition.title.size());
+        return 1;
+    }
+    
+    static int work(unsigned long units, void* userdata) {
+        auto* impl = static_cast<Impl*>(userdata);
+        impl->stats.operations = units;
+        
+        const auto& options = impl->options;
+        if (options.maxOperations > 0 && units > options.maxOperations) {
+            return kBudgetExceeded;
+        }
+        if (options.maxParseTimeMs > 0 && impl->elapsedMs() > options.maxParseTimeMs) {
+            return kBudgetExceeded;
+        }
+        return 0;
+    }
+    
+    static int rawInlines(const MD_LINE_RANGE* lines, MD_SIZE count, void* userdata) {
+        auto* impl = static_cast<Impl*>(userdata);
+        impl->endAnalysisPhase();
+        if (count == 0 || lines[0].beg == lines[count - 1].end) return 0;
+        
+        auto& node = impl->nodeStack.top();
+        node->blockId = static_cast<int>(impl->deferredBlocks.size());
+        node->sourceStart = static_cast<int>(lines[0].beg);
+        node->sourceEnd = static_cast<int>(lines[count - 1].end);
+        impl->deferredBlocks.push_back({node, std::vector<MD_LINE_RANGE>(lines, lines + count),
+                                        node->children.size()});
+        return 0;
     }
     
     static int enterBlock(MD_BLOCKTYPE type, void* detail, void* userdata) {
         auto* impl = static_cast<Impl*>(userdata);
+        if (type != MD_BLOCK_DOC) impl->endAnalysisPhase();
         
         switch (type) {
             case MD_BLOCK_DOC:
                 break;
                 
             case MD_BLOCK_QUOTE: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Blockquote));
+                impl->pushNode(makeNode(NodeType::Blockquote));
                 break;
             }
                 
             case MD_BLOCK_UL: {
-                auto node = std::make_shared<MarkdownNode>(NodeType::List);
+                auto node = makeNode(NodeType::List);
                 node->ordered = false;
                 impl->pushNode(node);
                 break;
@@ -89,7 +449,7 @@ public:
                 
             case MD_BLOCK_OL: {
                 auto* d = static_cast<MD_BLOCK_OL_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::List);
+                auto node = makeNode(NodeType::List);
                 node->ordered = true;
                 node->start = d->start;
                 impl->pushNode(node);
@@ -99,25 +459,24 @@ public:
             case MD_BLOCK_LI: {
                 auto* d = static_cast<MD_BLOCK_LI_DETAIL*>(detail);
                 if (d->is_task) {
-                    auto node = std::make_shared<MarkdownNode>(NodeType::TaskListItem);
+                    auto node = makeNode(NodeType::TaskListItem);
                     node->checked = (d->task_mark == 'x' || d->task_mark == 'X');
                     impl->pushNode(node);
                 } else {
-                    impl->pushNode(std::make_shared<MarkdownNode>(NodeType::ListItem));
+                    impl->pushNode(makeNode(NodeType::ListItem));
                 }
                 break;
             }
                 
             case MD_BLOCK_HR: {
                 impl->flushText();
-                impl->nodeStack.top()->addChild(
-                    std::make_shared<MarkdownNode>(NodeType::HorizontalRule));
+                impl->appendChild(makeNode(NodeType::HorizontalRule));
                 break;
             }
                 
             case MD_BLOCK_H: {
                 auto* d = static_cast<MD_BLOCK_H_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::Heading);
+                auto node = makeNode(NodeType::Heading);
                 node->level = d->level;
                 impl->pushNode(node);
                 break;
@@ -125,47 +484,47 @@ public:
                 
             case MD_BLOCK_CODE: {
                 auto* d = static_cast<MD_BLOCK_CODE_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::CodeBlock);
+                auto node = makeNode(NodeType::CodeBlock);
                 if (d->lang.text && d->lang.size > 0) {
-                    node->language = std::string(d->lang.text, d->lang.size);
+                    node->language = impl->getAttributeText(&d->lang);
                 }
                 impl->pushNode(node);
                 break;
             }
                 
             case MD_BLOCK_HTML: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::HtmlBlock));
+                impl->pushNode(makeNode(NodeType::HtmlBlock));
                 break;
             }
                 
             case MD_BLOCK_P: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Paragraph));
+                impl->pushNode(makeNode(NodeType::Paragraph));
                 break;
             }
                 
             case MD_BLOCK_TABLE: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Table));
+                impl->pushNode(makeNode(NodeType::Table));
                 break;
             }
                 
             case MD_BLOCK_THEAD: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::TableHead));
+                impl->pushNode(makeNode(NodeType::TableHead));
                 break;
             }
                 
             case MD_BLOCK_TBODY: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::TableBody));
+                impl->pushNode(makeNode(NodeType::TableBody));
                 break;
             }
                 
             case MD_BLOCK_TR: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::TableRow));
+                impl->pushNode(makeNode(NodeType::TableRow));
                 break;
             }
                 
             case MD_BLOCK_TH: {
                 auto* d = static_cast<MD_BLOCK_TD_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::TableCell);
+                auto node = makeNode(NodeType::TableCell);
                 node->isHeader = true;
                 switch (d->align) {
                     case MD_ALIGN_LEFT: node->align = TextAlign::Left; break;
@@ -179,7 +538,7 @@ public:
                 
             case MD_BLOCK_TD: {
                 auto* d = static_cast<MD_BLOCK_TD_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::TableCell);
+                auto node = makeNode(NodeType::TableCell);
                 node->isHeader = false;
                 switch (d->align) {
                     case MD_ALIGN_LEFT: node->align = TextAlign::Left; break;
@@ -192,12 +551,25 @@ public:
             }
         }
         
+        switch (type) {
+            case MD_BLOCK_LI:
+            case MD_BLOCK_H:
+            case MD_BLOCK_P:
+            case MD_BLOCK_TH:
+            case MD_BLOCK_TD:
+                impl->beginInlineAnalysis();
+                break;
+            default:
+                break;
+        }
+        
         return 0;
     }
     
     static int leaveBlock(MD_BLOCKTYPE type, void* detail, void* userdata) {
         (void)detail;
         auto* impl = static_cast<Impl*>(userdata);
+        impl->endAnalysisPhase();
         
         switch (type) {
             case MD_BLOCK_DOC:
@@ -213,31 +585,32 @@ public:
     
     static int enterSpan(MD_SPANTYPE type, void* detail, void* userdata) {
         auto* impl = static_cast<Impl*>(userdata);
+        impl->endAnalysisPhase();
         
         switch (type) {
             case MD_SPAN_EM: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Italic));
+                impl->pushNode(makeNode(NodeType::Italic));
                 break;
             }
                 
             case MD_SPAN_STRONG: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Bold));
+                impl->pushNode(makeNode(NodeType::Bold));
                 break;
             }
                 
             case MD_SPAN_DEL: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Strikethrough));
+                impl->pushNode(makeNode(NodeType::Strikethrough));
                 break;
             }
                 
             case MD_SPAN_A: {
                 auto* d = static_cast<MD_SPAN_A_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::Link);
+                auto node = makeNode(NodeType::Link);
                 if (d->href.text && d->href.size > 0) {
-                    node->href = std::string(d->href.text, d->href.size);
+                    node->href = impl->getAttributeText(&d->href);
                 }
                 if (d->title.text && d->title.size > 0) {
-                    node->title = std::string(d->title.text, d->title.size);
+                    node->title = impl->getAttributeText(&d->title);
                 }
                 impl->pushNode(node);
                 break;
@@ -245,39 +618,39 @@ public:
                 
             case MD_SPAN_IMG: {
                 auto* d = static_cast<MD_SPAN_IMG_DETAIL*>(detail);
-                auto node = std::make_shared<MarkdownNode>(NodeType::Image);
+                auto node = makeNode(NodeType::Image);
                 if (d->src.text && d->src.size > 0) {
-                    node->href = std::string(d->src.text, d->src.size);
+                    node->href = impl->getAttributeText(&d->src);
                 }
                 if (d->title.text && d->title.size > 0) {
-                    node->title = std::string(d->title.text, d->title.size);
+                    node->title = impl->getAttributeText(&d->title);
                 }
                 impl->pushNode(node);
                 break;
             }
                 
             case MD_SPAN_CODE: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::CodeInline));
+                impl->pushNode(makeNode(NodeType::CodeInline));
                 break;
             }
                 
             case MD_SPAN_LATEXMATH: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::MathInline));
+                impl->pushNode(makeNode(NodeType::MathInline));
                 break;
             }
                 
             case MD_SPAN_LATEXMATH_DISPLAY: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::MathBlock));
+                impl->pushNode(makeNode(NodeType::MathBlock));
                 break;
             }
                 
             case MD_SPAN_U: {
-                impl->pushNode(std::make_shared<MarkdownNode>(NodeType::Italic));
+                impl->pushNode(makeNode(NodeType::Italic));
                 break;
             }
                 
             case MD_SPAN_WIKILINK: {
-                auto node = std::make_shared<MarkdownNode>(NodeType::Link);
+                auto node = makeNode(NodeType::Link);
                 impl->pushNode(node);
                 break;
             }
@@ -291,16 +664,19 @@ public:
         auto* impl = static_cast<Impl*>(userdata);
 
         if (!impl->nodeStack.empty()) {
+            AllocationScope scope(AllocationCategory::Strings);
             auto currentNode = impl->nodeStack.top();
 
             switch (type) {
                 case MD_SPAN_CODE:
                     currentNode->content = impl->currentText;
+                    if (impl->options.collectStats) impl->countString(*currentNode->content);
                     impl->currentText.clear();
                     break;
 
                 case MD_SPAN_IMG:
                     currentNode->alt = impl->currentText;
+                    if (impl->options.collectStats) impl->countString(*currentNode->alt);
                     impl->currentText.clear();
                     break;
 
@@ -315,37 +691,37 @@ public:
     
     static int text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
         auto* impl = static_cast<Impl*>(userdata);
+        impl->endAnalysisPhase();
 
         if (!text || size == 0) return 0;
+        AllocationScope scope(AllocationCategory::Strings);
 
         switch (type) {
             case MD_TEXT_NULLCHAR:
-                impl->currentText += '\0';
+                HtmlEntities::appendUtf8(impl->currentText, 0xFFFD);
                 break;
                 
             case MD_TEXT_BR:
                 impl->flushText();
-                impl->nodeStack.top()->addChild(
-                    std::make_shared<MarkdownNode>(NodeType::LineBreak));
+                impl->appendChild(makeNode(NodeType::LineBreak));
                 break;
                 
             case MD_TEXT_SOFTBR:
                 impl->flushText();
-                impl->nodeStack.top()->addChild(
-                    std::make_shared<MarkdownNode>(NodeType::SoftBreak));
+                impl->appendChild(makeNode(NodeType::SoftBreak));
                 break;
                 
             case MD_TEXT_HTML:
                 impl->flushText();
                 {
-                    auto node = std::make_shared<MarkdownNode>(NodeType::HtmlInline);
+                    auto node = makeNode(NodeType::HtmlInline);
                     node->content = std::string(text, size);
-                    impl->nodeStack.top()->addChild(node);
+                    impl->appendChild(node);
                 }
                 break;
                 
             case MD_TEXT_ENTITY:
-                impl->currentText.append(text, size);
+                HtmlEntities::appendDecoded(impl->currentText, std::string_view(text, size));
                 break;
                 
             case MD_TEXT_NORMAL:
@@ -365,21 +741,43 @@ MD4CParser::MD4CParser() : impl_(std::make_unique<Impl>()) {}
 MD4CParser::~MD4CParser() = default;
 
 std::shared_ptr<MarkdownNode> MD4CParser::parse(const std::string& markdown, const ParserOptions& options) {
+    return parse(std::string_view(markdown), options, ExternalReferences{});
+}
+
+std::shared_ptr<MarkdownNode> MD4CParser::parse(std::string_view markdown, const ParserOptions& options,
+                                                const ExternalReferences& references) {
+    return parse(markdown, options, references, nullptr);
+}
+
+std::shared_ptr<MarkdownNode> MD4CParser::parse(std::string_view markdown, const ParserOptions& options,
+                                                std::shared_ptr<const void> owner) {
+    return parse(markdown, options, ExternalReferences{}, std::move(owner));
+}
+
+std::shared_ptr<MarkdownNode> MD4CParser::parse(std::string_view markdown, const ParserOptions& options,
+                                                const ExternalReferences& references,
+                                                std::shared_ptr<const void> owner) {
+    NITRO_MARKDOWN_TRACE_SCOPE("parse", static_cast<int64_t>(references.offset));
+    impl_->options = options;
+    impl_->freeShrunkResults();
     impl_->reset();
-    impl_->inputText = markdown.c_str();
+    impl_->resetDeferred();
+    impl_->inputText = markdown.data();
+    impl_->references = references;
+    bool hasExternalReferences = references.table && !references.table->empty();
     
-    unsigned int flags = MD_FLAG_NOHTML;
+    unsigned int flags = MD4CDialect::flags(options.gfm, options.math);
     
-    if (options.gfm) {
-        flags |= MD_FLAG_TABLES;
-        flags |= MD_FLAG_STRIKETHROUGH;
-        flags |= MD_FLAG_TASKLISTS;
-        flags |= MD_FLAG_PERMISSIVEAUTOLINKS;
+    if (options.deferInlines) {
+        flags |= MD_FLAG_NOINLINES;
     }
     
-    if (options.math) {
-        flags |= MD_FLAG_LATEXMATHSPANS;
-    }
+    // Memoized subtrees carry neither block ids nor stats, and external
+    // definitions are not part of their keys. Skipped blocks do no work,
+    // so a budget would cut the parse where earlier parses decide.
+    impl_->memoActive = impl_->blockMemo.enabled() && !options.deferInlines && !options.collectStats &&
+                        !references.table && options.maxOperations == 0 && options.maxParseTimeMs == 0;
+    impl_->memoSeed = ContentHash::combine(ContentHash::kVersion, flags);
     
     MD_PARSER parser = {
         0,
@@ -390,17 +788,182 @@ std::shared_ptr<MarkdownNode> MD4CParser::parse(const std::string& markdown, con
         &Impl::leaveSpan,
         &Impl::text,
         nullptr,
-        nullptr
+        nullptr,
+        &Impl::blockOffset,
+        &Impl::refDef,
+        hasExternalReferences ? &Impl::lookupRefDef : nullptr,
+        &Impl::work,
+        &Impl::rawInlines,
+        impl_->memoActive ? &Impl::skipBlock : nullptr
     };
 
-    md_parse(markdown.c_str(), 
-             static_cast<MD_SIZE>(markdown.size()), 
-             &parser, 
-             impl_.get());
+    int result = MD4CDialect::parse(markdown.data(),
+                                    static_cast<MD_SIZE>(markdown.size()),
+                                    &parser,
+                                    impl_.get());
 
-    impl_->flushText();
+    if (result == Impl::kBudgetExceeded) {
+        impl_->stats.budgetExceeded = true;
+        impl_->fallBackToPlainText(markdown);
+    } else {
+        impl_->flushText();
+        if (result == 0) impl_->memoizePendingBlock();
+    }
+    impl_->pendingChild = SIZE_MAX;
+    impl_->finishStats();
+    impl_->references = ExternalReferences{};
+    
+    if (!impl_->deferredBlocks.empty()) {
+        if (owner) {
+            impl_->deferredOwner = std::move(owner);
+            impl_->deferredSource = markdown;
+        } else {
+            impl_->deferredText.assign(markdown);
+        }
+        for (const auto& entry : impl_->referenceDefinitions) {
+            impl_->deferredReferences.add(entry.owner, entry.definition);
+        }
+    }
+    impl_->applyMemoryPolicy(markdown.size());
     return impl_->root;
 }
 
+std::shared_ptr<MarkdownNode> MD4CParser::parseInlines(int blockId) {
+    auto& blocks = impl_->deferredBlocks;
+    if (blockId < 0 || static_cast<size_t>(blockId) >= blocks.size()) return nullptr;
+    
+    auto& block = blocks[blockId];
+    if (block.materialized) return block.node;
+    block.materialized = true;
+    NITRO_MARKDOWN_TRACE_SCOPE("parseInlines", static_cast<int64_t>(block.lines.front().beg));
+    
+    // Reuse the block callbacks' node stack with the deferred block on top.
+    // Definitions anywhere in the document apply, so none may be shadowed.
+    impl_->stats = ParseStats{};
+    impl_->startTime = std::chrono::steady_clock::now();
+    impl_->blockAnalysisDone = true;
+    impl_->timingPending = impl_->options.collectStats;
+    impl_->inlineStart = impl_->startTime;
+    impl_->currentText.clear();
+    impl_->nodeStack.push(block.node);
+    if (impl_->options.collectStats) impl_->startCounting(impl_->nodeStack.size() - 1);
+    
+    auto& children = block.node->children;
+    std::vector<std::shared_ptr<MarkdownNode>> followingBlocks(children.begin() + block.childIndex, children.end());
+    children.resize(block.childIndex);
+    std::string_view source = impl_->deferredOwner ? impl_->deferredSource : std::string_view(impl_->deferredText);
+    impl_->inputText = source.data();
+    impl_->references = ExternalReferences{&impl_->deferredReferences, SIZE_MAX};
+    
+    MD_PARSER parser = {
+        0,
+        MD4CDialect::flags(impl_->options.gfm, impl_->options.math),
+        &Impl::enterBlock,
+        &Impl::leaveBlock,
+        &Impl::enterSpan,
+        &Impl::leaveSpan,
+        &Impl::text,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        impl_->deferredReferences.empty() ? nullptr : &Impl::lookupRefDef,
+        &Impl::work,
+        nullptr,
+        nullptr
+    };
+    
+    int result = md_parse_inlines(source.data(),
+                                  static_cast<MD_SIZE>(source.size()),
+                                  block.lines.data(),
+                                  static_cast<MD_SIZE>(block.lines.size()),
+                                  &parser,
+                                  impl_.get());
+    
+    if (result == Impl::kBudgetExceeded) {
+        impl_->stats.budgetExceeded = true;
+        impl_->stats.plainTextOffset = block.lines.front().beg;
+        impl_->currentText.clear();
+        children.resize(block.childIndex);
+        
+        std::string text;
+        for (const auto& line : block.lines) {
+            if (!text.empty()) text += '\n';
+            text.append(source.substr(line.beg, line.end - line.beg));
+        }
+        auto textNode = Impl::makeNode(NodeType::Text);
+        textNode->content = std::move(text);
+        impl_->appendChild(std::move(textNode));
+    } else {
+        impl_->flushText();
+    }
+    children.insert(children.end(), followingBlocks.begin(), followingBlocks.end());
+    impl_->finishStats();
+    impl_->references = ExternalReferences{};
+    impl_->nodeStack.pop();
+    return block.node;
+}
+
+const std::vector<size_t>& MD4CParser::lastBlockOffsets() const {
+    return impl_->blockOffsets;
+}
+
+const std::vector<ReferenceDefinitionTable::Entry>& MD4CParser::lastReferenceDefinitions() const {
+    return impl_->referenceDefinitions;
+}
+
+const ParseStats& MD4CParser::lastStats() const {
+    return impl_->stats;
+}
+
+void MD4CParser::releaseTree() {
+    impl_->root.reset();
+    impl_->resetDeferred();
+}
+
+void MD4CParser::setMemoryPolicy(const MemoryPolicy& policy) {
+    impl_->memoryPolicy = policy;
+}
+
+const MemoryPolicy& MD4CParser::memoryPolicy() const {
+    return impl_->memoryPolicy;
+}
+
+void MD4CParser::trim() {
+    impl_->shrink();
+}
+
+BlockMemo& MD4CParser::blockMemo() {
+    return impl_->blockMemo;
+}
+
+MemoryFootprint MD4CParser::memoryFootprint(bool includeTree) const {
+    MemoryFootprint footprint;
+    if (includeTree && impl_->root) {
+        // Memoized blocks are counted with the memo.
+        footprint.addNode(*impl_->root);
+        for (const auto& child : impl_->root->children) {
+            if (!impl_->blockMemo.contains(*child)) footprint.addTree(*child);
+        }
+    }
+    footprint.cacheBytes = impl_->blockMemo.memoryBytes();
+    // Text kept through its owner belongs to the owner, e.g. a mapped file.
+    footprint.inputBytes = MemoryFootprint::heapBytes(impl_->deferredText);
+
+    footprint.scratchBytes = impl_->nodeStack.size() * sizeof(std::shared_ptr<MarkdownNode>) +
+                             MemoryFootprint::heapBytes(impl_->currentText) +
+                             MemoryFootprint::heapBytes(impl_->blockOffsets) +
+                             MemoryFootprint::heapBytes(impl_->referenceDefinitions) +
+                             MemoryFootprint::heapBytes(impl_->deferredBlocks) +
+                             impl_->deferredReferences.memoryBytes();
+    for (const auto& entry : impl_->referenceDefinitions) {
+        footprint.scratchBytes += MemoryFootprint::heapBytes(entry.definition);
+    }
+    for (const auto& block : impl_->deferredBlocks) {
+        footprint.scratchBytes += MemoryFootprint::heapBytes(block.lines);
+    }
+    return footprint;
+}
+
 } // namespace NitroMarkdown
 
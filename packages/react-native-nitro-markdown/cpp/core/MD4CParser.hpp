@@ -1,21 +1,104 @@
 #pragma once
 
+#include "BlockMemo.hpp"
 #include "MarkdownTypes.hpp"
+#include "MemoryAccounting.hpp"
+#include "ReferenceDefinitionTable.hpp"
+#include <climits>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 #include <memory>
 
 namespace NitroMarkdown {
 
+// Link reference definitions known outside of the text being parsed, e.g.
+// from the rest of a document when only part of it is reparsed.
+struct ExternalReferences {
+    const ReferenceDefinitionTable* table = nullptr;
+    // Position of the parsed text within the document the table describes.
+    // Definitions owned by earlier blocks take precedence over the text's own.
+    size_t offset = 0;
+};
+
+// When a parser gives back the working buffers a large input made it grow.
+// md4c's own buffers are freed after every parse anyway; this covers the
+// ones the parser keeps for the next call.
+struct MemoryPolicy {
+    // Buffers left above this by a parse are shrunk right after it. 0 never.
+    size_t highWaterBytes = 1u << 20;
+    // Buffers above this are shrunk once shrinkAfterSmallParses parses in a
+    // row had less than a quarter of the input they were grown for. 0 never.
+    size_t baselineBytes = 64u << 10;
+    size_t shrinkAfterSmallParses = 8;
+};
+
 class MD4CParser {
 public:
+    // Bump whenever a change makes the tree differ for some input, so that
+    // trees persisted by an earlier version are not used.
+    static constexpr uint32_t kOutputVersion = 2;
+    // Largest input parse() handles: md4c takes 32-bit sizes and source
+    // offsets are ints. Callers check longer input, e.g. a mapped file.
+    static constexpr size_t kMaxInputSize = INT_MAX;
+
     MD4CParser();
     ~MD4CParser();
     std::shared_ptr<MarkdownNode> parse(const std::string& markdown, const ParserOptions& options);
+    std::shared_ptr<MarkdownNode> parse(std::string_view markdown, const ParserOptions& options,
+                                        const ExternalReferences& references);
+    // Parses text that owner keeps alive, e.g. a MappedFile's. With
+    // deferInlines the parser holds on to owner for parseInlines() instead
+    // of copying the text.
+    std::shared_ptr<MarkdownNode> parse(std::string_view markdown, const ParserOptions& options,
+                                        std::shared_ptr<const void> owner);
+
+    // Source offsets of the root's children from the last parse, one per child.
+    const std::vector<size_t>& lastBlockOffsets() const;
+    // Link reference definitions found in the text of the last parse; each
+    // entry's owner is the source offset of the definition's destination.
+    const std::vector<ReferenceDefinitionTable::Entry>& lastReferenceDefinitions() const;
+    // Work and time spent by the last parse and whether it hit a budget from
+    // ParserOptions; if so, the input from plainTextOffset on is a plain paragraph.
+    // With ParserOptions::collectStats also the phase timings and tree shape.
+    const ParseStats& lastStats() const;
+
+    // Materializes the inline children of a block the last parse deferred
+    // (ParserOptions::deferInlines) and returns that block, or nullptr for an
+    // unknown id. Calling it again for the same block is a no-op.
+    std::shared_ptr<MarkdownNode> parseInlines(int blockId);
+
+    // Memory the parser keeps between calls. The tree of the last parse is
+    // left out with includeTree = false, for owners that account for it
+    // themselves, e.g. because they keep its subtrees.
+    MemoryFootprint memoryFootprint(bool includeTree = true) const;
+    // Lets go of the tree of the last parse and of the blocks it deferred,
+    // keeping only the working buffers, e.g. before the parser is lent to
+    // another document.
+    void releaseTree();
+
+    // Applied after every parse.
+    void setMemoryPolicy(const MemoryPolicy& policy);
+    const MemoryPolicy& memoryPolicy() const;
+    // Shrinks the working buffers to what the results of the last parse
+    // still use, e.g. on memory pressure. The tree stays valid; the next
+    // parse starts from empty buffers.
+    void trim();
+
+    // Top-level blocks of earlier parses; a later parse takes the subtree of
+    // every block whose source is unchanged from here instead of building it.
+    // Such subtrees are shared between the results, so callers must not
+    // modify them. Disabled until given a capacity, and not consulted with
+    // deferInlines, collectStats or external references.
+    BlockMemo& blockMemo();
     
 private:
+    std::shared_ptr<MarkdownNode> parse(std::string_view markdown, const ParserOptions& options,
+                                        const ExternalReferences& references, std::shared_ptr<const void> owner);
+
     class Impl;
     std::unique_ptr<Impl> impl_;
 };
 
 } // namespace NitroMarkdown
-
@@ -0,0 +1,1207 @@
+// Micro-benchmarks for the native parser. Build with
+//   cmake -S cpp -B build/cpp-bench -DCMAKE_BUILD_TYPE=Release
+//   cmake --build build/cpp-bench --target MD4CParserBench
+// and run ./build/cpp-bench/MD4CParserBench [iterations] [--json] [--stream file] [--counters].
+//
+// The phase suite times md4c alone, the full MD4CParser::parse (md4c plus
+// AST building) and JSON serialization over corpora from 1 KB to 10 MB.
+// The streaming suite replays token streams append by append, through a full
+// reparse of the whole text (what <MarkdownStream> does today) and through
+// MarkdownSessionCore. --stream replays a recorded stream instead of the
+// synthetic ones: one JSON string literal per line, one line per chunk.
+// --json prints only the two suites, as one JSON document on stdout.
+//
+// --trace out.json [--trace-input doc.md] skips the suites and writes a Chrome
+// trace (see Tracer.hpp) of one parse and serialization of doc.md, or of the
+// 1 MiB corpus; open it in chrome://tracing or https://ui.perfetto.dev.
+//
+// The last tables parse a conversation's worth of messages with BatchParser
+// on 1 to N threads, replay 8 concurrent streams, one of them fast, through
+// sessions of their own and through a SessionHost, compare forking a
+// session with copying its text into a new one, measure the memory
+// compact() saves in long sessions and the cost of reading cold blocks,
+// measure what converting a JS string to UTF-8 costs next to parsing it, the
+// most a UTF-16 entry point could save, and mapping deferred source ranges
+// back to string indices, compare parsing a file from a MappedFile with reading it into a string, and rendering HTML
+// straight from md4c with building the AST and its JSON for JS to walk.
+//
+// --counters (Linux only) skips the suites and reads hardware performance
+// counters (perf_event_open) around each phase instead: cycles, instructions,
+// branch misses, L1 data and last-level cache misses, reported as IPC and
+// events per KB of input. Needs kernel.perf_event_paranoid <= 2 and a PMU the
+// kernel exposes; counters it does not support are shown as "-".
+
+#include "AllocationCounter.hpp"
+#include "BatchParser.hpp"
+#include "HtmlEntities.hpp"
+#include "MD4CParser.hpp"
+#include "MappedFile.hpp"
+#include "MarkdownHtmlRenderer.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include "MarkdownSessionCore.hpp"
+#include "SessionHost.hpp"
+#include "TaskScheduler.hpp"
+#include "Tracer.hpp"
+#include "Utf16.hpp"
+#include "../md4c/md4c.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace NitroMarkdown {
+
+class Bench {
+public:
+    // Runs a and b `iterations` times each after one warm-up run, alternating
+    // between them so that frequency scaling and noisy neighbours affect both
+    // sides equally. Returns the median time of a single run in milliseconds.
+    template <typename FnA, typename FnB>
+    static std::pair<double, double> interleavedMedianMs(int iterations, FnA&& a, FnB&& b) {
+        a();
+        b();
+        std::vector<double> samplesA, samplesB;
+        samplesA.reserve(iterations);
+        samplesB.reserve(iterations);
+        for (int i = 0; i < iterations; i++) {
+            samplesA.push_back(timeMs(a));
+            samplesB.push_back(timeMs(b));
+        }
+        return {median(samplesA), median(samplesB)};
+    }
+
+    template <typename Fn>
+    static double timeMs(Fn&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        fn();
+        auto end = std::chrono::steady_clock::now();
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    template <typename Fn>
+    static std::vector<double> sampleMs(int iterations, Fn&& fn) {
+        fn();
+        std::vector<double> samples;
+        samples.reserve(iterations);
+        for (int i = 0; i < iterations; i++) {
+            samples.push_back(timeMs(fn));
+        }
+        std::sort(samples.begin(), samples.end());
+        return samples;
+    }
+
+    static double median(std::vector<double>& samples) {
+        std::sort(samples.begin(), samples.end());
+        return samples[samples.size() / 2];
+    }
+
+    // Nearest-rank percentile of already sorted samples.
+    static double percentile(const std::vector<double>& sorted, double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p / 100.0 * sorted.size()));
+        return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+    }
+
+    static double megabytesPerSecond(size_t bytes, double ms) {
+        return ms > 0 ? (bytes / (1024.0 * 1024.0)) / (ms / 1000.0) : 0;
+    }
+};
+
+// Per-thread hardware counters for the code between start() and stop().
+// Each counter is its own event rather than one group, so that the kernel can
+// multiplex them when the PMU has fewer slots; values are scaled by the share
+// of time each was actually counting.
+class HardwareCounters {
+public:
+    enum Counter { Cycles, Instructions, BranchMisses, L1DMisses, LLCMisses, kCounterCount };
+
+    struct Values {
+        double value[kCounterCount] = {};
+        bool valid[kCounterCount] = {};
+    };
+
+    HardwareCounters() {
+#ifdef __linux__
+        const std::pair<uint32_t, uint64_t> events[kCounterCount] = {
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+            {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+            {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                                     (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        };
+        for (int i = 0; i < kCounterCount; i++) {
+            perf_event_attr attr = {};
+            attr.size = sizeof(attr);
+            attr.type = events[i].first;
+            attr.config = events[i].second;
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+            if (fds_[i] < 0 && error_.empty()) error_ = std::strerror(errno);
+        }
+#else
+        error_ = "perf_event_open is Linux only";
+#endif
+    }
+
+    ~HardwareCounters() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    bool anyAvailable() const {
+        for (int fd : fds_) {
+            if (fd >= 0) return true;
+        }
+        return false;
+    }
+
+    // Why the first counter that failed to open did, or empty if all opened.
+    const std::string& error() const { return error_; }
+
+    void start() {
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    Values stop() {
+        Values values;
+#ifdef __linux__
+        for (int fd : fds_) {
+            if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (int i = 0; i < kCounterCount; i++) {
+            uint64_t data[3];  // value, time enabled, time running
+            if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != sizeof(data) || data[2] == 0) continue;
+            values.value[i] = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+            values.valid[i] = true;
+        }
+#endif
+        return values;
+    }
+
+private:
+    int fds_[kCounterCount] = {-1, -1, -1, -1, -1};
+    std::string error_;
+};
+
+class MD4CParserBench {
+public:
+    static int writeTrace(const char* outputPath, const char* inputPath) {
+        if (!Tracer::kEnabled) {
+            std::fprintf(stderr, "Built without NITRO_MARKDOWN_TRACE\n");
+            return 1;
+        }
+        std::string text = makeCorpus(1 << 20);
+        if (inputPath) {
+            std::ifstream input(inputPath, std::ios::binary);
+            if (!input) {
+                std::fprintf(stderr, "Cannot read %s\n", inputPath);
+                return 1;
+            }
+            text.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+        }
+
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        Tracer::start();
+        MarkdownJsonSerializer::toJson(parser.parse(text, options));
+        Tracer::stop();
+
+        std::ofstream output(outputPath, std::ios::binary);
+        output << Tracer::toJson();
+        if (!output) {
+            std::fprintf(stderr, "Cannot write %s\n", outputPath);
+            return 1;
+        }
+        std::printf("Wrote %zu trace events for %zu bytes to %s\n", Tracer::eventCount(), text.size(), outputPath);
+        return 0;
+    }
+
+    static int runCounters(int iterations, bool json) {
+        HardwareCounters counters;
+        if (!counters.anyAvailable()) {
+            std::fprintf(stderr, "No hardware counters: %s (see kernel.perf_event_paranoid)\n",
+                         counters.error().c_str());
+            return 1;
+        }
+        if (!counters.error().empty()) {
+            std::fprintf(stderr, "Some hardware counters are unavailable: %s\n", counters.error().c_str());
+        }
+
+        const size_t sizes[] = {10 << 10, 100 << 10, 1 << 20, 10 << 20};
+        ParserOptions options{true, true};
+        std::vector<CounterResult> results;
+        for (size_t size : sizes) {
+            std::string corpus = makeCorpus(size);
+            int runs = std::max(iterations, static_cast<int>(std::min<size_t>(200, (16u << 20) / size)));
+            if (size >= (10u << 20)) runs = std::max(3, iterations / 4);
+
+            MD4CParser parser;
+            auto ast = parser.parse(corpus, options);
+            // Averages over `runs` runs, each counted on its own so that the
+            // harness between runs stays out of the numbers.
+            auto measure = [&](const char* phase, auto&& fn) {
+                fn();
+                CounterResult result{size, phase, runs, {}};
+                for (int run = 0; run < runs; run++) {
+                    counters.start();
+                    fn();
+                    auto values = counters.stop();
+                    for (int i = 0; i < HardwareCounters::kCounterCount; i++) {
+                        result.values.value[i] += values.value[i] / runs;
+                        result.values.valid[i] = values.valid[i];
+                    }
+                }
+                results.push_back(result);
+            };
+            measure("md4c", [&] {
+                parseWithNoopCallbacks(&md_parse_gfm_math, corpus, MD_SPECIALIZED_FLAGS_GFM_MATH);
+            });
+            measure("parse", [&] { parser.parse(corpus, options); });
+            ast = parser.parse(corpus, options);
+            measure("json", [&] { MarkdownJsonSerializer::toJson(ast); });
+        }
+
+        if (json) {
+            printCountersJson(results);
+        } else {
+            printCountersTable(results);
+        }
+        return 0;
+    }
+
+    static void runAll(int iterations, bool json, const char* streamPath) {
+        auto results = benchPhases(iterations);
+        auto streams = benchStreaming(streamPath);
+        if (json) {
+            printJson(results, streams);
+            return;
+        }
+        printPhasesTable(results);
+        printAllocationBreakdown(1 << 20);
+        printStreamingTable(streams);
+
+        std::string corpus = makeCorpus(1 << 20);
+        std::printf("Corpus: %zu bytes, %d iterations (median)\n\n", corpus.size(), iterations);
+
+        benchSpecializedVariants(corpus, iterations);
+        benchDeferredInlines(corpus, iterations);
+        benchCollectStats(corpus, iterations);
+        benchBatch(iterations);
+        benchConcurrentSessions();
+        benchFork(iterations);
+        benchCompaction(iterations);
+        benchUtf16Offsets(corpus, iterations);
+        benchMappedFile(iterations);
+        benchHtmlRender(corpus, iterations);
+    }
+
+private:
+    struct PhaseResult {
+        size_t bytes;
+        size_t nodes;
+        const char* phase;
+        int samples;
+        double p50Ms, p90Ms, p99Ms, minMs, maxMs;
+        // For one run; zero unless built with NITRO_MARKDOWN_ALLOC_STATS.
+        size_t allocations, allocatedBytes;
+    };
+
+    struct CounterResult {
+        size_t bytes;
+        const char* phase;
+        int runs;
+        // Per run.
+        HardwareCounters::Values values;
+    };
+
+    static void printCountersTable(const std::vector<CounterResult>& results) {
+        using C = HardwareCounters;
+        std::printf("Hardware counters per phase, averaged per run; ast = parse - md4c\n");
+        std::printf("%10s %-6s %5s %10s %10s %6s %12s %12s %12s\n", "bytes", "phase", "runs", "cycles/B",
+                    "insns/B", "IPC", "br-miss/KB", "L1d-miss/KB", "LLC-miss/KB");
+        auto cell = [](const C::Values& v, int counter, double scale, const char* format) {
+            char buffer[32];
+            if (!v.valid[counter]) return std::string("-");
+            std::snprintf(buffer, sizeof(buffer), format, v.value[counter] * scale);
+            return std::string(buffer);
+        };
+        auto printRow = [&](size_t bytes, const char* phase, const char* runs, const C::Values& v) {
+            double perByte = 1.0 / bytes;
+            double perKB = 1024.0 / bytes;
+            std::string ipc = "-";
+            if (v.valid[C::Cycles] && v.valid[C::Instructions] && v.value[C::Cycles] > 0) {
+                char buffer[32];
+                std::snprintf(buffer, sizeof(buffer), "%.2f", v.value[C::Instructions] / v.value[C::Cycles]);
+                ipc = buffer;
+            }
+            std::printf("%10zu %-6s %5s %10s %10s %6s %12s %12s %12s\n", bytes, phase, runs,
+                        cell(v, C::Cycles, perByte, "%.2f").c_str(), cell(v, C::Instructions, perByte, "%.2f").c_str(),
+                        ipc.c_str(), cell(v, C::BranchMisses, perKB, "%.1f").c_str(),
+                        cell(v, C::L1DMisses, perKB, "%.1f").c_str(), cell(v, C::LLCMisses, perKB, "%.2f").c_str());
+        };
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto& r = results[i];
+            printRow(r.bytes, r.phase, std::to_string(r.runs).c_str(), r.values);
+            if (i > 0 && std::strcmp(r.phase, "parse") == 0) {
+                C::Values ast = r.values;
+                for (int c = 0; c < C::kCounterCount; c++) {
+                    ast.value[c] = std::max(0.0, r.values.value[c] - results[i - 1].values.value[c]);
+                    ast.valid[c] = r.values.valid[c] && results[i - 1].values.valid[c];
+                }
+                printRow(r.bytes, "ast", "", ast);
+            }
+        }
+        std::printf("\n");
+    }
+
+    static void printCountersJson(const std::vector<CounterResult>& results) {
+        static const char* const keys[HardwareCounters::kCounterCount] = {"cycles", "instructions", "branchMisses",
+                                                                           "l1dMisses", "llcMisses"};
+        std::printf("{\"corpus\":\"mixed\",\"counters\":[");
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto& r = results[i];
+            std::printf("%s\n{\"bytes\":%zu,\"phase\":\"%s\",\"runs\":%d", i > 0 ? "," : "", r.bytes, r.phase, r.runs);
+            // Per run; null when the counter is unavailable.
+            for (int c = 0; c < HardwareCounters::kCounterCount; c++) {
+                if (r.values.valid[c]) {
+                    std::printf(",\"%s\":%.0f", keys[c], r.values.value[c]);
+                } else {
+                    std::printf(",\"%s\":null", keys[c]);
+                }
+            }
+            std::printf("}");
+        }
+        std::printf("\n]}\n");
+    }
+
+    template <typename Fn>
+    static AllocationCounts countAllocations(Fn&& fn) {
+        auto before = AllocationCounter::snapshot();
+        fn();
+        return AllocationCounter::snapshot() - before;
+    }
+
+    struct StreamResult {
+        std::string stream;
+        const char* mode;
+        size_t finalBytes;
+        size_t appends;
+        double p50Ms, p99Ms, maxMs;
+        // Sum of the per-append latencies, and process CPU time for the replay.
+        double totalMs, cpuMs;
+    };
+
+    // A mix of the constructs chat and documentation output typically uses,
+    // repeated and cut to exactly `size` bytes.
+    static std::string makeCorpus(size_t size) {
+        static const char* chunk =
+            "## Section heading\n\n"
+            "Some **bold** and *italic* text with `inline code`, a [link](https://example.com) "
+            "and an autolink https://example.com/path?q=1. Math like $e^{i\\pi} + 1 = 0$ "
+            "and ~~removed~~ words &amp; entities.\n\n"
+            "- first item with **emphasis**\n"
+            "- [x] finished task\n"
+            "  - nested item with `code`\n\n"
+            "| Name | Value |\n|:-----|------:|\n| alpha | 1 |\n| beta | 2 |\n\n"
+            "```ts\nconst answer = 42;\nconsole.log(answer);\n```\n\n"
+            "> Quoted text that spans\n> two lines.\n\n";
+        std::string corpus;
+        while (corpus.size() < size) corpus += chunk;
+        corpus.resize(size);
+        return corpus;
+    }
+
+    static size_t countNodes(const MarkdownNode& node) {
+        size_t count = 1;
+        for (const auto& child : node.children) count += countNodes(*child);
+        return count;
+    }
+
+    static std::vector<PhaseResult> benchPhases(int iterations) {
+        const size_t sizes[] = {1 << 10, 10 << 10, 100 << 10, 1 << 20, 10 << 20};
+        ParserOptions options{true, true};
+        std::vector<PhaseResult> results;
+
+        for (size_t size : sizes) {
+            std::string corpus = makeCorpus(size);
+            // Small corpora get more samples so that their tail percentiles
+            // mean something; large ones are capped to keep the run short.
+            int samples = std::max(iterations, static_cast<int>(std::min<size_t>(1000, (32u << 20) / size)));
+            if (size >= (10u << 20)) samples = std::max(5, iterations / 4);
+
+            MD4CParser parser;
+            auto ast = parser.parse(corpus, options);
+            size_t nodes = countNodes(*ast);
+
+            auto record = [&](const char* phase, auto&& fn) {
+                auto allocations = countAllocations(fn);
+                auto sorted = Bench::sampleMs(samples, fn);
+                results.push_back({size, nodes, phase, samples,
+                                   Bench::percentile(sorted, 50), Bench::percentile(sorted, 90),
+                                   Bench::percentile(sorted, 99), sorted.front(), sorted.back(),
+                                   allocations.totalCount(), allocations.totalBytes()});
+            };
+            record("md4c", [&] {
+                parseWithNoopCallbacks(&md_parse_gfm_math, corpus, MD_SPECIALIZED_FLAGS_GFM_MATH);
+            });
+            record("parse", [&] { parser.parse(corpus, options); });
+            ast = parser.parse(corpus, options);
+            record("json", [&] { MarkdownJsonSerializer::toJson(ast); });
+        }
+        return results;
+    }
+
+    static void printPhasesTable(const std::vector<PhaseResult>& results) {
+        std::printf("Phases: md4c = tokenizing only, parse = md4c + AST, json = serialization\n");
+        std::printf("%10s %8s %-6s %7s %10s %10s %10s %10s %9s %9s\n", "bytes", "nodes", "phase", "samples",
+                    "p50 ms", "p90 ms", "p99 ms", "MB/s", "ns/node", "allocs");
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto& r = results[i];
+            std::printf("%10zu %8zu %-6s %7d %10.3f %10.3f %10.3f %10.1f %9.1f %9zu\n", r.bytes, r.nodes, r.phase,
+                        r.samples, r.p50Ms, r.p90Ms, r.p99Ms, Bench::megabytesPerSecond(r.bytes, r.p50Ms),
+                        r.p50Ms * 1e6 / r.nodes, r.allocations);
+            // AST building alone, from the medians of the two phases that bracket it.
+            if (i > 0 && std::strcmp(r.phase, "parse") == 0) {
+                double astMs = std::max(0.0, r.p50Ms - results[i - 1].p50Ms);
+                std::printf("%10s %8s %-6s %7s %10.3f %10s %10s %10.1f %9.1f\n", "", "", "ast", "", astMs, "", "",
+                            Bench::megabytesPerSecond(r.bytes, astMs), astMs * 1e6 / r.nodes);
+            }
+        }
+        std::printf("\n");
+    }
+
+    static void printAllocationBreakdown(size_t size) {
+        if (!AllocationCounter::kEnabled) return;
+
+        std::string corpus = makeCorpus(size);
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        std::shared_ptr<MarkdownNode> ast;
+        auto counts = countAllocations([&] { ast = parser.parse(corpus, options); });
+        auto serialized = countAllocations([&] { MarkdownJsonSerializer::toJson(ast); });
+
+        std::printf("Allocations for one parse + serialization of %zu bytes\n", corpus.size());
+        std::printf("%-12s %10s %14s\n", "category", "count", "bytes");
+        for (size_t i = 0; i < kAllocationCategoryCount; i++) {
+            std::printf("%-12s %10zu %14zu\n", AllocationCounter::categoryName(static_cast<AllocationCategory>(i)),
+                        counts.count[i] + serialized.count[i], counts.bytes[i] + serialized.bytes[i]);
+        }
+        std::printf("\n");
+    }
+
+    // An assistant-style answer whose lists, code fences and tables grow over
+    // the course of the stream, cut to exactly `size` bytes.
+    static std::string makeStreamDocument(size_t size) {
+        std::string doc;
+        for (int step = 1; doc.size() < size; step++) {
+            std::string n = std::to_string(step);
+            doc += "## Step " + n + "\n\n";
+            doc += "Let's look at **part " + n + "** of the answer, using `helper_" + n +
+                   "()` as described in the [docs](https://example.com/docs/" + n + ").\n\n";
+            doc += "1. First point\n2. Second point with *emphasis*\n   - nested detail\n"
+                   "   - another detail with `code`\n3. Third point\n\n";
+            doc += "```python\ndef helper_" + n + "(values):\n";
+            for (int line = 0; line < 6; line++) {
+                doc += "    values = [v * " + std::to_string(line + step) + " for v in values]\n";
+            }
+            doc += "    return values\n```\n\n";
+            doc += "| Case | Input | Result |\n|:-----|------:|:------:|\n";
+            for (int row = 0; row < 5; row++) {
+                doc += "| case " + std::to_string(row) + " | " + std::to_string(row * step) + " | ok |\n";
+            }
+            doc += "\n> **Note:** results are cached after the first call.\n\n";
+        }
+        doc.resize(size);
+        return doc;
+    }
+
+    // Splits text the way LLM output arrives: mostly one or two tokens per
+    // chunk, sometimes a burst of several. Fixed seed, so runs are comparable.
+    static std::vector<std::string> chunkLikeTokenStream(const std::string& text, uint32_t seed) {
+        std::vector<std::string> chunks;
+        uint32_t state = seed;
+        auto next = [&] {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        };
+        for (size_t offset = 0; offset < text.size();) {
+            uint32_t bucket = next() % 100;
+            size_t length = bucket < 70 ? 1 + next() % 6 : bucket < 95 ? 7 + next() % 18 : 25 + next() % 56;
+            length = std::min(length, text.size() - offset);
+            chunks.push_back(text.substr(offset, length));
+            offset += length;
+        }
+        return chunks;
+    }
+
+    // One JSON string literal per line; anything else is skipped.
+    static std::vector<std::string> readRecordedStream(const char* path) {
+        std::vector<std::string> chunks;
+        std::ifstream file(path);
+        std::string line;
+        while (std::getline(file, line)) {
+            size_t begin = line.find('"');
+            if (begin == std::string::npos) continue;
+            std::string chunk;
+            for (size_t i = begin + 1; i < line.size() && line[i] != '"'; i++) {
+                if (line[i] != '\\' || i + 1 >= line.size()) {
+                    chunk += line[i];
+                    continue;
+                }
+                char escape = line[++i];
+                switch (escape) {
+                    case 'n': chunk += '\n'; break;
+                    case 't': chunk += '\t'; break;
+                    case 'r': chunk += '\r'; break;
+                    case 'b': chunk += '\b'; break;
+                    case 'f': chunk += '\f'; break;
+                    case 'u': {
+                        uint32_t codepoint = std::strtoul(line.substr(i + 1, 4).c_str(), nullptr, 16);
+                        i += 4;
+                        if (codepoint >= 0xD800 && codepoint < 0xDC00 && line.compare(i + 1, 2, "\\u") == 0) {
+                            uint32_t low = std::strtoul(line.substr(i + 3, 4).c_str(), nullptr, 16);
+                            codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                            i += 6;
+                        }
+                        HtmlEntities::appendUtf8(chunk, codepoint);
+                        break;
+                    }
+                    default: chunk += escape; break;
+                }
+            }
+            chunks.push_back(std::move(chunk));
+        }
+        return chunks;
+    }
+
+    template <typename Fn>
+    static StreamResult replay(const std::string& name, const char* mode, const std::vector<std::string>& chunks,
+                               Fn&& onAppend) {
+        std::vector<double> latencies;
+        latencies.reserve(chunks.size());
+        size_t bytes = 0;
+        std::clock_t cpuStart = std::clock();
+        for (const auto& chunk : chunks) {
+            bytes += chunk.size();
+            latencies.push_back(Bench::timeMs([&] { onAppend(chunk); }));
+        }
+        double cpuMs = 1000.0 * static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+        double totalMs = 0;
+        for (double latency : latencies) totalMs += latency;
+        std::sort(latencies.begin(), latencies.end());
+        return {name, mode, bytes, chunks.size(), Bench::percentile(latencies, 50),
+                Bench::percentile(latencies, 99), latencies.back(), totalMs, cpuMs};
+    }
+
+    static std::vector<StreamResult> benchStreaming(const char* streamPath) {
+        std::vector<std::pair<std::string, std::vector<std::string>>> streams;
+        if (streamPath) {
+            streams.emplace_back(streamPath, readRecordedStream(streamPath));
+        } else {
+            for (size_t size : {2u << 10, 8u << 10, 32u << 10}) {
+                streams.emplace_back("synthetic-" + std::to_string(size >> 10) + "k",
+                                     chunkLikeTokenStream(makeStreamDocument(size), 0x9E3779B9u));
+            }
+        }
+
+        ParserOptions options{true, true};
+        std::vector<StreamResult> results;
+        for (const auto& [name, chunks] : streams) {
+            if (chunks.empty()) continue;
+
+            MD4CParser parser;
+            std::string text;
+            results.push_back(replay(name, "full", chunks, [&](const std::string& chunk) {
+                text += chunk;
+                MarkdownJsonSerializer::toJson(parser.parse(text, options));
+            }));
+
+            MarkdownSessionCore session(options);
+            results.push_back(replay(name, "session", chunks, [&](const std::string& chunk) {
+                session.append(chunk);
+                session.document();
+            }));
+
+            MarkdownSessionCore serializedSession(options);
+            results.push_back(replay(name, "session+json", chunks, [&](const std::string& chunk) {
+                serializedSession.append(chunk);
+                MarkdownJsonSerializer::toJson(serializedSession.document());
+            }));
+        }
+        return results;
+    }
+
+    static void printStreamingTable(const std::vector<StreamResult>& results) {
+        std::printf("Streaming: per-append latency; full = reparse + serialize the whole text per append\n");
+        std::printf("%-16s %-13s %8s %7s %9s %9s %9s %10s %10s %9s\n", "stream", "mode", "bytes", "appends",
+                    "p50 ms", "p99 ms", "max ms", "total ms", "cpu ms", "ms/KB");
+        for (const auto& r : results) {
+            // Flat ms/KB across stream sizes means linear total cost; growth
+            // proportional to size means every append redoes the whole text.
+            std::printf("%-16s %-13s %8zu %7zu %9.4f %9.4f %9.3f %10.1f %10.1f %9.3f\n", r.stream.c_str(), r.mode,
+                        r.finalBytes, r.appends, r.p50Ms, r.p99Ms, r.maxMs, r.totalMs, r.cpuMs,
+                        r.totalMs / (r.finalBytes / 1024.0));
+        }
+        std::printf("\n");
+    }
+
+    static void printJson(const std::vector<PhaseResult>& results, const std::vector<StreamResult>& streams) {
+        std::printf("{\"corpus\":\"mixed\",\"results\":[");
+        for (size_t i = 0; i < results.size(); i++) {
+            const auto& r = results[i];
+            std::printf("%s\n{\"bytes\":%zu,\"nodes\":%zu,\"phase\":\"%s\",\"samples\":%d,"
+                        "\"p50Ms\":%.6f,\"p90Ms\":%.6f,\"p99Ms\":%.6f,\"minMs\":%.6f,\"maxMs\":%.6f,"
+                        "\"mbPerSec\":%.3f,\"nsPerNode\":%.3f,\"allocations\":%zu,\"allocatedBytes\":%zu}",
+                        i > 0 ? "," : "", r.bytes, r.nodes, r.phase, r.samples, r.p50Ms, r.p90Ms, r.p99Ms, r.minMs,
+                        r.maxMs, Bench::megabytesPerSecond(r.bytes, r.p50Ms), r.p50Ms * 1e6 / r.nodes,
+                        r.allocations, r.allocatedBytes);
+        }
+        std::printf("\n],\"streaming\":[");
+        for (size_t i = 0; i < streams.size(); i++) {
+            const auto& r = streams[i];
+            std::string name;
+            MarkdownJsonSerializer::appendEscaped(name, r.stream);
+            std::printf("%s\n{\"stream\":\"%s\",\"mode\":\"%s\",\"bytes\":%zu,\"appends\":%zu,"
+                        "\"p50Ms\":%.6f,\"p99Ms\":%.6f,\"maxMs\":%.6f,\"totalMs\":%.3f,\"cpuMs\":%.3f}",
+                        i > 0 ? "," : "", name.c_str(), r.mode, r.finalBytes, r.appends, r.p50Ms, r.p99Ms,
+                        r.maxMs, r.totalMs, r.cpuMs);
+        }
+        std::printf("\n]}\n");
+    }
+
+    using ParseFn = int (*)(const MD_CHAR*, MD_SIZE, const MD_PARSER*, void*);
+
+    static int parseWithNoopCallbacks(ParseFn parseFn, const std::string& text, unsigned flags) {
+        MD_PARSER parser = {};
+        parser.flags = flags;
+        parser.enter_block = [](MD_BLOCKTYPE, void*, void*) { return 0; };
+        parser.leave_block = [](MD_BLOCKTYPE, void*, void*) { return 0; };
+        parser.enter_span = [](MD_SPANTYPE, void*, void*) { return 0; };
+        parser.leave_span = [](MD_SPANTYPE, void*, void*) { return 0; };
+        parser.text = [](MD_TEXTTYPE, const MD_CHAR*, MD_SIZE, void*) { return 0; };
+        return parseFn(text.data(), static_cast<MD_SIZE>(text.size()), &parser, nullptr);
+    }
+
+    static void benchSpecializedVariants(const std::string& corpus, int iterations) {
+        struct Variant {
+            const char* name;
+            ParseFn parseFn;
+            unsigned flags;
+        };
+        const Variant variants[] = {
+            {"GFM + math", &md_parse_gfm_math, MD_SPECIALIZED_FLAGS_GFM_MATH},
+            {"GFM", &md_parse_gfm, MD_SPECIALIZED_FLAGS_GFM},
+            {"CommonMark", &md_parse_commonmark, MD_SPECIALIZED_FLAGS_COMMONMARK},
+        };
+
+        std::printf("md4c: specialized builds vs generic md_parse()\n");
+        std::printf("%-12s %12s %12s %10s\n", "dialect", "generic", "specialized", "speedup");
+        for (const auto& variant : variants) {
+            auto [generic, specialized] = Bench::interleavedMedianMs(
+                iterations,
+                [&] { parseWithNoopCallbacks(&md_parse, corpus, variant.flags); },
+                [&] { parseWithNoopCallbacks(variant.parseFn, corpus, variant.flags); });
+            std::printf("%-12s %9.1f MB/s %9.1f MB/s %9.2fx\n", variant.name,
+                        Bench::megabytesPerSecond(corpus.size(), generic),
+                        Bench::megabytesPerSecond(corpus.size(), specialized),
+                        specialized > 0 ? generic / specialized : 0);
+        }
+        std::printf("\n");
+    }
+
+    static void benchDeferredInlines(const std::string& corpus, int iterations) {
+        // Separate parsers, so that each side only pays for freeing its own trees.
+        MD4CParser fullParser;
+        MD4CParser deferredParser;
+        ParserOptions full{true, true};
+        ParserOptions deferred = full;
+        deferred.deferInlines = true;
+
+        auto [fullMs, blocksMs] = Bench::interleavedMedianMs(
+            iterations,
+            [&] { fullParser.parse(corpus, full); },
+            [&] { deferredParser.parse(corpus, deferred); });
+
+        std::printf("MD4CParser: full parse vs blocks only (deferInlines)\n");
+        std::printf("%-12s %9.1f MB/s\n", "full", Bench::megabytesPerSecond(corpus.size(), fullMs));
+        std::printf("%-12s %9.1f MB/s %9.2fx\n", "blocks only",
+                    Bench::megabytesPerSecond(corpus.size(), blocksMs), blocksMs > 0 ? fullMs / blocksMs : 0);
+        std::printf("\n");
+    }
+
+    static void benchBatch(int iterations) {
+        // A long conversation: 400 messages of 0.5 to 8 KB.
+        std::vector<std::string> messages;
+        size_t totalBytes = 0;
+        for (size_t i = 0; i < 400; i++) {
+            messages.push_back(makeStreamDocument(512u << (i % 5)));
+            totalBytes += messages.back().size();
+        }
+        ParserOptions options{true, true};
+        auto run = [&](const BatchParser& batch) {
+            std::vector<BatchParser::Document> documents;
+            documents.reserve(messages.size());
+            for (const auto& message : messages) documents.push_back({message});
+            batch.parse(documents, options);
+        };
+
+        size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        std::printf("BatchParser: %zu messages, %zu bytes; %zu hardware threads\n", messages.size(), totalBytes,
+                    hardware);
+        std::printf("%-8s %12s %10s %9s\n", "threads", "throughput", "ms", "speedup");
+        double single = 0;
+        // Its own scheduler, so that every row can have as many threads as it
+        // asks for whatever the hardware.
+        TaskScheduler scheduler(BatchParser::kMaxThreads - 1);
+        for (size_t threads = 1; threads <= BatchParser::kMaxThreads; threads++) {
+            BatchParser batch(threads, scheduler);
+            auto samples = Bench::sampleMs(iterations, [&] { run(batch); });
+            double ms = Bench::percentile(samples, 50);
+            if (threads == 1) single = ms;
+            std::printf("%-8zu %7.1f MB/s %10.2f %8.2fx\n", threads, Bench::megabytesPerSecond(totalBytes, ms), ms,
+                        ms > 0 ? single / ms : 0);
+        }
+        std::printf("\n");
+    }
+
+    static void benchConcurrentSessions() {
+        // Eight answers streamed side by side; stream 0 delivers 8 chunks per
+        // tick, the others one.
+        constexpr size_t kStreams = 8;
+        constexpr size_t kFastChunks = 8;
+        const auto tick = std::chrono::microseconds(500);
+        std::vector<std::vector<std::string>> streams;
+        size_t totalBytes = 0;
+        for (size_t i = 0; i < kStreams; i++) {
+            std::string text = makeStreamDocument(8u << 10);
+            totalBytes += text.size();
+            streams.push_back(chunkLikeTokenStream(text, 0x9E3779B9u + static_cast<uint32_t>(i)));
+        }
+        ParserOptions options{true, true};
+
+        using Clock = std::chrono::steady_clock;
+        struct Latencies {
+            std::mutex mutex;
+            // First append not yet reflected in a published tree.
+            std::optional<Clock::time_point> pendingSince;
+            std::vector<double> ms;
+        };
+        struct Row {
+            const char* mode;
+            size_t updates;
+            double slowP50, slowP99, fastP50, fastP99;
+            size_t parsers;
+            size_t memoryBytes;
+        };
+
+        // Calls append(stream, chunk) on schedule and returns the latencies.
+        auto replayAll = [&](auto&& append, std::vector<Latencies>& latencies) {
+            std::vector<size_t> next(kStreams, 0);
+            auto deadline = Clock::now();
+            for (bool more = true; more;) {
+                more = false;
+                for (size_t i = 0; i < kStreams; i++) {
+                    for (size_t c = 0; c < (i == 0 ? kFastChunks : 1) && next[i] < streams[i].size(); c++) {
+                        {
+                            std::lock_guard<std::mutex> lock(latencies[i].mutex);
+                            if (!latencies[i].pendingSince) latencies[i].pendingSince = Clock::now();
+                        }
+                        append(i, streams[i][next[i]++]);
+                    }
+                    more = more || next[i] < streams[i].size();
+                }
+                deadline += tick;
+                std::this_thread::sleep_until(deadline);
+            }
+        };
+        auto published = [](Latencies& latencies) {
+            std::lock_guard<std::mutex> lock(latencies.mutex);
+            if (!latencies.pendingSince) return;
+            latencies.ms.push_back(
+                std::chrono::duration<double, std::milli>(Clock::now() - *latencies.pendingSince).count());
+            latencies.pendingSince.reset();
+        };
+        auto makeRow = [](const char* mode, std::vector<Latencies>& latencies, size_t parsers, size_t memoryBytes) {
+            std::vector<double> slow;
+            for (size_t i = 1; i < latencies.size(); i++) {
+                slow.insert(slow.end(), latencies[i].ms.begin(), latencies[i].ms.end());
+            }
+            std::vector<double>& fast = latencies[0].ms;
+            std::sort(slow.begin(), slow.end());
+            std::sort(fast.begin(), fast.end());
+            return Row{mode, slow.size() + fast.size(), Bench::percentile(slow, 50), Bench::percentile(slow, 99),
+                       Bench::percentile(fast, 50), Bench::percentile(fast, 99), parsers, memoryBytes};
+        };
+
+        std::vector<Row> rows;
+        {
+            // Every session with its own parser, updated on the calling thread.
+            std::vector<Latencies> latencies(kStreams);
+            std::vector<std::unique_ptr<MarkdownSessionCore>> sessions;
+            for (size_t i = 0; i < kStreams; i++) sessions.push_back(std::make_unique<MarkdownSessionCore>(options));
+            replayAll(
+                [&](size_t i, const std::string& chunk) {
+                    sessions[i]->append(chunk);
+                    sessions[i]->document();
+                    published(latencies[i]);
+                },
+                latencies);
+            size_t memoryBytes = 0;
+            for (const auto& session : sessions) memoryBytes += session->memoryFootprint().total();
+            rows.push_back(makeRow("own", latencies, kStreams, memoryBytes));
+        }
+        {
+            std::vector<Latencies> latencies(kStreams);
+            SessionHost host;
+            std::vector<SessionHost::SessionId> ids;
+            for (size_t i = 0; i < kStreams; i++) {
+                auto listener = [&, i](SessionHost::SessionId, const std::shared_ptr<MarkdownNode>&) {
+                    published(latencies[i]);
+                };
+                ids.push_back(host.open(options, listener));
+            }
+            replayAll([&](size_t i, const std::string& chunk) { host.append(ids[i], chunk); }, latencies);
+            host.flush();
+            auto stats = host.stats();
+            rows.push_back(makeRow("host", latencies, stats.parsers,
+                                   stats.treeBytes + stats.textBytes + stats.parserBytes));
+        }
+
+        std::printf("Concurrent sessions: %zu streams, %zu bytes, stream 0 appends %zux per %lld us tick; "
+                    "%zu scheduler workers\n",
+                    kStreams, totalBytes, kFastChunks, static_cast<long long>(tick.count()),
+                    TaskScheduler::shared().threads());
+        std::printf("%-6s %8s %12s %12s %12s %12s %8s %10s\n", "mode", "updates", "slow p50 ms", "slow p99 ms",
+                    "fast p50 ms", "fast p99 ms", "parsers", "memory KB");
+        for (const auto& row : rows) {
+            std::printf("%-6s %8zu %12.3f %12.3f %12.3f %12.3f %8zu %10.1f\n", row.mode, row.updates, row.slowP50,
+                        row.slowP99, row.fastP50, row.fastP99, row.parsers, row.memoryBytes / 1024.0);
+        }
+        std::printf("latency: from an append to the first tree that includes it; host memory leaves out "
+                    "per-session block tables\n\n");
+    }
+
+    static void benchFork(int iterations) {
+        // "Regenerate from here": branch a conversation, then stream a short
+        // answer into the branch.
+        ParserOptions options{true, true};
+        const std::string answer = "\n\nA regenerated answer with **bold** text.\n";
+        std::printf("Session fork vs copy: fork = snapshot + new session; copy = new session with the text\n");
+        std::printf("%10s %12s %14s %12s %14s\n", "bytes", "fork ms", "fork+update ms", "copy ms",
+                    "copy+update ms");
+        for (size_t size : {10u << 10, 100u << 10, 1u << 20}) {
+            MarkdownSessionCore session(options);
+            session.append(makeStreamDocument(size));
+            session.document();
+
+            auto fork = Bench::sampleMs(iterations, [&] { MarkdownSessionCore branch(session.snapshot()); });
+            auto forkUpdate = Bench::sampleMs(iterations, [&] {
+                MarkdownSessionCore branch(session.snapshot());
+                branch.append(answer);
+                branch.document();
+            });
+            auto copy = Bench::sampleMs(iterations, [&] {
+                MarkdownSessionCore branch(options);
+                branch.append(*session.text());
+            });
+            auto copyUpdate = Bench::sampleMs(iterations, [&] {
+                MarkdownSessionCore branch(options);
+                branch.append(*session.text());
+                branch.append(answer);
+                branch.document();
+            });
+            std::printf("%10zu %12.4f %14.4f %12.4f %14.4f\n", size, Bench::percentile(fork, 50),
+                        Bench::percentile(forkUpdate, 50), Bench::percentile(copy, 50),
+                        Bench::percentile(copyUpdate, 50));
+        }
+        std::printf("\n");
+    }
+
+    static void benchCompaction(int iterations) {
+        // A transcript that has run for hours: everything but the last
+        // kDefaultHotBytes is history.
+        ParserOptions options{true, true};
+        std::printf("Session compaction: memory before and after compact(), and reading 20 cold blocks\n");
+        std::printf("%10s %12s %12s %12s %14s\n", "bytes", "before KB", "after KB", "compact ms", "cold read ms");
+        for (size_t size : {1u << 20, 8u << 20}) {
+            std::string text = makeStreamDocument(size);
+            MarkdownSessionCore session(options);
+            session.append(text);
+            session.document();
+            size_t before = session.memoryFootprint().total();
+            auto start = std::chrono::steady_clock::now();
+            session.compact();
+            double compactMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            size_t after = session.memoryFootprint().total();
+
+            // Alternating between two chunks decompresses one on every read.
+            size_t middle = session.coldBlockCount() / 2;
+            bool far = false;
+            auto read = Bench::sampleMs(iterations, [&] {
+                size_t begin = far ? 0 : middle;
+                far = !far;
+                session.coldBlocks(begin, begin + 20);
+            });
+            std::printf("%10zu %12.0f %12.0f %12.2f %14.4f\n", size, before / 1024.0, after / 1024.0, compactMs,
+                        Bench::percentile(read, 50));
+        }
+        std::printf("\n");
+    }
+
+    static void benchUtf16Offsets(const std::string& asciiCorpus, int iterations) {
+        static const char* cjk =
+            "## \u898b\u51fa\u3057\u306e\u30bb\u30af\u30b7\u30e7\u30f3\n\n"
+            "\u65e5\u672c\u8a9e\u306e**\u592a\u5b57**\u3068*\u659c\u4f53*\u306e\u6587\u7ae0\u3001`\u30b3\u30fc\u30c9`"
+            "\u3068[\u30ea\u30f3\u30af](https://example.com/\u30d1\u30b9)\u3002\u4e2d\u6587\u6bb5\u843d\u5305\u542b"
+            "**\u7c97\u4f53**\u548c~~\u5220\u9664\u7ebf~~\u6587\u5b57\uff0c\u4ee5\u53ca\u6570\u5b66 $x^2$\u3002\n\n"
+            "- \u6700\u521d\u306e\u9805\u76ee\n- [x] \u5b8c\u4e86\u3057\u305f\u30bf\u30b9\u30af\n\n"
+            "| \u540d\u524d | \u5024 |\n|:--|--:|\n| \u30a2\u30eb\u30d5\u30a1 | \u4e00 |\n\n"
+            "> \u5f15\u7528\u3055\u308c\u305f\u6587\u7ae0\u3067\u3059\u3002\n\n";
+        static const char* emoji =
+            "## \U0001F680 Launch notes \U0001F389\n\n"
+            "\U0001F30D **Big** \U0001F600 news \U0001F525 with *style* \u2728 and `code` \U0001F4BB "
+            "\U0001F44D\U0001F44D\U0001F44D [link \U0001F517](https://example.com) \U0001F64C\n\n"
+            "- \U0001F34E apple\n- [x] \u2705 done \U0001F3AF\n\n"
+            "| \U0001F436 | \U0001F431 |\n|--|--|\n| \U0001F98A | \U0001F43B |\n\n"
+            "> \U0001F4AC quoted \U0001F602\U0001F923\n\n";
+        auto repeat = [&](const char* chunk) {
+            std::string text;
+            while (text.size() < asciiCorpus.size()) text += chunk;
+            return text;
+        };
+        struct Corpus {
+            const char* name;
+            std::string text;
+        };
+        const Corpus corpora[] = {{"ASCII", asciiCorpus}, {"CJK", repeat(cjk)}, {"emoji", repeat(emoji)}};
+
+        // Nitro hands a JS string to the binding as a std::string, converted
+        // to UTF-8 by the JS engine, so md4c never sees the UTF-16 text;
+        // with deferInlines the binding maps the byte offsets of deferred
+        // blocks back to UTF-16 indices. The conversion is timed here on a
+        // UTF-16 copy of each corpus: it is what a UTF-16 entry point would
+        // save at most, and the mapping is what parsing UTF-8 adds.
+        auto toUtf16 = [](const std::string& text) {
+            std::u16string out;
+            for (size_t i = 0; i < text.size();) {
+                auto byte = static_cast<unsigned char>(text[i]);
+                size_t length = byte < 0x80 ? 1 : byte < 0xE0 ? 2 : byte < 0xF0 ? 3 : 4;
+                uint32_t cp = length == 1 ? byte : byte & (0x7F >> length);
+                for (size_t k = 1; k < length; k++) cp = (cp << 6) | (static_cast<unsigned char>(text[i + k]) & 0x3F);
+                if (cp >= 0x10000) {
+                    out += static_cast<char16_t>(0xD800 + ((cp - 0x10000) >> 10));
+                    out += static_cast<char16_t>(0xDC00 + ((cp - 0x10000) & 0x3FF));
+                } else {
+                    out += static_cast<char16_t>(cp);
+                }
+                i += length;
+            }
+            return out;
+        };
+        auto toUtf8 = [](const std::u16string& text, std::string& out) {
+            out.clear();
+            for (size_t i = 0; i < text.size(); i++) {
+                uint32_t cp = text[i];
+                if (cp >= 0xD800 && cp < 0xDC00 && i + 1 < text.size()) {
+                    cp = 0x10000 + ((cp - 0xD800) << 10) + (text[++i] - 0xDC00);
+                }
+                if (cp < 0x80) {
+                    out += static_cast<char>(cp);
+                } else if (cp < 0x800) {
+                    out += static_cast<char>(0xC0 | (cp >> 6));
+                    out += static_cast<char>(0x80 | (cp & 0x3F));
+                } else if (cp < 0x10000) {
+                    out += static_cast<char>(0xE0 | (cp >> 12));
+                    out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (cp & 0x3F));
+                } else {
+                    out += static_cast<char>(0xF0 | (cp >> 18));
+                    out += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                    out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                    out += static_cast<char>(0x80 | (cp & 0x3F));
+                }
+            }
+        };
+
+        ParserOptions options{true, true};
+        options.deferInlines = true;
+        std::printf("JS string input with deferInlines: UTF-16 to UTF-8 conversion and offset mapping vs the parse\n");
+        std::printf("%-8s %10s %12s %12s %12s %14s\n", "corpus", "KB", "parse ms", "convert ms", "map ms",
+                    "convert/parse");
+        for (const auto& corpus : corpora) {
+            std::u16string utf16 = toUtf16(corpus.text);
+            std::string utf8;
+            MD4CParser parser;
+            auto root = parser.parse(corpus.text, options);
+            auto parse = Bench::sampleMs(iterations, [&] { parser.parse(corpus.text, options); });
+            auto convert = Bench::sampleMs(iterations, [&] { toUtf8(utf16, utf8); });
+            root = parser.parse(corpus.text, options);
+            size_t last = 0;
+            auto map = Bench::sampleMs(iterations, [&] {
+                Utf16::OffsetMap offsets(corpus.text);
+                for (const auto& block : root->children) {
+                    if (block->sourceEnd) last += offsets(static_cast<size_t>(*block->sourceEnd));
+                }
+            });
+            double parseMs = Bench::percentile(parse, 50);
+            double convertMs = Bench::percentile(convert, 50);
+            std::printf("%-8s %10zu %12.2f %12.2f %12.2f %13.1f%%\n", corpus.name, corpus.text.size() / 1024,
+                        parseMs, convertMs, Bench::percentile(map, 50), parseMs > 0 ? convertMs / parseMs * 100 : 0);
+            if (utf8 != corpus.text || last == 0) std::printf("  (conversion or mapping check failed)\n");
+        }
+        std::printf("\n");
+    }
+
+    static void benchMappedFile(int iterations) {
+        std::string path = (std::filesystem::temp_directory_path() / "nitro-markdown-bench.md").string();
+        ParserOptions options{true, true};
+        options.deferInlines = true;
+        std::printf("File input with deferInlines: read into a string vs parse the mapping (page cache warm)\n");
+        std::printf("%-10s %12s %12s %9s %14s %14s\n", "KB", "read ms", "mapped ms", "saved", "read kept KB",
+                    "mapped kept KB");
+        for (size_t size : {size_t(64) << 10, size_t(1) << 20, size_t(10) << 20}) {
+            std::string corpus = makeCorpus(size);
+            {
+                std::ofstream file(path, std::ios::binary | std::ios::trunc);
+                file << corpus;
+            }
+            MD4CParser readParser;
+            MD4CParser mappedParser;
+            auto [readMs, mappedMs] = Bench::interleavedMedianMs(
+                iterations,
+                [&] {
+                    std::ifstream file(path, std::ios::binary);
+                    std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+                    readParser.parse(text, options);
+                },
+                [&] {
+                    auto file = MappedFile::open(path);
+                    mappedParser.parse(file->text(), options, file);
+                });
+            std::printf("%-10zu %12.2f %12.2f %8.1f%% %14zu %14zu\n", corpus.size() / 1024, readMs, mappedMs,
+                        readMs > 0 ? (1 - mappedMs / readMs) * 100 : 0,
+                        readParser.memoryFootprint().inputBytes / 1024,
+                        mappedParser.memoryFootprint().inputBytes / 1024);
+        }
+        std::remove(path.c_str());
+        std::printf("\n");
+    }
+
+    static void benchHtmlRender(const std::string& corpus, int iterations) {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        std::string json;
+        std::string html;
+        auto [astMs, htmlMs] = Bench::interleavedMedianMs(
+            iterations,
+            [&] { json = MarkdownJsonSerializer::toJson(parser.parse(corpus, options)); },
+            [&] { html = *MarkdownHtmlRenderer::render(corpus); });
+        auto astAllocations = countAllocations([&] { MarkdownJsonSerializer::toJson(parser.parse(corpus, options)); });
+        auto htmlAllocations = countAllocations([&] { MarkdownHtmlRenderer::render(corpus); });
+
+        std::printf("HTML output: AST + JSON (for a JS renderer) vs rendering from md4c callbacks\n");
+        std::printf("%-12s %10s %9s %12s %12s\n", "path", "ms", "MB/s", "allocations", "output KB");
+        std::printf("%-12s %10.2f %9.1f %12zu %12zu\n", "AST + JSON", astMs, Bench::megabytesPerSecond(corpus.size(), astMs),
+                    astAllocations.totalCount(), json.size() / 1024);
+        std::printf("%-12s %10.2f %9.1f %12zu %12zu\n", "HTML", htmlMs, Bench::megabytesPerSecond(corpus.size(), htmlMs),
+                    htmlAllocations.totalCount(), html.size() / 1024);
+        std::printf("\n");
+    }
+
+    static void benchCollectStats(const std::string& corpus, int iterations) {
+        MD4CParser plainParser;
+        MD4CParser statsParser;
+        ParserOptions plain{true, true};
+        ParserOptions withStats = plain;
+        withStats.collectStats = true;
+
+        auto [plainMs, statsMs] = Bench::interleavedMedianMs(
+            iterations,
+            [&] { plainParser.parse(corpus, plain); },
+            [&] { statsParser.parse(corpus, withStats); });
+
+        const auto& stats = statsParser.lastStats();
+        std::printf("MD4CParser: collectStats overhead\n");
+        std::printf("%-12s %9.1f MB/s\n", "off", Bench::megabytesPerSecond(corpus.size(), plainMs));
+        std::printf("%-12s %9.1f MB/s %+8.1f%%\n", "on", Bench::megabytesPerSecond(corpus.size(), statsMs),
+                    plainMs > 0 ? (statsMs / plainMs - 1) * 100 : 0);
+        std::printf("last: blocks %.2f ms, inlines %.2f ms, AST %.2f ms, %zu nodes, depth %zu, ~%zu allocations\n",
+                    stats.blockAnalysisMs, stats.inlineAnalysisMs, stats.astBuildMs, stats.nodeCount,
+                    stats.maxDepth, stats.estimatedAllocations);
+        std::printf("\n");
+    }
+};
+
+} // namespace NitroMarkdown
+
+int main(int argc, char** argv) {
+    int iterations = 20;
+    bool json = false;
+    const char* streamPath = nullptr;
+    const char* tracePath = nullptr;
+    const char* traceInput = nullptr;
+    bool counters = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--json") == 0) {
+            json = true;
+        } else if (std::strcmp(argv[i], "--stream") == 0 && i + 1 < argc) {
+            streamPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc) {
+            tracePath = argv[++i];
+        } else if (std::strcmp(argv[i], "--trace-input") == 0 && i + 1 < argc) {
+            traceInput = argv[++i];
+        } else if (std::strcmp(argv[i], "--counters") == 0) {
+            counters = true;
+        } else {
+            iterations = std::max(1, std::atoi(argv[i]));
+        }
+    }
+    if (tracePath) {
+        return NitroMarkdown::MD4CParserBench::writeTrace(tracePath, traceInput);
+    }
+    if (counters) {
+        return NitroMarkdown::MD4CParserBench::runCounters(iterations, json);
+    }
+    NitroMarkdown::MD4CParserBench::runAll(iterations, json, streamPath);
+    return 0;
+}
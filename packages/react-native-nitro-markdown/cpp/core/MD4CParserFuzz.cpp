@@ -0,0 +1,388 @@
+// Fuzz harness for MD4CParser::parse and MarkdownJsonSerializer. With Clang,
+//   cmake -S cpp -B build/cpp-fuzz -DNITRO_MARKDOWN_FUZZ=ON -DCMAKE_C_COMPILER=clang -DCMAKE_CXX_COMPILER=clang++
+//   cmake --build build/cpp-fuzz --target MD4CParserFuzz
+//   ./build/cpp-fuzz/MD4CParserFuzz cpp/fuzz/corpus -max_len=4096
+// builds a libFuzzer binary with AddressSanitizer. Without that option the
+// same target is a standalone driver:
+//   ./MD4CParserFuzz [file or directory ...] [--random count] [--seed n]
+// replays the given inputs and `count` generated markdown-like ones.
+//
+// Each input is parsed with options taken from its first byte, serialized,
+// and the JSON checked for well-formedness. Inputs between kMinScaledInput
+// and kMaxScaledInput bytes are also parsed repeated kBaseRepeat times and
+// kScale times that; if the longer text costs more than kMaxGrowth times as
+// much per input byte, in md4c work units, allocated bytes, memory high-water
+// or (above kMinTimedMs) time, the input is reported and the process aborts,
+// so that the fuzzer saves it as a crash. Comparing two repetitions rather
+// than the input itself keeps structure that only forms across copies, e.g.
+// emphasis pairing up, from counting as growth.
+//
+// A parser with a block memo that lives across inputs also parses each input
+// and the input twice over; its output has to match a fresh parser's.
+//
+// Each tree is also encoded as an AstCacheFile record; the record's JSON and
+// the tree decoded from it have to match the tree's own JSON.
+//
+// The input is also rendered to HTML, where every '<' has to open or close
+// one of the tags the renderer writes; anything else came from the input.
+
+#include "AllocationCounter.hpp"
+#include "AstCacheFile.hpp"
+#include "MD4CParser.hpp"
+#include "MarkdownHtmlRenderer.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NitroMarkdown {
+
+namespace {
+
+constexpr size_t kMinScaledInput = 16;
+constexpr size_t kMaxScaledInput = 4096;
+constexpr size_t kBaseRepeat = 4;
+constexpr size_t kScale = 8;
+constexpr double kMaxGrowth = 4.0;
+constexpr double kMinTimedMs = 5.0;
+
+struct Cost {
+    size_t operations = 0;
+    size_t allocatedBytes = 0;
+    int64_t peakBytes = 0;
+    double ms = 0;
+};
+
+// Minimal JSON grammar check; the serializer's output has no whitespace.
+class JsonValidator {
+public:
+    explicit JsonValidator(const std::string& json) : s_(json) {}
+
+    bool valid() {
+        return value(0) && pos_ == s_.size();
+    }
+
+private:
+    static constexpr int kMaxNesting = 100000;
+
+    bool value(int depth) {
+        if (depth > kMaxNesting || pos_ >= s_.size()) return false;
+        switch (s_[pos_]) {
+            case '{': return object(depth);
+            case '[': return array(depth);
+            case '"': return string();
+            case 't': return literal("true");
+            case 'f': return literal("false");
+            case 'n': return literal("null");
+            default: return number();
+        }
+    }
+
+    bool object(int depth) {
+        pos_++;
+        if (consume('}')) return true;
+        do {
+            if (pos_ >= s_.size() || s_[pos_] != '"' || !string() || !consume(':') || !value(depth + 1)) {
+                return false;
+            }
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool array(int depth) {
+        pos_++;
+        if (consume(']')) return true;
+        do {
+            if (!value(depth + 1)) return false;
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool string() {
+        pos_++;
+        while (pos_ < s_.size()) {
+            unsigned char c = static_cast<unsigned char>(s_[pos_++]);
+            if (c == '"') return true;
+            if (c < 0x20) return false;
+            if (c != '\\') continue;
+            if (pos_ >= s_.size()) return false;
+            char escape = s_[pos_++];
+            if (escape == 'u') {
+                for (int i = 0; i < 4; i++) {
+                    if (pos_ >= s_.size() || !std::isxdigit(static_cast<unsigned char>(s_[pos_++]))) return false;
+                }
+            } else if (!std::strchr("\"\\/bfnrt", escape)) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool number() {
+        size_t start = pos_;
+        consume('-');
+        while (pos_ < s_.size() && (std::isdigit(static_cast<unsigned char>(s_[pos_])) ||
+                                    std::strchr(".eE+-", s_[pos_]))) {
+            pos_++;
+        }
+        return pos_ > start && std::isdigit(static_cast<unsigned char>(s_[pos_ - 1]));
+    }
+
+    bool literal(const char* word) {
+        size_t length = std::strlen(word);
+        if (s_.compare(pos_, length, word) != 0) return false;
+        pos_ += length;
+        return true;
+    }
+
+    bool consume(char c) {
+        if (pos_ < s_.size() && s_[pos_] == c) {
+            pos_++;
+            return true;
+        }
+        return false;
+    }
+
+    const std::string& s_;
+    size_t pos_ = 0;
+};
+
+[[noreturn]] void fail(const char* what, const std::string& input) {
+    std::fprintf(stderr, "MD4CParserFuzz: %s (input of %zu bytes)\n", what, input.size());
+    std::abort();
+}
+
+// Parses and serializes text with a fresh parser, materializing deferred
+// blocks, and checks the output.
+Cost run(const std::string& text, const ParserOptions& options) {
+    Cost cost;
+    AllocationCounter::resetPeak();
+    AllocationCounts before = AllocationCounter::snapshot();
+    auto start = std::chrono::steady_clock::now();
+
+    MD4CParser parser;
+    auto root = parser.parse(text, options);
+    if (!root) fail("parse returned no tree", text);
+    cost.operations = parser.lastStats().operations;
+    if (options.deferInlines) {
+        for (const auto& block : root->children) {
+            if (block->blockId && !parser.parseInlines(*block->blockId)) {
+                fail("parseInlines rejected a block id of the last parse", text);
+            }
+        }
+    }
+    std::string json = MarkdownJsonSerializer::toJson(root);
+
+    cost.ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    AllocationCounts used = AllocationCounter::snapshot() - before;
+    cost.allocatedBytes = used.totalBytes();
+    cost.peakBytes = used.peakBytes - before.liveBytes;
+
+    if (!JsonValidator(json).valid()) fail("serializer produced invalid JSON", text);
+    return cost;
+}
+
+// Per-byte growth of `scaled` over `base`; floor keeps tiny costs from
+// turning noise into large ratios.
+double growth(double base, double scaled, double floor) {
+    return scaled / (static_cast<double>(kScale) * std::max(base, floor));
+}
+
+std::string repeat(const std::string& text, size_t times) {
+    std::string repeated;
+    repeated.reserve(text.size() * times);
+    for (size_t i = 0; i < times; i++) repeated += text;
+    return repeated;
+}
+
+void checkScaling(const std::string& input, const ParserOptions& options) {
+    std::string text = repeat(input, kBaseRepeat);
+    std::string scaledText = repeat(text, kScale);
+
+    // Best of three for the timings; the other metrics are deterministic.
+    Cost base = run(text, options);
+    Cost scaled = run(scaledText, options);
+    for (int i = 0; i < 2; i++) {
+        base.ms = std::min(base.ms, run(text, options).ms);
+        scaled.ms = std::min(scaled.ms, run(scaledText, options).ms);
+    }
+
+    double bytes = static_cast<double>(text.size());
+    struct Metric {
+        const char* name;
+        double growth;
+    } metrics[] = {
+        {"operations", growth(base.operations, scaled.operations, bytes / 16)},
+        {"allocated bytes", growth(base.allocatedBytes, scaled.allocatedBytes, 16 * bytes)},
+        {"peak memory", growth(static_cast<double>(base.peakBytes), static_cast<double>(scaled.peakBytes), 16 * bytes)},
+        {"time", scaled.ms >= kMinTimedMs ? growth(base.ms, scaled.ms, 0.01) : 0},
+    };
+    for (const Metric& metric : metrics) {
+        if (metric.growth <= kMaxGrowth) continue;
+        std::fprintf(stderr,
+                     "MD4CParserFuzz: superlinear %s: %zu bytes repeated %zux and %zux cost %.1fx as much per byte "
+                     "(operations %zu -> %zu, allocated %zu -> %zu B, peak %lld -> %lld B, %.2f -> %.2f ms)\n",
+                     metric.name, input.size(), kBaseRepeat, kBaseRepeat * kScale, metric.growth,
+                     base.operations, scaled.operations, base.allocatedBytes, scaled.allocatedBytes, static_cast<long long>(base.peakBytes),
+                     static_cast<long long>(scaled.peakBytes), base.ms, scaled.ms);
+        std::abort();
+    }
+}
+
+// Blocks taken from the memo must serialize exactly like freshly built ones.
+void checkBlockMemo(const std::string& text, const ParserOptions& options) {
+    static MD4CParser memoParser;
+    memoParser.blockMemo().setCapacity(BlockMemo::kDefaultCapacityBytes);
+
+    for (const std::string& variant : {text, text + "\n\n" + text}) {
+        std::string expected = MarkdownJsonSerializer::toJson(MD4CParser().parse(variant, options));
+        auto root = memoParser.parse(variant, options);
+        if (MarkdownJsonSerializer::toJson(root, &memoParser.blockMemo()) != expected) {
+            fail("memoized blocks differ from a fresh parse", variant);
+        }
+    }
+}
+
+// Records read back from the cache file must serialize like the tree.
+void checkAstRecord(const std::string& text, const ParserOptions& options) {
+    auto root = MD4CParser().parse(text, options);
+    std::string expected = MarkdownJsonSerializer::toJson(root);
+    std::string record = AstCacheFile::encode(*root);
+    std::string json;
+    if (!AstCacheFile::appendJson(json, record) || json != expected) {
+        fail("JSON of the cache record differs from the tree's", text);
+    }
+    if (MarkdownJsonSerializer::toJson(AstCacheFile::decode(record)) != expected) {
+        fail("tree decoded from the cache record differs", text);
+    }
+}
+
+void checkHtml(const std::string& text, const ParserOptions& options) {
+    static const std::string_view kTags[] = {
+        "a", "blockquote", "br", "code", "del", "em", "h1", "h2", "h3", "h4", "h5", "h6", "hr", "img",
+        "input", "li", "ol", "p", "pre", "span", "strong", "table", "tbody", "td", "th", "thead", "tr", "u", "ul",
+    };
+    HtmlRenderOptions htmlOptions;
+    htmlOptions.gfm = options.gfm;
+    htmlOptions.math = options.math;
+    // Rendering has no deferred inlines; the bit picks heading anchors instead.
+    htmlOptions.headingAnchors = options.deferInlines;
+    auto rendered = MarkdownHtmlRenderer::render(text, htmlOptions);
+    if (!rendered) fail("HTML rendering failed", text);
+    const std::string& html = *rendered;
+    for (size_t at = html.find('<'); at != std::string::npos; at = html.find('<', at + 1)) {
+        size_t begin = at + 1 + (at + 1 < html.size() && html[at + 1] == '/');
+        size_t end = html.find_first_of(" >", begin);
+        std::string_view name = std::string_view(html).substr(begin, end == std::string::npos ? 0 : end - begin);
+        if (std::find(std::begin(kTags), std::end(kTags), name) == std::end(kTags)) {
+            fail("HTML output has a tag the renderer does not write", text);
+        }
+    }
+}
+
+int testOneInput(const uint8_t* data, size_t size) {
+    if (size == 0) return 0;
+    ParserOptions options;
+    options.gfm = data[0] & 1;
+    options.math = data[0] & 2;
+    options.deferInlines = data[0] & 4;
+    std::string text(reinterpret_cast<const char*>(data) + 1, size - 1);
+
+    if (text.size() >= kMinScaledInput && text.size() <= kMaxScaledInput) {
+        checkScaling(text, options);
+    } else {
+        run(text, options);
+    }
+    if (!options.deferInlines) checkBlockMemo(text, options);
+    checkAstRecord(text, options);
+    checkHtml(text, options);
+    return 0;
+}
+
+} // namespace
+
+} // namespace NitroMarkdown
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    return NitroMarkdown::testOneInput(data, size);
+}
+
+#ifndef NITRO_MARKDOWN_LIBFUZZER
+
+namespace {
+
+const char* const kFragments[] = {
+    "*", "**", "_", "__", "~", "~~", "`", "```", "$", "$$", "[", "]", "(", ")", "![", "<", ">", "|", "-",
+    "+", "#", "1.", "2)", "\\", "&amp;", "&#x41;", "<div>", "</div>", "<a href=\"x\">", "http://a.b",
+    "[x]: /u", "[ ]", "[x]", ":", "\"", "'", "!", "\n", "\n\n", " ", "   ", "    ", "\t", "a", "word",
+    "|---|", ":-:", "\xc3\xa9", "\xf0\x9f\x98\x80",
+};
+
+uint64_t nextRandom(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+std::string randomInput(uint64_t& state) {
+    std::string input(1, static_cast<char>(nextRandom(state) & 0xff));
+    size_t fragments = nextRandom(state) % 400;
+    for (size_t i = 0; i < fragments; i++) {
+        input += kFragments[nextRandom(state) % std::size(kFragments)];
+    }
+    return input;
+}
+
+bool replayFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        std::fprintf(stderr, "cannot read %s\n", path.string().c_str());
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t randomCount = 0;
+    uint64_t seed = 0x9e3779b97f4a7c15ull;
+    size_t replayed = 0;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--random") == 0 && i + 1 < argc) {
+            randomCount = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            seed = std::strtoull(argv[++i], nullptr, 10) | 1;
+        } else if (std::filesystem::is_directory(argv[i])) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(argv[i])) {
+                if (!entry.is_regular_file()) continue;
+                if (!replayFile(entry.path())) return 1;
+                replayed++;
+            }
+        } else {
+            if (!replayFile(argv[i])) return 1;
+            replayed++;
+        }
+    }
+    for (size_t i = 0; i < randomCount; i++) {
+        std::string input = randomInput(seed);
+        LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(input.data()), input.size());
+    }
+    std::printf("MD4CParserFuzz: %zu files and %zu generated inputs passed\n", replayed, randomCount);
+    return 0;
+}
+
+#endif
@@ -1,9 +1,38 @@
+#include "AllocationCounter.hpp"
+#include "AstCacheFile.hpp"
+#include "BatchParser.hpp"
+#include "ContentHash.hpp"
+#include "HtmlEntities.hpp"
+#include "HtmlEntityTable.hpp"
+#include "MD4CDialect.hpp"
 #include "MD4CParser.hpp"
+#include "MappedFile.hpp"
+#include "MarkdownHtmlRenderer.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include "MarkdownSessionCore.hpp"
 #include "MarkdownTypes.hpp"
+#include "MemoryPressure.hpp"
+#include "ParseResultCache.hpp"
+#include "ParserPool.hpp"
+#include "ReferenceDefinitionTable.hpp"
+#include "SessionHost.hpp"
+#include "TaskScheduler.hpp"
+#include "TextCodec.hpp"
+#include "Tracer.hpp"
+#include "Utf16.hpp"
+#include "../md4c/md4c.h"
 #include <iostream>
 #include <cassert>
 #include <string>
 #include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <stdexcept>
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace NitroMarkdown {
 
@@ -66,6 +95,8 @@ public:
         testItalicText();
         testInlineCode();
         testLink();
+        testEmphasisDelimiterInLinkDestination();
+        testAutolinkDoesNotSpanLines();
         testImage();
         testCodeBlock();
         testList();
@@ -73,6 +104,10 @@ public:
         testTaskListWithInlineCode();
         testTable();
         testNestedFormatting();
+        testEntityDecoding();
+        testEntityAttributes();
+        testEntityTableLookup();
+        testJsonSerialization();
 
         // Safety and crash prevention tests
         testMemoryLeaks();
@@ -84,10 +119,76 @@ public:
         testResourceCleanup();
         testConcurrentOptions();
 
+        // Incremental reparsing
+        testExternalReferenceDefinitions();
+        testSessionIncrementalAppend();
+        testSessionReferenceDefinedLater();
+        testSessionSnapshotAndFork();
+        testTextCodec();
+        testSessionCompaction();
+
+        // Deferred inline parsing
+        testDeferredInlines();
+
+        // Budgets
+        testOperationBudget();
+        testOperationBudgetInOneParagraph();
+        testTimeBudget();
+        testCollectStats();
+
+        // Allocation budgets
+        testAllocationBudgets();
+        testMemoryFootprint();
+        testMemoryPolicy();
+
+        // Result caching
+        testContentHash();
+        testParseResultCache();
+        testBlockMemo();
+        testAstCacheFile();
+
+        // Batch parsing
+        testTaskScheduler();
+        testBatchParser();
+
+        // Concurrent sessions
+        testParserPool();
+        testSessionHost();
+
+        // Tracing
+        testTraceExport();
+
+        // Specialized md4c builds
+        testSpecializedVariantsMatchGeneric();
+
+        // UTF-16 offsets
+        testUtf16Offsets();
+
+        // Mapped input
+        testMappedFile();
+
+        // HTML rendering
+        testHtmlRenderer();
+        testHtmlSafety();
+        testHtmlHeadingAnchors();
+
         TestRunner::printSummary();
     }
 
 private:
+    static std::string dumpTree(const std::shared_ptr<MarkdownNode>& node) {
+        std::string out = nodeTypeToString(node->type);
+        if (node->content) out += "'" + *node->content + "'";
+        if (node->href) out += "<" + *node->href + ">";
+        if (node->level) out += "#" + std::to_string(*node->level);
+        if (!node->children.empty()) {
+            out += "(";
+            for (const auto& child : node->children) out += dumpTree(child) + " ";
+            out += ")";
+        }
+        return out;
+    }
+
     static void testEmptyInput() {
         MD4CParser parser;
         ParserOptions options{true, true};
@@ -205,6 +306,41 @@ private:
         }
     }
 
+    static void testEmphasisDelimiterInLinkDestination() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+
+        // Found by MD4CParserFuzz: the '*' in the destination paired with the
+        // one after the link, leaving an emphasis that was never entered.
+        auto result = parser.parse("[](*)*!\n\n+", options);
+        TestRunner::assertEqual("document(paragraph(link<*> text'*!' ) list(list_item ) )", dumpTree(result),
+                                "Delimiter after a link stays text");
+
+        result = parser.parse("*[a](*)", options);
+        TestRunner::assertEqual("document(paragraph(text'*' link<*>(text'a' ) ) )", dumpTree(result),
+                                "Delimiter before a link stays text");
+
+        result = parser.parse("*a [b](c) d*", options);
+        TestRunner::assertEqual("document(paragraph(italic(text'a ' link<c>(text'b' ) text' d' ) ) )", dumpTree(result),
+                                "Emphasis around a link still pairs");
+    }
+
+    static void testAutolinkDoesNotSpanLines() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+
+        // Found by MD4CParserFuzz: a newline was taken for the first letter of
+        // an autolink scheme. The emphasis closed inside the link was never
+        // left, so everything after it ended up nested in the emphasis.
+        auto result = parser.parse("_<\np:_>\n\nnext", options);
+        TestRunner::assertEqual("document(paragraph(italic(text'<' soft_break text'p:' ) text'>' ) paragraph(text'next' ) )",
+                                dumpTree(result), "Autolink does not start with a newline");
+
+        result = parser.parse("<ab:c>", options);
+        TestRunner::assertEqual("document(paragraph(link<ab:c>(text'ab:c' ) ) )", dumpTree(result),
+                                "Autolink with a letter scheme");
+    }
+
     static void testImage() {
         MD4CParser parser;
         ParserOptions options{true, true};
@@ -352,6 +488,87 @@ private:
         }
     }
 
+    static void testEntityDecoding() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        auto result = parser.parse("&amp; &lt;b&gt; &copy; &#35; &#X22; &#x1F600; &NotEqualTilde; &bogus; &#0;", options);
+
+        auto paragraph = result->children[0];
+        TestRunner::assertTrue(paragraph->children.size() == 1, "Entities merge into one text node");
+        TestRunner::assertEqual("& <b> \u00A9 # \" \U0001F600 \u2242\u0338 &bogus; \uFFFD",
+                                paragraph->children[0]->content.value_or(""),
+                                "Named and numeric entities are decoded");
+
+        auto nul = parser.parse(std::string("a\0b [c\0](x \"t\0\")\n\n    d\0\n", 25), options);
+        TestRunner::assertEqual("a\uFFFDb ", nul->children[0]->children[0]->content.value_or(""),
+                                "Null characters in text become U+FFFD");
+        TestRunner::assertEqual("c\uFFFD", nul->children[0]->children[1]->children[0]->content.value_or(""),
+                                "Null characters in link text become U+FFFD");
+        TestRunner::assertEqual("t\uFFFD", nul->children[0]->children[1]->title.value_or(""),
+                                "Null characters in attributes become U+FFFD");
+        TestRunner::assertEqual("d\uFFFD\n", nul->children[1]->children[0]->content.value_or(""),
+                                "Null characters in code become U+FFFD");
+
+        auto code = parser.parse("`&amp;`", options)->children[0]->children[0];
+        TestRunner::assertEqual("&amp;", code->content.value_or(""), "Entities in code spans stay verbatim");
+    }
+
+    static void testEntityAttributes() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        auto result = parser.parse(
+            "[a &amp; b](/search?q=1&amp;r=2 \"&quot;T&quot;\") ![&lt;img&gt;](/i&#46;png)\n\n"
+            "```c&plus;&plus;\nint x;\n```", options);
+
+        auto link = result->children[0]->children[0];
+        TestRunner::assertEqual("/search?q=1&r=2", link->href.value_or(""), "Entities in link destination are decoded");
+        TestRunner::assertEqual("\"T\"", link->title.value_or(""), "Entities in link title are decoded");
+        TestRunner::assertEqual("a & b", link->children[0]->content.value_or(""), "Entities in link text are decoded");
+
+        auto image = result->children[0]->children[2];
+        TestRunner::assertEqual("/i.png", image->href.value_or(""), "Entities in image source are decoded");
+        TestRunner::assertEqual("<img>", image->alt.value_or(""), "Entities in image alt are decoded");
+
+        auto codeBlock = result->children[1];
+        TestRunner::assertEqual("c++", codeBlock->language.value_or(""), "Entities in code block info are decoded");
+    }
+
+    static void testEntityTableLookup() {
+        bool allFound = true;
+        for (const auto& entry : HtmlEntityTable::kEntries) {
+            const char* utf8 = HtmlEntities::lookupNamed(entry.name);
+            if (utf8 != entry.utf8) {
+                allFound = false;
+                std::cout << "  Lookup failed for " << entry.name << std::endl;
+                break;
+            }
+        }
+        TestRunner::assertTrue(allFound, "Every named entity hashes to its own slot");
+        TestRunner::assertTrue(HtmlEntityTable::kEntryCount == 2125, "Table covers the HTML5 named entities");
+        TestRunner::assertTrue(HtmlEntities::lookupNamed("amp;") == nullptr &&
+                               HtmlEntities::lookupNamed("AMP") != nullptr &&
+                               HtmlEntities::lookupNamed("Amp") == nullptr &&
+                               HtmlEntities::lookupNamed("") == nullptr,
+                               "Lookup is exact and case-sensitive");
+    }
+
+    static void testJsonSerialization() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        auto result = parser.parse("# Hi\n\n- [x] a \"q\"\\\n\n| A |\n|:-:|\n| \x01 |", options);
+        TestRunner::assertEqual(
+            "{\"type\":\"document\",\"children\":["
+            "{\"type\":\"heading\",\"level\":1,\"children\":[{\"type\":\"text\",\"content\":\"Hi\"}]},"
+            "{\"type\":\"list\",\"ordered\":false,\"children\":[{\"type\":\"task_list_item\",\"checked\":true,"
+            "\"children\":[{\"type\":\"text\",\"content\":\"a \\\"q\\\"\\\\\"}]}]},"
+            "{\"type\":\"table\",\"children\":[{\"type\":\"table_head\",\"children\":[{\"type\":\"table_row\",\"children\":["
+            "{\"type\":\"table_cell\",\"isHeader\":true,\"align\":\"center\",\"children\":[{\"type\":\"text\",\"content\":\"A\"}]}]}]},"
+            "{\"type\":\"table_body\",\"children\":[{\"type\":\"table_row\",\"children\":["
+            "{\"type\":\"table_cell\",\"isHeader\":false,\"align\":\"center\",\"children\":[{\"type\":\"text\",\"content\":\"\\u0001\"}]}]}]}]}]}",
+            MarkdownJsonSerializer::toJson(result),
+            "AST serializes to JSON with escaping and optional fields");
+    }
+
     static void testMemoryLeaks() {
         MD4CParser parser;
         ParserOptions options{true, true};
@@ -498,6 +715,1750 @@ private:
         TestRunner::assertNotNull(result3.get(), "Options {true, false} result not null");
         TestRunner::assertNotNull(result4.get(), "Options {false, true} result not null");
     }
+
+    static void testExternalReferenceDefinitions() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        ReferenceDefinitionTable table;
+        table.add(0, {"Docs", "https://example.com/early", ""});
+        table.add(100, {"guide", "https://example.com/later", "Later"});
+
+        auto result = parser.parse(std::string_view("See [docs] and [Guide]."), options,
+                                   ExternalReferences{&table, 50});
+        auto paragraph = result->children[0];
+        TestRunner::assertTrue(paragraph->children.size() == 5, "External references resolve to links");
+        TestRunner::assertEqual("https://example.com/early", paragraph->children[1]->href.value_or(""),
+                                "Label matching is case-insensitive");
+        TestRunner::assertEqual("Later", paragraph->children[3]->title.value_or(""), "External title is used");
+
+        auto shadowed = parser.parse(std::string_view("[docs] [guide]\n\n[docs]: /local\n[guide]: /local"),
+                                     options, ExternalReferences{&table, 50});
+        auto links = shadowed->children[0];
+        TestRunner::assertEqual("https://example.com/early", links->children[0]->href.value_or(""),
+                                "Earlier external definition wins over a local one");
+        TestRunner::assertEqual("/local", links->children[2]->href.value_or(""),
+                                "Local definition wins over a later external one");
+        TestRunner::assertTrue(parser.lastReferenceDefinitions().size() == 2, "Local definitions are reported");
+
+        auto offsets = parser.parse(std::string_view("# A\n\npara\n\n- x\n- y\n"), options, ExternalReferences{});
+        const auto& blockOffsets = parser.lastBlockOffsets();
+        TestRunner::assertTrue(blockOffsets.size() == 3 && blockOffsets[0] == 0 &&
+                               blockOffsets[1] == 5 && blockOffsets[2] == 11,
+                               "Top-level block offsets are reported");
+    }
+
+    static void testSessionIncrementalAppend() {
+        ParserOptions options{true, true};
+        std::string markdown =
+            "# Title\n\nSome *intro* text with `code`.\n\n"
+            "- one\n- two\n\n  continued item\n\n"
+            "| A | B |\n|---|---|\n| 1 | 2 |\n\n"
+            "```js\nconst x = 1;\n```\n\n"
+            "> quote\nlazy line\n\nSetext\n===\n\nfinal paragraph\n";
+        markdown += markdown;
+
+        MarkdownSessionCore session(options);
+        MD4CParser parser;
+        bool allMatch = true;
+        size_t reparsedBytes = 0;
+        for (size_t i = 0; i < markdown.size(); i += 3) {
+            session.append(markdown.substr(i, 3));
+            auto incremental = session.document();
+            reparsedBytes += session.lastReparsedBytes();
+            auto full = parser.parse(*session.text(), options);
+            if (dumpTree(incremental) != dumpTree(full)) {
+                allMatch = false;
+                std::cout << "  Mismatch after " << session.text()->size() << " bytes" << std::endl;
+                break;
+            }
+        }
+        TestRunner::assertTrue(allMatch, "Incremental session matches full parse after every append");
+
+        size_t fullReparseBytes = 0;
+        for (size_t i = 3; i < markdown.size() + 3; i += 3) fullReparseBytes += std::min(i, markdown.size());
+        TestRunner::assertTrue(reparsedBytes * 4 < fullReparseBytes, "Incremental session reparses only the tail");
+
+        auto unchanged = session.document();
+        TestRunner::assertTrue(session.lastReparsedBytes() == 0 && unchanged == session.document(),
+                               "Unchanged session returns cached document");
+
+        session.clear();
+        TestRunner::assertTrue(session.document()->children.empty(), "Cleared session is empty");
+    }
+
+    static void testSessionReferenceDefinedLater() {
+        ParserOptions options{true, true};
+        MarkdownSessionCore session(options);
+
+        session.append("See [the docs] for details.\n\nMore text.\n\n");
+        auto before = session.document();
+        TestRunner::assertTrue(before->children[0]->children.size() == 1, "Undefined reference stays text");
+
+        session.append("[The Docs]: https://example.com \"Docs\"\n");
+        auto after = session.document();
+        auto paragraph = after->children[0];
+        TestRunner::assertTrue(paragraph->children.size() == 3, "Earlier block is reparsed for new definition");
+        TestRunner::assertEqual("https://example.com", paragraph->children[1]->href.value_or(""),
+                                "Reference defined later resolves");
+        TestRunner::assertTrue(session.references().size() == 1, "Definition is kept in the session table");
+
+        session.append("\nTrailing [the docs] use.\n");
+        auto tail = session.document();
+        auto last = tail->children.back();
+        TestRunner::assertEqual("https://example.com", last->children[1]->href.value_or(""),
+                                "Tail reparse resolves definition from earlier block");
+        TestRunner::assertTrue(session.lastReparsedBytes() < session.text()->size(),
+                               "Tail reparse does not rescan the whole document");
+
+        MD4CParser parser;
+        TestRunner::assertEqual(dumpTree(parser.parse(*session.text(), options)), dumpTree(tail),
+                                "Session with references matches full parse");
+    }
+
+    static void testSessionSnapshotAndFork() {
+        ParserOptions options{true, true};
+        MD4CParser parser;
+        auto matches = [&](MarkdownSessionCore& session) {
+            return dumpTree(session.document()) == dumpTree(parser.parse(*session.text(), options));
+        };
+
+        MarkdownSessionCore session(options);
+        session.append("# Answer\n\nSee [the docs] and a list:\n\n- one\n- tw");
+        session.document();
+        auto snapshot = session.snapshot();
+        TestRunner::assertEqual(*session.text(), *snapshot.text(), "Snapshot has the session's text");
+        TestRunner::assertTrue(snapshot.document() == session.document(), "Snapshot shares the tree");
+
+        session.append("o\n- three\n");
+        MarkdownSessionCore fork(snapshot);
+        fork.append("o\n\n[the docs]: https://example.com\n");
+        TestRunner::assertTrue(matches(session) && matches(fork), "Session and fork diverge independently");
+        TestRunner::assertTrue(fork.lastReparsedBytes() < fork.size(), "Fork reparses only what can change");
+        TestRunner::assertEqual("https://example.com", fork.document()->children[1]->children[1]->href.value_or(""),
+                                "Definition in a fork reaches blocks shared with the snapshot");
+        TestRunner::assertTrue(session.document()->children[1]->children.size() == 1,
+                               "Original does not see the fork's definition");
+        TestRunner::assertTrue(snapshot.text()->size() + 1 < session.size() &&
+                                   snapshot.document()->children.size() == 3,
+                               "Snapshot is unchanged by either");
+
+        // Branch repeatedly from sessions and snapshots, appending chunks of
+        // the reference document, past the depth at which segments are
+        // flattened.
+        std::string base = referenceDocument();
+        std::vector<std::unique_ptr<MarkdownSessionCore>> sessions;
+        std::vector<MarkdownSessionCore::Snapshot> snapshots;
+        sessions.push_back(std::make_unique<MarkdownSessionCore>(options));
+        uint32_t state = 12345;
+        auto next = [&] {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        };
+        bool allMatch = true;
+        for (int step = 0; step < 300 && allMatch; step++) {
+            auto& current = *sessions[next() % sessions.size()];
+            switch (next() % 6) {
+                case 0:
+                    snapshots.push_back(current.snapshot());
+                    break;
+                case 1:
+                    if (sessions.size() < 12) sessions.push_back(std::make_unique<MarkdownSessionCore>(current.fork()));
+                    break;
+                case 2:
+                    if (!snapshots.empty() && sessions.size() < 12) {
+                        sessions.push_back(
+                            std::make_unique<MarkdownSessionCore>(snapshots[next() % snapshots.size()]));
+                    }
+                    break;
+                default: {
+                    size_t offset = next() % base.size();
+                    current.append(base.substr(offset, 1 + next() % 200));
+                    allMatch = matches(current);
+                    break;
+                }
+            }
+        }
+        for (auto& each : sessions) allMatch = allMatch && matches(*each);
+        bool snapshotsMatch = true;
+        for (const auto& each : snapshots) {
+            auto tree = each.document();
+            snapshotsMatch = snapshotsMatch && (!tree || dumpTree(tree) == dumpTree(parser.parse(*each.text(), options)));
+        }
+        TestRunner::assertTrue(allMatch, "Every branch matches a full parse");
+        TestRunner::assertTrue(snapshotsMatch, "Snapshots keep their trees");
+
+        MarkdownSessionCore deep(options);
+        for (size_t i = 0; i < 3 * MarkdownSessionCore::kMaxSegmentDepth; i++) {
+            deep.append("Paragraph " + std::to_string(i) + " with [a link].\n\n");
+            deep.document();
+            deep.snapshot();
+        }
+        deep.append("[a link]: /url\n");
+        TestRunner::assertTrue(matches(deep), "Deep chain of snapshots is flattened and still parses");
+
+        // Forking costs nothing in the size of the text; the fork's first
+        // update reparses only the last block.
+        MarkdownSessionCore large(options);
+        while (large.size() < (100u << 10)) large.append(base);
+        large.document();
+        MarkdownSessionCore branch = large.fork();
+        branch.append("\n\nA regenerated answer.\n");
+        TestRunner::assertTrue(matches(branch) && branch.lastReparsedBytes() < 4096,
+                               "Fork of a large session reparses only its tail");
+        branch.releaseTree();
+        TestRunner::assertTrue(matches(branch) && matches(large), "Released fork parses again");
+    }
+
+    static void testDeferredInlines() {
+        ParserOptions options{true, true};
+        std::string markdown =
+            "# Title *x*\n\n"
+            "> quoted **bold**\n> [ref] line\n\n"
+            "| a | `b` |\n|---|---|\n| 1 | *2* |\n\n"
+            "- item &amp; ~~del~~\n  - nested *item*\n\n"
+            "[ref]: /url\n";
+
+        MD4CParser parser;
+        auto full = parser.parse(markdown, options);
+
+        options.deferInlines = true;
+        auto skeleton = parser.parse(markdown, options);
+        auto heading = skeleton->children[0];
+        TestRunner::assertTrue(heading->blockId.has_value() && heading->children.empty(),
+                               "Deferred heading has a block id and no children");
+        TestRunner::assertEqual("Title *x*",
+                                markdown.substr(heading->sourceStart.value_or(0),
+                                                heading->sourceEnd.value_or(0) - heading->sourceStart.value_or(0)),
+                                "Deferred block reports its source range");
+        TestRunner::assertTrue(skeleton->children.size() == full->children.size(), "Skeleton keeps all blocks");
+
+        int deferredCount = 0;
+        std::vector<std::shared_ptr<MarkdownNode>> pending{skeleton};
+        while (!pending.empty()) {
+            auto node = pending.back();
+            pending.pop_back();
+            if (node->blockId) {
+                deferredCount++;
+                TestRunner::assertTrue(parser.parseInlines(*node->blockId) == node,
+                                       "parseInlines returns the deferred block");
+            }
+            for (const auto& child : node->children) pending.push_back(child);
+        }
+        TestRunner::assertTrue(deferredCount == 8, "Paragraphs, headings and table cells are deferred");
+        TestRunner::assertEqual(dumpTree(full), dumpTree(skeleton),
+                                "Materialized blocks match a full parse");
+
+        size_t childCount = heading->children.size();
+        parser.parseInlines(*heading->blockId);
+        TestRunner::assertTrue(heading->children.size() == childCount, "Materializing twice is a no-op");
+        TestRunner::assertTrue(parser.parseInlines(deferredCount) == nullptr && parser.parseInlines(-1) == nullptr,
+                               "Unknown block ids are rejected");
+    }
+
+    static void testOperationBudget() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        std::string brackets(5000, '[');
+        std::string markdown = "# Title\n\nSome *intro*.\n\n" + brackets + "\n";
+
+        auto unlimited = parser.parse(markdown, options);
+        const auto& stats = parser.lastStats();
+        TestRunner::assertTrue(!stats.budgetExceeded && stats.operations > brackets.size(),
+                               "Unlimited parse reports operations");
+        TestRunner::assertTrue(unlimited->children.size() == 3, "Unlimited parse keeps all blocks");
+
+        options.maxOperations = 1000;
+        auto limited = parser.parse(markdown, options);
+        TestRunner::assertTrue(parser.lastStats().budgetExceeded, "Operation budget is reported as exceeded");
+        TestRunner::assertTrue(limited->children.size() == 3, "Aborted parse keeps block count");
+        TestRunner::assertEqual("heading", nodeTypeToString(limited->children[0]->type),
+                                "Blocks before the budget keep their formatting");
+        TestRunner::assertEqual("italic", nodeTypeToString(limited->children[1]->children[1]->type),
+                                "Inline formatting before the budget is kept");
+        auto fallback = limited->children[2];
+        TestRunner::assertEqual(brackets, fallback->children[0]->content.value_or(""),
+                                "Remainder is rendered as plain text");
+        TestRunner::assertTrue(parser.lastStats().plainTextOffset == markdown.size() - brackets.size() - 1,
+                               "Plain text starts at the aborted block");
+        TestRunner::assertTrue(parser.lastBlockOffsets().size() == limited->children.size(),
+                               "Block offsets stay in sync with the fallback");
+
+        options.maxOperations = 0;
+        parser.parse(markdown, options);
+        TestRunner::assertTrue(!parser.lastStats().budgetExceeded, "Budget state resets between parses");
+    }
+
+    static void testOperationBudgetInOneParagraph() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        std::string paragraph;
+        for (int i = 0; i < 20000; i++) paragraph += "*a [b _c ";
+        std::string markdown = "Intro.\n\n" + paragraph + "\n";
+
+        parser.parse(markdown, options);
+        size_t total = parser.lastStats().operations;
+
+        // Enough for collecting the paragraph's marks, not for resolving them.
+        options.maxOperations = total / 2;
+        auto limited = parser.parse(markdown, options);
+        const auto& stats = parser.lastStats();
+        // md4c reports work every 256 units.
+        TestRunner::assertTrue(stats.budgetExceeded && stats.operations <= options.maxOperations + 256,
+                               "Budget stops the analysis of a single paragraph");
+        TestRunner::assertTrue(stats.plainTextOffset == 8 && limited->children.size() == 2,
+                               "The paragraph is rendered as plain text");
+    }
+
+    static void testTimeBudget() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        options.maxParseTimeMs = 1e-9;
+        std::string markdown;
+        for (int i = 0; i < 2000; i++) markdown += "> - *a [b* `c` **d\n";
+
+        auto result = parser.parse(markdown, options);
+        const auto& stats = parser.lastStats();
+        TestRunner::assertTrue(stats.budgetExceeded, "Time budget is reported as exceeded");
+        TestRunner::assertTrue(stats.plainTextOffset == 0 && result->children.size() == 1,
+                               "Budget hit while analyzing lines renders everything as plain text");
+        TestRunner::assertTrue(stats.parseTimeMs > 0, "Parse time is reported");
+    }
+
+    static void testCollectStats() {
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        std::string markdown = "# Title\n\n- one **two**\n  - [x] three\n\n| a |\n|---|\n| b |\n";
+
+        parser.parse(markdown, options);
+        const auto& plain = parser.lastStats();
+        TestRunner::assertTrue(plain.nodeCount == 0 && plain.blockAnalysisMs == 0 && plain.estimatedAllocations == 0,
+                               "Detailed stats are off by default");
+
+        options.collectStats = true;
+        auto result = parser.parse(markdown, options);
+        const auto& stats = parser.lastStats();
+        // document, heading + text, list > item > (text, bold > text, list > task item > text),
+        // table > head > row > cell > text, body > row > cell > text
+        TestRunner::assertTrue(stats.nodeCount == 20, "Node count covers the whole tree");
+        TestRunner::assertTrue(stats.maxDepth == 6, "Max depth counts the document as level 1");
+        TestRunner::assertTrue(stats.estimatedAllocations >= stats.nodeCount, "Allocations include one per node");
+        TestRunner::assertTrue(stats.blockAnalysisMs > 0 && stats.inlineAnalysisMs > 0,
+                               "Analysis phases are timed");
+        TestRunner::assertTrue(stats.blockAnalysisMs + stats.inlineAnalysisMs + stats.astBuildMs <=
+                                   stats.parseTimeMs + 1e-9,
+                               "Phases add up to at most the parse time");
+
+        options.deferInlines = true;
+        auto deferred = parser.parse(markdown, options);
+        TestRunner::assertTrue(parser.lastStats().inlineAnalysisMs < stats.parseTimeMs, "Deferred parse is timed");
+        auto heading = parser.parseInlines(deferred->children[0]->blockId.value_or(-1));
+        TestRunner::assertTrue(heading && parser.lastStats().nodeCount == 2 &&
+                                   parser.lastStats().inlineAnalysisMs > 0,
+                               "Materializing a block reports its own stats");
+    }
+
+    // The chat-style mix the benchmarks use, 64 repetitions (about 33 KB).
+    static void testTextCodec() {
+        auto roundTrips = [](const std::string& text) {
+            std::string out = "stale";
+            return TextCodec::decompress(TextCodec::compress(text), text.size(), out) && out == text;
+        };
+        std::string document = referenceDocument();
+        std::string noise;
+        uint32_t state = 2463534242u;
+        for (int i = 0; i < 70000; i++) {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            noise += static_cast<char>(state);
+        }
+        TestRunner::assertTrue(roundTrips("") && roundTrips("a") && roundTrips("abcd") && roundTrips("abcabcabcabca"),
+                               "Codec round-trips short text");
+        TestRunner::assertTrue(roundTrips(document) && roundTrips(noise) && roundTrips(std::string(100000, 'x')) &&
+                                   roundTrips(noise.substr(0, 30000) + document + noise.substr(0, 30000)),
+                               "Codec round-trips long and incompressible text");
+        TestRunner::assertTrue(TextCodec::compress(document).size() * 4 < document.size(),
+                               "Repetitive markdown compresses");
+        TestRunner::assertTrue(TextCodec::compress(noise).size() < noise.size() + noise.size() / 100,
+                               "Incompressible text barely grows");
+
+        std::string compressed = TextCodec::compress(document);
+        std::string out;
+        TestRunner::assertTrue(!TextCodec::decompress(compressed, document.size() - 1, out) &&
+                                   !TextCodec::decompress(compressed, document.size() + 1, out) &&
+                                   !TextCodec::decompress(compressed.substr(0, compressed.size() / 2),
+                                                          document.size(), out),
+                               "Damaged input is rejected");
+        bool safe = true;
+        for (size_t i = 0; i < compressed.size(); i += 7) {
+            std::string damaged = compressed;
+            damaged[i] = static_cast<char>(damaged[i] ^ 0x5a);
+            // Any result is fine as long as nothing is read or written out of bounds.
+            if (TextCodec::decompress(damaged, document.size(), out)) safe = safe && out.size() == document.size();
+        }
+        TestRunner::assertTrue(safe, "Damaged bytes decode within bounds");
+    }
+
+    static void testSessionCompaction() {
+        ParserOptions options{true, true};
+        MD4CParser parser;
+        // Cold blocks parsed on demand followed by the hot tree make up the
+        // tree of a full parse.
+        auto matches = [&](MarkdownSessionCore& session) {
+            auto full = parser.parse(*session.text(), options);
+            auto hot = session.document();
+            auto cold = *session.coldBlocks(0, session.coldBlockCount());
+            if (cold.size() + hot->children.size() != full->children.size()) return false;
+            for (size_t i = 0; i < full->children.size(); i++) {
+                const auto& node = i < cold.size() ? cold[i] : hot->children[i - cold.size()];
+                if (dumpTree(node) != dumpTree(full->children[i])) return false;
+            }
+            return true;
+        };
+
+        std::string base = referenceDocument();
+        std::string text = "Intro that cites [the late docs].\n\n";
+        MarkdownSessionCore session(options);
+        session.append(text);
+        for (int round = 0; round < 4; round++) {
+            for (size_t i = 0; i < base.size(); i += 500) {
+                std::string chunk = base.substr(i, 500);
+                text += chunk;
+                session.append(chunk);
+                session.document();
+            }
+            session.compact(16u << 10);
+        }
+        TestRunner::assertTrue(session.coldSize() > text.size() - (32u << 10) && session.coldBlockCount() > 0 &&
+                                   session.text() == text,
+                               "Compaction keeps all of the text");
+        TestRunner::assertTrue(matches(session), "Cold and hot blocks make up the full tree");
+        auto footprint = session.memoryFootprint();
+        TestRunner::assertTrue(footprint.inputBytes < text.size() / 2 && session.treeBytes() > 0,
+                               "Cold text is compressed and its trees are dropped");
+        TestRunner::assertTrue(session.compact(16u << 10) == 0, "Nothing more to compact");
+
+        std::string definition = "[the late docs]: https://example.com/late\n";
+        session.append(definition);
+        text += definition;
+        TestRunner::assertTrue(matches(session) && session.lastReparsedBytes() < (64u << 10),
+                               "Hot updates do not touch cold text");
+        auto intro = *session.coldBlocks(0, 1);
+        TestRunner::assertTrue(intro.size() == 1 && intro[0]->children.size() == 3 &&
+                                   intro[0]->children[1]->href.value_or("") == "https://example.com/late",
+                               "Cold blocks resolve definitions added later");
+
+        auto snapshot = session.snapshot();
+        MarkdownSessionCore fork(snapshot);
+        fork.append("\nA regenerated ending.\n");
+        session.append("\nThe original ending.\n");
+        TestRunner::assertTrue(snapshot.text() == text && matches(fork) && matches(session),
+                               "Snapshots and forks share cold chunks");
+        fork.compact(0);
+        TestRunner::assertTrue(matches(fork) && fork.coldSize() > snapshot.coldSize(),
+                               "A fork compacts on its own");
+
+        session.releaseTree();
+        TestRunner::assertTrue(matches(session), "Released session reparses only hot text");
+        session.clear();
+        TestRunner::assertTrue(session.coldSize() == 0 && session.text()->empty() &&
+                                   session.document()->children.empty(),
+                               "Cleared session has no cold text");
+    }
+
+    static std::string referenceDocument() {
+        static const char* chunk =
+            "## Section heading\n\n"
+            "Some **bold** and *italic* text with `inline code`, a [link](https://example.com) "
+            "and an autolink https://example.com/path?q=1. Math like $e^{i\\pi} + 1 = 0$ "
+            "and ~~removed~~ words &amp; entities.\n\n"
+            "- first item with **emphasis**\n"
+            "- [x] finished task\n"
+            "  - nested item with `code`\n\n"
+            "| Name | Value |\n|:-----|------:|\n| alpha | 1 |\n| beta | 2 |\n\n"
+            "```ts\nconst answer = 42;\nconsole.log(answer);\n```\n\n"
+            "> Quoted text that spans\n> two lines.\n\n";
+        std::string document;
+        for (int i = 0; i < 64; i++) document += chunk;
+        return document;
+    }
+
+    static void testAllocationBudgets() {
+        if (!AllocationCounter::kEnabled) return;
+
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        std::string document = referenceDocument();
+        parser.parse(document, options);
+
+        auto before = AllocationCounter::snapshot();
+        auto ast = parser.parse(document, options);
+        auto parse = AllocationCounter::snapshot() - before;
+        before = AllocationCounter::snapshot();
+        std::string json = MarkdownJsonSerializer::toJson(ast);
+        auto serialize = AllocationCounter::snapshot() - before;
+
+        // Measured with libstdc++: md4c 269, nodes 6667, strings 705,
+        // serializer 14 allocations. Raise a budget only for a deliberate change.
+        bool withinBudget = true;
+        auto check = [&](AllocationCategory category, const AllocationCounts& counts, size_t budget) {
+            bool ok = counts.countOf(category) < budget;
+            if (!ok) {
+                std::cout << "  " << AllocationCounter::categoryName(category) << ": "
+                          << counts.countOf(category) << " allocations, " << counts.bytesOf(category)
+                          << " bytes (budget " << budget << ")" << std::endl;
+            }
+            withinBudget = withinBudget && ok;
+            return ok;
+        };
+        TestRunner::assertTrue(check(AllocationCategory::Md4c, parse, 310), "md4c allocations within budget");
+        TestRunner::assertTrue(check(AllocationCategory::Nodes, parse, 7700), "AST node allocations within budget");
+        TestRunner::assertTrue(check(AllocationCategory::Strings, parse, 820), "String allocations within budget");
+        TestRunner::assertTrue(check(AllocationCategory::Other, parse, 50), "Other parser allocations within budget");
+        TestRunner::assertTrue(check(AllocationCategory::Serializer, serialize, 20) &&
+                                   serialize.totalCount() == serialize.countOf(AllocationCategory::Serializer),
+                               "Serializer allocations within budget");
+        TestRunner::assertTrue(parse.totalCount() < 8800 && withinBudget,
+                               "Parsing the reference document stays under 8800 allocations");
+        TestRunner::assertTrue(json.size() > document.size(), "Reference document serializes");
+    }
+
+    static void testMemoryFootprint() {
+        ParserOptions options{true, true};
+        std::string document = referenceDocument();
+
+        MD4CParser empty;
+        TestRunner::assertTrue(empty.memoryFootprint().nodeBytes == 0, "No tree before the first parse");
+
+        // The estimate should be close to what the parser really holds on to:
+        // the allocation counter's live bytes, minus the parser object itself.
+        auto before = AllocationCounter::snapshot();
+        auto parser = std::make_unique<MD4CParser>();
+        auto idle = AllocationCounter::snapshot().liveBytes - before.liveBytes;
+        parser->parse(document, options);
+        auto footprint = parser->memoryFootprint();
+        auto retained = AllocationCounter::snapshot().liveBytes - before.liveBytes - idle;
+        TestRunner::assertTrue(footprint.nodeBytes > footprint.stringBytes && footprint.stringBytes > 0,
+                               "Tree nodes and strings are counted");
+        TestRunner::assertTrue(footprint.inputBytes == 0, "A full parse keeps no input");
+        if (AllocationCounter::kEnabled) {
+            double ratio = static_cast<double>(footprint.total()) / static_cast<double>(retained);
+            if (ratio < 0.9 || ratio > 1.1) {
+                std::cout << "  footprint " << footprint.total() << " bytes, retained " << retained << std::endl;
+            }
+            TestRunner::assertTrue(ratio >= 0.9 && ratio <= 1.1, "Parser footprint within 10% of retained bytes");
+        }
+
+        ParserOptions deferred = options;
+        deferred.deferInlines = true;
+        parser->parse(document, deferred);
+        footprint = parser->memoryFootprint();
+        TestRunner::assertTrue(footprint.inputBytes > document.size(), "Deferred inlines keep the input");
+        TestRunner::assertTrue(footprint.scratchBytes > 0, "Deferred line tables count as scratch");
+
+        MarkdownSessionCore session(options);
+        session.append(document);
+        session.document();
+        auto sessionFootprint = session.memoryFootprint();
+        MemoryFootprint tree;
+        tree.addTree(*session.document());
+        TestRunner::assertTrue(sessionFootprint.inputBytes >= document.size(), "Session counts its text");
+        TestRunner::assertTrue(tree.nodeBytes == sessionFootprint.nodeBytes,
+                               "Block subtrees shared with the parser count once");
+        MemoryFootprint blocks;
+        for (const auto& child : session.document()->children) blocks.addTree(*child);
+        TestRunner::assertTrue(session.treeBytes() == blocks.nodeBytes + blocks.stringBytes,
+                               "Session keeps its tree size up to date");
+        std::string json = MarkdownJsonSerializer::toJson(session.document());
+        session.releaseTree();
+        TestRunner::assertTrue(!session.hasTree() && session.treeBytes() == 0 &&
+                                   session.memoryFootprint().inputBytes >= document.size(),
+                               "Released session keeps its text");
+        TestRunner::assertEqual(json, MarkdownJsonSerializer::toJson(session.document()),
+                                "Released session parses its text again");
+        session.clear();
+        TestRunner::assertTrue(session.memoryFootprint().nodeBytes == 0, "Cleared session has no tree");
+    }
+
+    static void testMemoryPolicy() {
+        ParserOptions options{true, true};
+        std::string large;
+        for (int i = 0; i < 20000; i++) large += "Paragraph " + std::to_string(i) + ".\n\n";
+        const std::string small = "# Small\n\nSome *text*.\n";
+        const size_t resultBytes = 20000 * sizeof(size_t);
+
+        {
+            MD4CParser parser;
+            MemoryPolicy policy;
+            policy.highWaterBytes = 0;
+            policy.baselineBytes = 16u << 10;
+            policy.shrinkAfterSmallParses = 3;
+            parser.setMemoryPolicy(policy);
+            parser.parse(large, options);
+            size_t grown = parser.memoryFootprint().scratchBytes;
+            parser.parse(small, options);
+            parser.parse(small, options);
+            TestRunner::assertTrue(grown >= resultBytes && parser.memoryFootprint().scratchBytes >= resultBytes,
+                                   "Buffers are kept across a few small parses");
+            parser.parse(small, options);
+            parser.parse(small, options);
+            TestRunner::assertTrue(parser.memoryFootprint().scratchBytes < 1024 &&
+                                       parser.lastBlockOffsets().size() == 2,
+                                   "Buffers shrink after a run of small parses");
+            parser.parse(large, options);
+            parser.parse(large, options);
+            for (int i = 0; i < 2; i++) parser.parse(small, options);
+            parser.parse(large, options);
+            for (int i = 0; i < 2; i++) parser.parse(small, options);
+            TestRunner::assertTrue(parser.memoryFootprint().scratchBytes >= resultBytes,
+                                   "A large parse restarts the count");
+        }
+
+        {
+            MD4CParser parser;
+            MemoryPolicy policy;
+            policy.highWaterBytes = 64u << 10;
+            parser.setMemoryPolicy(policy);
+            parser.parse(large, options);
+            auto footprint = parser.memoryFootprint();
+            TestRunner::assertTrue(footprint.scratchBytes >= resultBytes && footprint.scratchBytes < resultBytes + 256 &&
+                                       parser.lastBlockOffsets().size() == 20000,
+                                   "Above the high-water mark only the results are kept");
+            parser.parse(small, options);
+            TestRunner::assertTrue(parser.memoryFootprint().scratchBytes < 1024,
+                                   "The next parse frees the results");
+        }
+
+        {
+            MD4CParser parser;
+            auto root = parser.parse(large, options);
+            std::string json = MarkdownJsonSerializer::toJson(root);
+            TestRunner::assertTrue(parser.memoryFootprint().scratchBytes > resultBytes,
+                                   "Default policy keeps a moderate buffer");
+            parser.trim();
+            TestRunner::assertTrue(parser.memoryFootprint().scratchBytes < resultBytes + 256,
+                                   "Trim shrinks to the results");
+            TestRunner::assertEqual(json, MarkdownJsonSerializer::toJson(root), "Trim keeps the tree");
+
+            ParserOptions deferred = options;
+            deferred.deferInlines = true;
+            parser.parse(large, deferred);
+            parser.trim();
+            auto block = parser.parseInlines(19999);
+            TestRunner::assertTrue(block && block->children.size() == 1 &&
+                                       block->children[0]->content == std::string("Paragraph 19999."),
+                                   "Deferred blocks survive a trim");
+        }
+
+        {
+            MarkdownSessionCore session(options);
+            session.append(large);
+            std::string json = MarkdownJsonSerializer::toJson(session.document());
+            size_t before = session.memoryFootprint().scratchBytes;
+            session.trim();
+            TestRunner::assertTrue(session.memoryFootprint().scratchBytes < before, "Session trim frees buffers");
+            session.append("More.\n");
+            TestRunner::assertEqual(MarkdownJsonSerializer::toJson(MD4CParser().parse(large + "More.\n", options)),
+                                    MarkdownJsonSerializer::toJson(session.document()),
+                                    "Trimmed session goes on appending");
+        }
+
+        {
+            std::vector<MemoryPressure::Level> levels;
+            auto subscription = MemoryPressure::subscribe([&](MemoryPressure::Level level) { levels.push_back(level); });
+            MemoryPressure::notify(MemoryPressure::Level::Moderate);
+            MemoryPressure::Subscription moved = std::move(subscription);
+            MemoryPressure::notify(MemoryPressure::Level::Critical);
+            moved.reset();
+            MemoryPressure::notify(MemoryPressure::Level::Critical);
+            TestRunner::assertTrue(levels.size() == 2 && levels[0] == MemoryPressure::Level::Moderate &&
+                                       levels[1] == MemoryPressure::Level::Critical,
+                                   "Handlers get notifications while subscribed");
+
+            // Handlers run without the registry locked, so they may change
+            // subscriptions, and other threads may meanwhile.
+            int nestedCalls = 0;
+            bool otherThreadSubscribed = false;
+            MemoryPressure::Subscription nested;
+            MemoryPressure::Subscription self;
+            self = MemoryPressure::subscribe([&](MemoryPressure::Level) {
+                nested = MemoryPressure::subscribe([&](MemoryPressure::Level) { nestedCalls++; });
+                std::thread([&] {
+                    auto other = MemoryPressure::subscribe([](MemoryPressure::Level) {});
+                    otherThreadSubscribed = true;
+                }).join();
+                self.reset();
+            });
+            MemoryPressure::notify(MemoryPressure::Level::Moderate);
+            MemoryPressure::notify(MemoryPressure::Level::Moderate);
+            nested.reset();
+            TestRunner::assertTrue(nestedCalls == 1 && otherThreadSubscribed,
+                                   "Handlers may subscribe and unsubscribe during a notification");
+
+            TaskScheduler scheduler(1);
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 0, scheduler);
+            auto id = host.open(options);
+            host.append(id, small);
+            host.flush();
+            host.document(id);
+            MemoryPressure::notify(MemoryPressure::Level::Moderate);
+            auto stats = host.stats();
+            TestRunner::assertTrue(stats.evictions == 0 && stats.treeBytes > 0 && stats.parserBytes == 0,
+                                   "Moderate pressure drops idle parsers only");
+            MemoryPressure::notify(MemoryPressure::Level::Critical);
+            TestRunner::assertTrue(host.stats().evictions == 1 && host.stats().treeBytes == 0,
+                                   "Critical pressure drops idle trees");
+            TestRunner::assertEqual(MarkdownJsonSerializer::toJson(MD4CParser().parse(small, options)),
+                                    MarkdownJsonSerializer::toJson(host.document(id)),
+                                    "Trimmed session is parsed again on demand");
+        }
+    }
+
+    static void testContentHash() {
+        std::string text = referenceDocument();
+        TestRunner::assertTrue(ContentHash::hash(text) == ContentHash::hash(std::string(text)),
+                               "Hash depends only on the bytes");
+        TestRunner::assertTrue(ContentHash::hash(text) != ContentHash::hash(text, 1), "Seed changes the hash");
+
+        // Every length up to a few blocks, so each tail size and the block
+        // loop are covered, and a flipped bit at every position.
+        bool distinct = true;
+        std::vector<uint64_t> seen;
+        for (size_t length = 0; length <= 48; length++) {
+            std::string prefix = text.substr(0, length);
+            uint64_t h = ContentHash::hash(prefix);
+            distinct = distinct && std::find(seen.begin(), seen.end(), h) == seen.end();
+            seen.push_back(h);
+            for (size_t i = 0; i < length; i++) {
+                std::string flipped = prefix;
+                flipped[i] ^= 0x01;
+                distinct = distinct && ContentHash::hash(flipped) != h;
+            }
+        }
+        TestRunner::assertTrue(distinct, "Prefixes and single-bit changes hash differently");
+        TestRunner::assertTrue(ContentHash::hash(std::string(17, '\0')) != ContentHash::hash(std::string(18, '\0')),
+                               "Length is part of the hash");
+        TestRunner::assertTrue(ContentHash::combine(1, 2) != ContentHash::combine(2, 1), "Combine is ordered");
+    }
+
+    static void testParseResultCache() {
+        ParserOptions options{true, true};
+        ParseStats stats;
+        stats.operations = 7;
+
+        auto key = ParseResultCache::makeKey("# Hello", options);
+        ParserOptions noGfm = options;
+        noGfm.gfm = false;
+        TestRunner::assertTrue(!(key == ParseResultCache::makeKey("# Hello", noGfm)), "Options are part of the key");
+        ParserOptions budget = options;
+        budget.maxOperations = 100;
+        TestRunner::assertTrue(!(key == ParseResultCache::makeKey("# Hello", budget)), "Budgets are part of the key");
+        TestRunner::assertTrue(key == ParseResultCache::makeKey(std::string("# Hello"), options), "Keys are stable");
+        TestRunner::assertTrue(!(key == ParseResultCache::makeKey("# Hello", options, ParseResultCache::OffsetUnit::Utf16)),
+                               "The offset unit is part of the key");
+
+        ParserOptions deferred = options;
+        deferred.deferInlines = true;
+        ParserOptions collect = options;
+        collect.collectStats = true;
+        TestRunner::assertTrue(ParseResultCache::cacheable(options) && ParseResultCache::cacheable(budget),
+                               "Plain and budgeted parses are cacheable");
+        TestRunner::assertTrue(!ParseResultCache::cacheable(deferred) && !ParseResultCache::cacheable(collect),
+                               "Deferred and instrumented parses are not cacheable");
+
+        ParseResultCache cache;
+        TestRunner::assertTrue(cache.find(key) == nullptr, "Empty cache misses");
+        std::string json = MarkdownJsonSerializer::toJson(MD4CParser().parse("# Hello", options));
+        cache.insert(key, json, stats);
+        const auto* entry = cache.find(key);
+        TestRunner::assertTrue(entry != nullptr, "Inserted result is found");
+        if (entry) {
+            TestRunner::assertEqual(json, entry->json, "Cached JSON is returned");
+            TestRunner::assertTrue(entry->stats.operations == 7, "Cached stats are returned");
+        }
+        auto counters = cache.stats();
+        TestRunner::assertTrue(counters.hits == 1 && counters.misses == 1 && counters.entries == 1,
+                               "Hits and misses are counted");
+
+        // Fill a small cache; the least recently used entries go first and
+        // the byte bound holds throughout.
+        std::string payload(1000, 'x');
+        ParseResultCache small(8 * 1024);
+        std::vector<ParseResultCache::Key> keys;
+        bool bounded = true;
+        for (int i = 0; i < 20; i++) {
+            keys.push_back(ParseResultCache::makeKey("doc " + std::to_string(i), options));
+            small.insert(keys.back(), payload, stats);
+            small.find(keys.front());
+            bounded = bounded && small.stats().bytes <= 8 * 1024;
+        }
+        counters = small.stats();
+        TestRunner::assertTrue(bounded, "Cache stays within its capacity");
+        TestRunner::assertTrue(counters.evictions > 0 && counters.entries + counters.evictions == 20,
+                               "Entries beyond the capacity are evicted");
+        TestRunner::assertTrue(small.find(keys.front()) != nullptr, "Recently used entry survives");
+        TestRunner::assertTrue(small.find(keys[1]) == nullptr, "Least recently used entry is evicted");
+        TestRunner::assertTrue(small.find(keys.back()) != nullptr, "Newest entry is kept");
+        TestRunner::assertTrue(small.memoryBytes() >= counters.bytes, "Memory includes the entries");
+
+        small.insert(ParseResultCache::makeKey("huge", options), std::string(16 * 1024, 'x'), stats);
+        TestRunner::assertTrue(small.stats().entries == counters.entries, "Oversized result is not cached");
+
+        small.setCapacity(0);
+        TestRunner::assertTrue(!small.enabled() && small.stats().entries == 0 && small.stats().bytes == 0,
+                               "Zero capacity empties the cache");
+        small.insert(keys.back(), payload, stats);
+        TestRunner::assertTrue(small.find(keys.back()) == nullptr, "Disabled cache stores nothing");
+
+        cache.clear();
+        TestRunner::assertTrue(cache.find(key) == nullptr && cache.stats().hits == 1, "Clear keeps the counters");
+    }
+
+    static void testBlockMemo() {
+        ParserOptions options{true, true};
+        MD4CParser parser;
+        parser.blockMemo().setCapacity(BlockMemo::kDefaultCapacityBytes);
+        auto parse = [&](const std::string& text) {
+            return MarkdownJsonSerializer::toJson(parser.parse(text, options), &parser.blockMemo());
+        };
+        auto fresh = [&](const std::string& text) {
+            return MarkdownJsonSerializer::toJson(MD4CParser().parse(text, options));
+        };
+
+        std::string document = referenceDocument();
+        TestRunner::assertEqual(fresh(document), parse(document), "First parse matches an unmemoized parse");
+        auto first = parser.blockMemo().stats();
+        TestRunner::assertTrue(first.misses > 0 && first.entries > 0, "First parse fills the memo");
+
+        std::string again = parse(document);
+        auto second = parser.blockMemo().stats();
+        TestRunner::assertEqual(fresh(document), again, "Reparse from the memo matches");
+        TestRunner::assertTrue(second.hits > first.hits && second.misses == first.misses,
+                               "Unchanged document reuses every block");
+
+        // Each version differs from the last in one block, or in something
+        // that changes how unchanged blocks render.
+        const char* versions[] = {
+            "# Title\n\nSee [the docs][ref] and *this*.\n\n- one\n- two\n\n```\ncode\n```\n",
+            "# Title\n\nSee [the docs][ref] and *this*.\n\n- one\n- two\n\n```\ncode\n```\n\n[ref]: /docs\n",
+            "# Title\n\nSee [the docs][ref] and *this*.\n\n- one\n- two\n\n```\ncode\n```\n\n[ref]: /other\n",
+            "# Title changed\n\nSee [the docs][ref] and *this*.\n\n- one\n- two\n\n```\ncode\n```\n\n[ref]: /other\n",
+            "# Title changed\n\nSee [the docs][ref] and *this*.\n\n- one\n\n- two\n\n```\ncode\n```\n\n[ref]: /other\n",
+            "# Title changed\n\nSee [the docs][ref] and *this*.\n===\n\n- one\n\n- two\n\n```\ncode\n",
+            "```\ncode\n```\n\n# Title changed\n\n- one\n\n- two\n",
+            "| a | b |\n|---|---|\n| 1 | 2 |\n\n# Title changed\n",
+            "| a | b |\n|---|---|\n| 1 | 2 |\nlazy row\n\n# Title changed",
+        };
+        bool matches = true;
+        for (const char* version : versions) {
+            matches = matches && parse(version) == fresh(version);
+        }
+        TestRunner::assertTrue(matches, "Edited versions match unmemoized parses");
+        TestRunner::assertTrue(parser.blockMemo().stats().hits > second.hits, "Edited versions reuse blocks");
+
+        // Options are part of the key.
+        ParserOptions commonmark{false, false};
+        std::string table = "| a |\n|---|\n| ~~b~~ |\n";
+        parse(table);
+        TestRunner::assertEqual(MarkdownJsonSerializer::toJson(MD4CParser().parse(table, commonmark)),
+                                MarkdownJsonSerializer::toJson(parser.parse(table, commonmark), &parser.blockMemo()),
+                                "Blocks are not shared between dialects");
+
+        // Deferred parses neither use nor fill the memo.
+        auto before = parser.blockMemo().stats();
+        ParserOptions deferred = options;
+        deferred.deferInlines = true;
+        auto root = parser.parse(document, deferred);
+        TestRunner::assertTrue(parser.blockMemo().stats().hits == before.hits &&
+                               parser.blockMemo().stats().misses == before.misses,
+                               "Deferred parse bypasses the memo");
+        TestRunner::assertTrue(std::any_of(root->children.begin(), root->children.end(),
+                                           [](const auto& child) { return child->blockId.has_value(); }),
+                               "Deferred parse still defers");
+
+        // A parse cut short by its budget keeps its unfinished block out.
+        ParserOptions budget = options;
+        budget.maxOperations = 20;
+        std::string longDocument = "# Head\n\n";
+        for (int i = 0; i < 200; i++) longDocument += "line *b* [c] `d`\n";
+        parser.parse(longDocument, budget);
+        TestRunner::assertTrue(parser.lastStats().budgetExceeded, "Budget is exceeded");
+        TestRunner::assertEqual(fresh(longDocument), parse(longDocument), "Cut block is not memoized");
+
+        // Budgeted parses bypass the memo, so where they stop does not
+        // depend on what earlier parses left in it.
+        std::string blocks;
+        for (int i = 0; i < 100; i++) blocks += "Block " + std::to_string(i) + " *b* [c] `d`\n\n";
+        parse(blocks);
+        budget.maxOperations = 1000;
+        before = parser.blockMemo().stats();
+        auto cut = MarkdownJsonSerializer::toJson(parser.parse(blocks, budget));
+        ParseStats memoStats = parser.lastStats();
+        MD4CParser unmemoized;
+        auto expected = MarkdownJsonSerializer::toJson(unmemoized.parse(blocks, budget));
+        TestRunner::assertTrue(memoStats.budgetExceeded && parser.blockMemo().stats().hits == before.hits,
+                               "Budgeted parse bypasses the memo");
+        TestRunner::assertTrue(cut == expected && memoStats.operations == unmemoized.lastStats().operations &&
+                                   memoStats.plainTextOffset == unmemoized.lastStats().plainTextOffset,
+                               "Budgeted parse stops where an unmemoized one does");
+
+        MemoryFootprint footprint = parser.memoryFootprint();
+        TestRunner::assertTrue(footprint.cacheBytes >= parser.blockMemo().stats().bytes,
+                               "Memo is counted as cache");
+
+        parser.blockMemo().setCapacity(0);
+        TestRunner::assertTrue(parser.blockMemo().stats().entries == 0, "Zero capacity empties the memo");
+        TestRunner::assertEqual(fresh(document), parse(document), "Disabled memo parses normally");
+    }
+
+    static void testAstCacheFile() {
+        ParserOptions options{true, true};
+        auto document = MD4CParser().parse(referenceDocument(), options);
+        std::string json = MarkdownJsonSerializer::toJson(document);
+
+        std::string record = AstCacheFile::encode(*document);
+        std::string fromRecord;
+        TestRunner::assertTrue(AstCacheFile::appendJson(fromRecord, record), "Record is well-formed");
+        TestRunner::assertEqual(json, fromRecord, "JSON from a record matches the serializer");
+        TestRunner::assertEqual(json, MarkdownJsonSerializer::toJson(AstCacheFile::decode(record)),
+                                "Decoded record matches the tree");
+        TestRunner::assertTrue(record.size() < json.size() / 2, "Records are smaller than their JSON");
+
+        // Every field, negative numbers and the default alignment, which the
+        // JSON leaves out but the tree keeps.
+        MarkdownNode node(NodeType::TableCell);
+        node.content = "a\"b\n";
+        node.level = -3;
+        node.href = "https://example.com";
+        node.title = "";
+        node.alt = "alt";
+        node.language = "c";
+        node.ordered = false;
+        node.start = 1 << 30;
+        node.checked = true;
+        node.isHeader = false;
+        node.align = TextAlign::Default;
+        node.blockId = 0;
+        node.sourceStart = -1;
+        node.sourceEnd = 12345;
+        auto decoded = AstCacheFile::decode(AstCacheFile::encode(node));
+        TestRunner::assertTrue(decoded && decoded->align == TextAlign::Default && decoded->ordered == false &&
+                                   decoded->level == -3 && decoded->title == "",
+                               "Every field survives a round trip");
+        std::string nodeJson;
+        AstCacheFile::appendJson(nodeJson, AstCacheFile::encode(node));
+        TestRunner::assertEqual(MarkdownJsonSerializer::toJson(std::make_shared<MarkdownNode>(node)), nodeJson,
+                                "JSON of every field matches the serializer");
+
+        bool rejected = true;
+        for (size_t length = 0; length < record.size(); length += 7) {
+            std::string out;
+            rejected = rejected && !AstCacheFile::decode(record.substr(0, length)) &&
+                       !AstCacheFile::appendJson(out, record.substr(0, length));
+        }
+        TestRunner::assertTrue(rejected, "Truncated records are rejected");
+        TestRunner::assertTrue(!AstCacheFile::decode(record + "x"), "Trailing bytes are rejected");
+
+        std::string path = (std::filesystem::temp_directory_path() / "nitro-markdown-ast-cache-test.bin").string();
+        std::remove(path.c_str());
+        auto key = ParseResultCache::makeKey(referenceDocument(), options);
+        auto other = ParseResultCache::makeKey("# Other", options);
+        ParseStats stats;
+        stats.operations = 42;
+
+        AstCacheFile cache;
+        TestRunner::assertTrue(!cache.open(path) && cache.isOpen(), "Missing file opens empty");
+        TestRunner::assertTrue(!cache.find(key), "Empty cache misses");
+        cache.add(key, record, stats);
+        cache.add(other, AstCacheFile::encode(*MD4CParser().parse("# Other", options)), stats);
+        TestRunner::assertTrue(cache.find(key).has_value(), "Added record is found before saving");
+        TestRunner::assertTrue(cache.save(), "Cache is saved");
+        TestRunner::assertTrue(cache.stats().pendingBytes == 0 && cache.stats().entries == 2,
+                               "Saved records are mapped again");
+
+        AstCacheFile reopened;
+        TestRunner::assertTrue(reopened.open(path), "Saved file opens");
+        auto hit = reopened.find(key);
+        std::string fromFile;
+        TestRunner::assertTrue(hit && AstCacheFile::appendJson(fromFile, hit->record) && hit->stats.operations == 42,
+                               "Record and stats are read from the file");
+        TestRunner::assertEqual(json, fromFile, "JSON from the file matches the serializer");
+        TestRunner::assertTrue(!reopened.find(ParseResultCache::makeKey("# Missing", options)), "Unknown text misses");
+        TestRunner::assertTrue(reopened.stats().hits == 1 && reopened.stats().misses == 1, "Hits and misses are counted");
+        TestRunner::assertTrue(reopened.memoryBytes() < reopened.stats().mappedBytes,
+                               "Mapped records are not copied to the heap");
+
+        auto readFile = [&]() {
+            std::ifstream in(path, std::ios::binary);
+            return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        };
+        auto writeFile = [&](const std::string& bytes) {
+            std::ofstream(path, std::ios::binary | std::ios::trunc) << bytes;
+        };
+        std::string saved = readFile();
+
+        // A file from another parser version is ignored.
+        std::string stale = saved;
+        stale[12] ^= 0x7f;
+        writeFile(stale);
+        TestRunner::assertTrue(!AstCacheFile().open(path), "Other parser version is rejected");
+        writeFile(saved.substr(0, saved.size() - 1));
+        TestRunner::assertTrue(!AstCacheFile().open(path), "Truncated file is rejected");
+
+        // A damaged record is a miss; the other record is still served.
+        std::string damaged = saved;
+        damaged[damaged.size() - 3] ^= 0x01;
+        writeFile(damaged);
+        AstCacheFile partial;
+        TestRunner::assertTrue(partial.open(path), "File with a damaged record opens");
+        bool keyHit = partial.find(key).has_value();
+        bool otherHit = partial.find(other).has_value();
+        TestRunner::assertTrue(keyHit != otherHit, "Only the damaged record misses");
+
+        // Saving keeps the newest results within the size limit.
+        writeFile(saved);
+        AstCacheFile bounded;
+        bounded.open(path, saved.size() + 64);
+        auto newest = ParseResultCache::makeKey("newest", options);
+        bounded.add(newest, std::string(record.size() / 2, '\0'), stats);
+        TestRunner::assertTrue(bounded.save(), "Bounded cache is saved");
+        TestRunner::assertTrue(bounded.stats().mappedBytes <= saved.size() + 64, "Saved file respects the limit");
+        TestRunner::assertTrue(bounded.find(newest).has_value() && bounded.find(other).has_value() &&
+                                   !bounded.find(key).has_value(),
+                               "Oldest large record is dropped first");
+
+        bounded.close();
+        TestRunner::assertTrue(!bounded.isOpen() && bounded.stats().entries == 0, "Closing drops everything");
+        std::remove(path.c_str());
+    }
+
+    static void testTaskScheduler() {
+        using Priority = TaskScheduler::Priority;
+        {
+            TaskScheduler scheduler(2);
+            TaskScheduler::Group group;
+            std::atomic<int> sum{0};
+            for (int i = 1; i <= 100; i++) {
+                TestRunner::assertTrue(scheduler.submit(group, Priority::Visible, [&, i] { sum += i; }),
+                                       "Task is queued");
+            }
+            group.wait();
+            TestRunner::assertTrue(sum == 5050 && scheduler.stats().executed == 100, "Every task runs once");
+        }
+
+        // One worker, held by a task until everything else is queued.
+        auto blocked = [](TaskScheduler& scheduler, TaskScheduler::Group& group, std::atomic<bool>& release) {
+            std::atomic<bool> started{false};
+            scheduler.submit(group, Priority::Visible, [&] {
+                started = true;
+                while (!release) std::this_thread::yield();
+            });
+            while (!started) std::this_thread::yield();
+        };
+        {
+            TaskScheduler scheduler(1);
+            TaskScheduler::Group group;
+            std::atomic<bool> release{false};
+            blocked(scheduler, group, release);
+            std::string order;
+            std::mutex orderMutex;
+            auto record = [&](char c) {
+                return [&, c] {
+                    std::lock_guard<std::mutex> lock(orderMutex);
+                    order += c;
+                };
+            };
+            scheduler.submit(group, Priority::Prefetch, record('p'));
+            scheduler.submit(group, Priority::Visible, record('a'));
+            scheduler.submit(group, Priority::Prefetch, record('q'));
+            scheduler.submit(group, Priority::Visible, record('b'));
+            release = true;
+            group.wait();
+            TestRunner::assertEqual("abpq", order, "Visible tasks run before prefetch, oldest first");
+        }
+        {
+            // Subtasks go to the submitting worker's deque while it is busy
+            // waiting for them, so the other worker has to steal them all.
+            TaskScheduler scheduler(2);
+            TaskScheduler::Group outer;
+            std::atomic<int> done{0};
+            scheduler.submit(outer, Priority::Visible, [&] {
+                TaskScheduler::Group inner;
+                for (int i = 0; i < 8; i++) scheduler.submit(inner, Priority::Visible, [&] { done++; });
+                while (done < 8) std::this_thread::yield();
+                inner.wait();
+            });
+            outer.wait();
+            TestRunner::assertTrue(done == 8 && scheduler.stats().stolen == 8, "Idle worker steals queued tasks");
+        }
+        {
+            TaskScheduler scheduler(1);
+            TaskScheduler::Group holder;
+            std::atomic<bool> release{false};
+            blocked(scheduler, holder, release);
+            TaskScheduler::Group group;
+            std::atomic<int> ran{0};
+            for (int i = 0; i < 5; i++) scheduler.submit(group, Priority::Visible, [&] { ran++; });
+            group.cancel();
+            TestRunner::assertTrue(group.cancelled() && !scheduler.submit(group, Priority::Visible, [&] { ran++; }),
+                                   "Cancelled group takes no new tasks");
+            group.wait();
+            release = true;
+            holder.wait();
+            // Dropped tasks are counted when a worker reaches them.
+            TaskScheduler::Group last;
+            scheduler.submit(last, Priority::Prefetch, [] {});
+            last.wait();
+            TestRunner::assertTrue(ran == 0 && scheduler.stats().cancelled == 5, "Cancelled tasks do not run");
+        }
+        {
+            TaskScheduler scheduler(1, 4);
+            TaskScheduler::Group group;
+            std::atomic<bool> release{false};
+            blocked(scheduler, group, release);
+            bool accepted = true;
+            for (int i = 0; i < 4; i++) accepted = scheduler.submit(group, Priority::Prefetch, [] {}) && accepted;
+            bool rejected = !scheduler.submit(group, Priority::Visible, [] {});
+            TestRunner::assertTrue(accepted && rejected && scheduler.stats().rejected == 1 &&
+                                       scheduler.stats().queued == 4,
+                                   "Queue is bounded");
+            release = true;
+            group.wait();
+            TestRunner::assertTrue(scheduler.stats().queued == 0, "Queue drains");
+        }
+        {
+            TaskScheduler scheduler(1);
+            TaskScheduler::Group group;
+            scheduler.submit(group, Priority::Visible, [] { throw std::runtime_error("task failed"); });
+            bool threw = false;
+            try {
+                group.wait();
+            } catch (const std::runtime_error&) {
+                threw = true;
+            }
+            TestRunner::assertTrue(threw, "Task exception is rethrown by wait");
+        }
+    }
+
+    static void testBatchParser() {
+        ParserOptions options{true, true};
+        std::string base = referenceDocument();
+        std::vector<std::string> texts;
+        for (size_t i = 0; i < 120; i++) {
+            // Sizes from a few bytes to a few copies of the reference, so
+            // that the largest-first order differs from the input order.
+            size_t copies = i % 7;
+            std::string text = "# Message " + std::to_string(i) + "\n\n";
+            for (size_t c = 0; c < copies; c++) text += base;
+            texts.push_back(text);
+        }
+        std::vector<BatchParser::Document> documents;
+        for (const auto& text : texts) documents.push_back({text});
+
+        TaskScheduler scheduler(BatchParser::kMaxThreads - 1);
+        BatchParser batch(BatchParser::kMaxThreads, scheduler);
+        size_t totalBytes = 0;
+        for (const auto& text : texts) totalBytes += text.size();
+        TestRunner::assertTrue(batch.threadsFor(texts.size(), totalBytes) == BatchParser::kMaxThreads,
+                               "Large batch uses every thread");
+        TestRunner::assertTrue(batch.threadsFor(texts.size(), 1024) == 1 && batch.threadsFor(1, totalBytes) == 1,
+                               "Small batch stays on the calling thread");
+        TestRunner::assertTrue(BatchParser(1000, scheduler).threads() == BatchParser::kMaxThreads, "Threads are capped");
+        TaskScheduler small(1);
+        TestRunner::assertTrue(BatchParser(0, small).threads() == 2, "Threads are limited by the scheduler");
+
+        batch.parse(documents, options, true);
+        bool matches = true;
+        bool recordsMatch = true;
+        MD4CParser parser;
+        for (size_t i = 0; i < texts.size(); i++) {
+            auto root = parser.parse(texts[i], options);
+            std::string expected = MarkdownJsonSerializer::toJson(root);
+            matches = matches && documents[i].json == expected &&
+                      documents[i].stats.operations == parser.lastStats().operations;
+            std::string fromRecord;
+            recordsMatch = recordsMatch && AstCacheFile::appendJson(fromRecord, documents[i].record) &&
+                           fromRecord == expected;
+        }
+        TestRunner::assertTrue(matches, "Every document matches a sequential parse");
+        TestRunner::assertTrue(recordsMatch, "Records are encoded on request");
+
+        std::vector<BatchParser::Document> none;
+        batch.parse(none, options);
+        TestRunner::assertTrue(none.empty(), "Empty batch is a no-op");
+
+        ParserOptions deferred = options;
+        deferred.deferInlines = true;
+        bool threw = false;
+        try {
+            batch.parse(documents, deferred);
+        } catch (const std::invalid_argument&) {
+            threw = true;
+        }
+        TestRunner::assertTrue(threw, "Deferred inlines are rejected");
+
+        std::vector<size_t> offsets;
+        std::string joined = BatchParser::joinJson(
+            {"{\"a\":\"\xF0\x9F\x98\x80\"}", "{\"b\":\"caf\xC3\xA9\"}", "{}"}, offsets);
+        std::u16string utf16 = u"[{\"a\":\"\U0001F600\"},{\"b\":\"caf\u00E9\"},{}]";
+        auto document = [&](size_t i) { return utf16.substr(offsets[i], offsets[i + 1] - 1 - offsets[i]); };
+        TestRunner::assertTrue(offsets.size() == 4 && offsets.back() == utf16.size() &&
+                                   Utf16::length(joined) == utf16.size(),
+                               "Batch offsets end at the array's length");
+        TestRunner::assertTrue(document(0) == u"{\"a\":\"\U0001F600\"}" && document(1) == u"{\"b\":\"caf\u00E9\"}" &&
+                                   document(2) == u"{}",
+                               "Batch offsets delimit each document in UTF-16 code units");
+        BatchParser::joinJson({}, offsets);
+        TestRunner::assertTrue(offsets.size() == 1 && offsets[0] == 2, "Empty batch has only the array's length");
+    }
+
+    static void testParserPool() {
+        ParserPool pool(2);
+        ParserOptions options{true, true};
+        {
+            auto a = pool.acquire();
+            auto b = pool.acquire();
+            auto c = pool.acquire();
+            a->parse("# A\n\nSome *text*.\n", options);
+            TestRunner::assertTrue(pool.created() == 3 && pool.idle() == 0, "Pool creates parsers on demand");
+        }
+        TestRunner::assertTrue(pool.idle() == 2, "Pool keeps at most maxIdle parsers");
+        {
+            auto again = pool.acquire();
+            TestRunner::assertTrue(pool.created() == 3 && pool.memoryFootprint().nodeBytes == 0,
+                                   "Idle parsers are reused without their trees");
+        }
+        pool.trim();
+        TestRunner::assertTrue(pool.idle() == 0, "Trim drops idle parsers");
+
+        // Sessions sharing a pool parse like sessions with their own parser.
+        std::string text = referenceDocument();
+        MarkdownSessionCore own(options);
+        MarkdownSessionCore pooled(options, &pool);
+        for (size_t i = 0; i < text.size(); i += 97) {
+            own.append(std::string_view(text).substr(i, 97));
+            pooled.append(std::string_view(text).substr(i, 97));
+            own.document();
+            pooled.document();
+        }
+        TestRunner::assertEqual(MarkdownJsonSerializer::toJson(own.document()),
+                                MarkdownJsonSerializer::toJson(pooled.document()), "Pooled session matches");
+        TestRunner::assertTrue(pooled.memoryFootprint().scratchBytes < own.memoryFootprint().scratchBytes,
+                               "Pooled session holds no parser buffers");
+    }
+
+    static void testSessionHost() {
+        using Priority = TaskScheduler::Priority;
+        ParserOptions options{true, true};
+        MD4CParser parser;
+        auto expected = [&](const std::string& text) {
+            return MarkdownJsonSerializer::toJson(parser.parse(text, options));
+        };
+        // Sessions are only reparsed in the background while they have one.
+        auto consumer = [](SessionHost::SessionId, const std::shared_ptr<MarkdownNode>&) {};
+
+        {
+            std::string base = referenceDocument();
+            TaskScheduler scheduler(2);
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 0, scheduler);
+            std::vector<SessionHost::SessionId> ids;
+            std::vector<std::string> texts(3);
+            for (size_t i = 0; i < texts.size(); i++) ids.push_back(host.open(options, consumer));
+            for (size_t offset = 0; offset < base.size(); offset += 61) {
+                for (size_t i = 0; i < texts.size(); i++) {
+                    // Each stream cuts the text at different points.
+                    std::string chunk = base.substr(offset, 61 - i * 13);
+                    texts[i] += chunk;
+                    host.append(ids[i], chunk);
+                }
+            }
+            host.flush();
+            bool matches = true;
+            for (size_t i = 0; i < texts.size(); i++) {
+                matches = matches && MarkdownJsonSerializer::toJson(host.document(ids[i])) == expected(texts[i]);
+            }
+            TestRunner::assertTrue(matches, "Every session matches a full parse");
+            auto stats = host.stats();
+            TestRunner::assertTrue(stats.sessions == 3 && stats.pending == 0 && stats.updates > 0 &&
+                                       stats.evictions == 0 && stats.treeBytes > 0,
+                                   "Host stats");
+
+            host.close(ids[0]);
+            bool threw = false;
+            try {
+                host.append(ids[0], "more");
+            } catch (const std::invalid_argument&) {
+                threw = true;
+            }
+            TestRunner::assertTrue(threw && host.stats().sessions == 2, "Closed session is gone");
+        }
+
+        {
+            TaskScheduler scheduler(1);
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 0, scheduler);
+            auto id = host.open(options);
+            host.append(id, "# Title\n\n");
+            host.append(id, "Some *text*.\n");
+            host.flush();
+            TestRunner::assertTrue(host.stats().updates == 0 && host.stats().treeBytes == 0,
+                                   "Session without a listener is not reparsed in the background");
+            auto root = host.document(id);
+            TestRunner::assertEqual(expected("# Title\n\nSome *text*.\n"), MarkdownJsonSerializer::toJson(root),
+                                    "document() parses queued text");
+            TestRunner::assertTrue(host.document(id) == root, "Current tree is not parsed again");
+            host.append(id, "More.\n");
+            TestRunner::assertEqual(std::string("# Title\n\nSome *text*.\nMore.\n"), *host.text(id),
+                                    "text() reads queued text");
+            TestRunner::assertTrue(host.document(id) != root, "New text makes the tree stale");
+
+            std::atomic<int> calls{0};
+            host.setListener(id, [&](SessionHost::SessionId, const std::shared_ptr<MarkdownNode>&) { calls++; });
+            host.append(id, "Last.\n");
+            host.flush();
+            TestRunner::assertTrue(calls == 1 && host.stats().updates == 1,
+                                   "Session with a listener is reparsed in the background");
+            TestRunner::assertEqual(expected("# Title\n\nSome *text*.\nMore.\nLast.\n"),
+                                    MarkdownJsonSerializer::toJson(host.document(id)),
+                                    "Listener is called with the published tree");
+            host.setListener(id, nullptr);
+            host.append(id, "Unheard.\n");
+            host.flush();
+            TestRunner::assertTrue(calls == 1 && host.stats().updates == 1, "Removed listener stops reparses");
+        }
+
+        {
+            // One worker, held until three sessions have text. Every update of
+            // the first session appends to it again, like a fast stream; the
+            // others still get their turn before its second update.
+            TaskScheduler scheduler(1);
+            TaskScheduler::Group holder;
+            std::atomic<bool> release{false};
+            std::atomic<bool> started{false};
+            scheduler.submit(holder, Priority::Visible, [&] {
+                started = true;
+                while (!release) std::this_thread::yield();
+            });
+            while (!started) std::this_thread::yield();
+
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 1, scheduler);
+            std::string order;
+            std::mutex orderMutex;
+            SessionHost::SessionId fast = 0;
+            int fastUpdates = 0;
+            auto listener = [&](SessionHost::SessionId id, const std::shared_ptr<MarkdownNode>&) {
+                {
+                    std::lock_guard<std::mutex> lock(orderMutex);
+                    order += static_cast<char>('A' + id - fast);
+                }
+                if (id == fast && ++fastUpdates < 5) host.append(id, "more text\n");
+            };
+            fast = host.open(options, listener);
+            auto slow1 = host.open(options, listener);
+            auto slow2 = host.open(options, listener);
+            host.append(fast, "fast\n");
+            host.append(slow1, "slow\n");
+            for (int i = 0; i < 10; i++) host.append(fast, "chunk\n");
+            host.append(slow2, "slow\n");
+            release = true;
+            holder.wait();
+            host.flush();
+            TestRunner::assertEqual("ABCAAAA", order, "Fast stream cannot starve the others");
+        }
+
+        {
+            // A budget smaller than any tree keeps only the latest one.
+            TaskScheduler scheduler(1);
+            SessionHost host(1, 0, scheduler);
+            std::vector<SessionHost::SessionId> ids;
+            for (int i = 0; i < 3; i++) {
+                ids.push_back(host.open(options, consumer));
+                host.append(ids.back(), "# Session " + std::to_string(i) + "\n\nSome *text*.\n");
+                host.flush();
+            }
+            auto stats = host.stats();
+            TestRunner::assertTrue(stats.evictions == 2 && stats.treeBytes > 0 &&
+                                       stats.textBytes == 3 * std::string("# Session 0\n\nSome *text*.\n").size(),
+                                   "Budget evicts least recently updated trees");
+            TestRunner::assertEqual(expected("# Session 0\n\nSome *text*.\n"),
+                                    MarkdownJsonSerializer::toJson(host.document(ids[0])),
+                                    "Evicted session is parsed again on demand");
+            TestRunner::assertTrue(host.stats().evictions == 3, "Rebuilt tree evicts another");
+        }
+
+        {
+            // With the only worker held, appended text is still queued.
+            TaskScheduler scheduler(1);
+            TaskScheduler::Group holder;
+            std::atomic<bool> release{false};
+            std::atomic<bool> started{false};
+            scheduler.submit(holder, Priority::Visible, [&] {
+                started = true;
+                while (!release) std::this_thread::yield();
+            });
+            while (!started) std::this_thread::yield();
+
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 1, scheduler);
+            auto id = host.open(options);
+            host.append(id, "# Title\n\n");
+            host.append(id, "Some *text*.\n");
+            TestRunner::assertEqual(std::string("# Title\n\nSome *text*.\n"), *host.text(id),
+                                    "Session text includes queued text");
+            TestRunner::assertTrue(host.memoryBytes(id) >= 22 && host.memoryBytes(id + 1) == 0,
+                                   "Session memory counts its text");
+            host.clear(id);
+            host.append(id, "After\n");
+            release = true;
+            holder.wait();
+            host.flush();
+            TestRunner::assertEqual(std::string("After\n"), *host.text(id), "Clear drops queued text");
+            TestRunner::assertEqual(expected("After\n"), MarkdownJsonSerializer::toJson(host.document(id)),
+                                    "Cleared session publishes only later text");
+            TestRunner::assertTrue(host.stats().textBytes == 6, "Clear releases the session's text bytes");
+        }
+
+        {
+            TaskScheduler scheduler(1);
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 0, scheduler);
+            auto id = host.open(options);
+            host.append(id, "# Question\n\nAnswer *one*");
+            auto snapshot = host.snapshot(id);
+            host.append(id, " continues.\n");
+            auto fork = host.open(snapshot);
+            host.append(fork, " instead.\n");
+            host.flush();
+            TestRunner::assertEqual(std::string("# Question\n\nAnswer *one* instead.\n"), *host.text(fork),
+                                    "Forked session goes on from the snapshot");
+            TestRunner::assertEqual(expected("# Question\n\nAnswer *one* continues.\n"),
+                                    MarkdownJsonSerializer::toJson(host.document(id)),
+                                    "Original session is unaffected by its fork");
+            TestRunner::assertEqual(expected("# Question\n\nAnswer *one* instead.\n"),
+                                    MarkdownJsonSerializer::toJson(host.document(fork)), "Forked session's tree");
+            TestRunner::assertEqual(std::string("# Question\n\nAnswer *one*"), *snapshot.text(),
+                                    "Snapshot keeps its text");
+        }
+
+        {
+            TaskScheduler scheduler(1);
+            SessionHost host(SessionHost::kDefaultMemoryBudget, 0, scheduler);
+            auto id = host.open(options);
+            std::string text = referenceDocument();
+            host.append(id, text);
+            host.document(id);
+            size_t treeBytes = host.stats().treeBytes;
+            size_t compacted = host.compact(id, 1024);
+            TestRunner::assertTrue(compacted > 0 && host.coldBlockCount(id) > 0 && host.stats().treeBytes == 0,
+                                   "Compaction drops the published tree");
+            auto hot = host.document(id);
+            auto cold = host.coldBlocks(id, 0, host.coldBlockCount(id));
+            auto full = parser.parse(text, options);
+            bool matches = cold && cold->size() + hot->children.size() == full->children.size();
+            for (size_t i = 0; matches && i < full->children.size(); i++) {
+                const auto& node = i < cold->size() ? (*cold)[i] : hot->children[i - cold->size()];
+                matches = dumpTree(node) == dumpTree(full->children[i]);
+            }
+            TestRunner::assertTrue(matches && host.stats().treeBytes < treeBytes,
+                                   "Cold and hot blocks of a hosted session make up the full tree");
+            TestRunner::assertTrue(host.text(id) == text, "Hosted session keeps compacted text");
+        }
+
+        TestRunner::assertTrue(&SessionHost::shared() == &SessionHost::shared(), "One shared host");
+    }
+
+    static void testTraceExport() {
+        if (!Tracer::kEnabled) return;
+
+        MD4CParser parser;
+        ParserOptions options{true, true};
+        Tracer::start();
+        auto ast = parser.parse("# Title\n\nSome *text*.\n\n```c\nint x;\n```\n\n| a |\n|---|\n| b |\n", options);
+        MarkdownJsonSerializer::toJson(ast);
+        Tracer::stop();
+        std::string trace = Tracer::toJson();
+
+        auto has = [&](const std::string& needle) { return trace.find(needle) != std::string::npos; };
+        TestRunner::assertTrue(has("\"name\":\"parse\"") && has("\"name\":\"serialize\"") &&
+                                   has("\"name\":\"analyze blocks\""),
+                               "Trace has parse, serialize and block analysis spans");
+        TestRunner::assertTrue(has("\"name\":\"leaf block: h\"") && has("\"name\":\"leaf block: p\"") &&
+                                   has("\"name\":\"leaf block: code\"") && has("\"name\":\"leaf block: table\""),
+                               "Trace has a span per leaf block type");
+        TestRunner::assertTrue(has("\"name\":\"analyze inlines\",\"cat\":\"markdown\",\"ph\":\"X\"") &&
+                                   has("\"name\":\"emit inlines\"") && has("\"args\":{\"offset\":9}"),
+                               "Inline spans are complete events with source offsets");
+        // 3 top-level spans, 4 leaf blocks, inlines of heading, paragraph and two cells.
+        TestRunner::assertTrue(Tracer::eventCount() == 3 + 4 + 2 * 4, "Every span is closed exactly once");
+
+        size_t recorded = Tracer::eventCount();
+        parser.parse("# Not recorded\n", options);
+        TestRunner::assertTrue(Tracer::eventCount() == recorded && Tracer::depth() == 0,
+                               "Nothing is recorded after stop()");
+
+        ParserOptions budget = options;
+        budget.maxOperations = 1;
+        Tracer::start();
+        parser.parse(std::string(4096, 'a') + "\n\n*b*\n", budget);
+        Tracer::stop();
+        TestRunner::assertTrue(Tracer::depth() == 0 && Tracer::toJson().find("\"name\":\"parse\"") != std::string::npos,
+                               "Spans left open by an aborted parse are closed");
+    }
+
+    static std::string recordEvents(int (*parseFn)(const MD_CHAR*, MD_SIZE, const MD_PARSER*, void*),
+                                    const std::string& markdown, unsigned flags) {
+        MD_PARSER parser = {};
+        parser.flags = flags;
+        parser.enter_block = [](MD_BLOCKTYPE type, void*, void* out) {
+            auto& events = *static_cast<std::string*>(out);
+            events += "<b";
+            events += std::to_string(type);
+            return 0;
+        };
+        parser.leave_block = [](MD_BLOCKTYPE type, void*, void* out) {
+            auto& events = *static_cast<std::string*>(out);
+            events += 'b';
+            events += std::to_string(type);
+            events += '>';
+            return 0;
+        };
+        parser.enter_span = [](MD_SPANTYPE type, void*, void* out) {
+            auto& events = *static_cast<std::string*>(out);
+            events += "<s";
+            events += std::to_string(type);
+            return 0;
+        };
+        parser.leave_span = [](MD_SPANTYPE type, void*, void* out) {
+            auto& events = *static_cast<std::string*>(out);
+            events += 's';
+            events += std::to_string(type);
+            events += '>';
+            return 0;
+        };
+        parser.text = [](MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* out) {
+            auto& events = *static_cast<std::string*>(out);
+            events += std::to_string(type);
+            events += '\'';
+            events.append(text, size);
+            events += '\'';
+            return 0;
+        };
+
+        std::string events;
+        int result = parseFn(markdown.data(), static_cast<MD_SIZE>(markdown.size()), &parser, &events);
+        return std::to_string(result) + ":" + events;
+    }
+
+    static void testSpecializedVariantsMatchGeneric() {
+        std::string markdown =
+            "# Title &amp; more\n\nText with **bold**, _em_, ~~del~~, `code`, $x^2$ and $$y$$.\n"
+            "Visit www.example.com or https://example.com/a?b or mail@example.com.\n\n"
+            "| a | b |\n|:--|--:|\n| 1 | $z$ |\n\n"
+            "- [x] done\n- [ ] todo <span>html</span>\n\n"
+            "<div>\nblock html\n</div>\n\n"
+            "    indented code\n\n```js\nfenced\n```\n\n[ref]: /url \"t\"\n\n[ref] and ![img](a.png)\n";
+
+        struct Variant {
+            const char* name;
+            int (*parseFn)(const MD_CHAR*, MD_SIZE, const MD_PARSER*, void*);
+            unsigned flags;
+        };
+        const Variant variants[] = {
+            {"GFM + math", &md_parse_gfm_math, MD_SPECIALIZED_FLAGS_GFM_MATH},
+            {"GFM", &md_parse_gfm, MD_SPECIALIZED_FLAGS_GFM},
+            {"CommonMark", &md_parse_commonmark, MD_SPECIALIZED_FLAGS_COMMONMARK},
+        };
+        for (const auto& variant : variants) {
+            TestRunner::assertEqual(recordEvents(&md_parse, markdown, variant.flags),
+                                    recordEvents(variant.parseFn, markdown, variant.flags),
+                                    std::string(variant.name) + " build matches generic parse");
+        }
+
+        TestRunner::assertTrue(
+            recordEvents(&md_parse_gfm, markdown, MD_SPECIALIZED_FLAGS_GFM_MATH) == "-1:",
+            "Specialized build rejects other flags");
+        TestRunner::assertTrue(MD4CDialect::flags(true, true) == MD_SPECIALIZED_FLAGS_GFM_MATH &&
+                                   MD4CDialect::flags(true, false) == MD_SPECIALIZED_FLAGS_GFM &&
+                                   MD4CDialect::flags(false, false) == MD_SPECIALIZED_FLAGS_COMMONMARK,
+                               "Common dialects have specialized builds");
+    }
+
+    static void testUtf16Offsets() {
+        std::string text = "a\u00e9\u4e16\U0001F30D";
+        TestRunner::assertTrue(Utf16::length(text) == std::u16string(u"a\u00e9\u4e16\U0001F30D").size(),
+                               "UTF-16 length of UTF-8 text");
+
+        // Byte offsets of a deferred parse map to indices into the same text
+        // as UTF-16, i.e. into the JS string.
+        std::string markdown = "\U0001F30D \u4e16\u754c\n\n# \u898b\u51fa\u3057 *\U0001F600*\n\n- \u9805\u76ee\n";
+        std::u16string units = u"\U0001F30D \u4e16\u754c\n\n# \u898b\u51fa\u3057 *\U0001F600*\n\n- \u9805\u76ee\n";
+        ParserOptions options{true, true};
+        options.deferInlines = true;
+        MD4CParser parser;
+        auto skeleton = parser.parse(markdown, options);
+        Utf16::OffsetMap offsets(markdown);
+        std::vector<std::u16string> sources;
+        std::function<void(const MarkdownNode&)> collect = [&](const MarkdownNode& node) {
+            if (node.sourceStart && node.sourceEnd) {
+                size_t start = offsets(static_cast<size_t>(*node.sourceStart));
+                size_t end = offsets(static_cast<size_t>(*node.sourceEnd));
+                sources.push_back(units.substr(start, end - start));
+            }
+            for (const auto& child : node.children) collect(*child);
+        };
+        collect(*skeleton);
+        TestRunner::assertTrue(sources.size() == 3 && sources[0] == u"\U0001F30D \u4e16\u754c" &&
+                                   sources[1] == u"\u898b\u51fa\u3057 *\U0001F600*" && sources[2] == u"\u9805\u76ee",
+                               "Deferred source ranges map to UTF-16 indices");
+        TestRunner::assertTrue(offsets(markdown.find('#')) == units.find(u'#') && offsets(0) == 0 &&
+                                   offsets(markdown.size()) == units.size(),
+                               "Offsets may go back");
+    }
+
+    static void testMappedFile() {
+        std::string path = (std::filesystem::temp_directory_path() / "nitro-markdown-mapped-test.md").string();
+        std::string markdown = referenceDocument();
+        {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            file << markdown;
+        }
+        TestRunner::assertTrue(!MappedFile::open(path + ".missing"), "Missing file does not open");
+        auto file = MappedFile::open(path);
+        TestRunner::assertTrue(file && file->text() == markdown, "Mapped file holds the file's text");
+
+        ParserOptions options{true, true};
+        auto full = MD4CParser().parse(markdown, options);
+        options.deferInlines = true;
+        MD4CParser parser;
+        auto skeleton = parser.parse(file->text(), options, file);
+        TestRunner::assertTrue(file.use_count() == 2, "Deferred parse keeps the mapping");
+        TestRunner::assertTrue(parser.memoryFootprint().inputBytes == 0, "Mapped text is not copied");
+        std::weak_ptr<const MappedFile> mapping = file;
+        file.reset();
+        std::vector<std::shared_ptr<MarkdownNode>> pending{skeleton};
+        while (!pending.empty()) {
+            auto node = pending.back();
+            pending.pop_back();
+            if (node->blockId) parser.parseInlines(*node->blockId);
+            for (const auto& child : node->children) pending.push_back(child);
+        }
+        TestRunner::assertEqual(dumpTree(full), dumpTree(skeleton),
+                                "Blocks deferred from a mapping materialize like a full parse");
+        parser.parse("# Next", options);
+        TestRunner::assertTrue(mapping.expired(), "Next parse lets go of the mapping");
+
+        options.deferInlines = false;
+        auto eager = MappedFile::open(path);
+        parser.parse(eager->text(), options, eager);
+        TestRunner::assertTrue(eager.use_count() == 1, "Parse without deferred blocks does not keep the mapping");
+        std::remove(path.c_str());
+
+        { std::ofstream empty(path, std::ios::binary | std::ios::trunc); }
+        auto emptyFile = MappedFile::open(path);
+        TestRunner::assertTrue(emptyFile && emptyFile->size() == 0, "Empty file opens empty");
+        TestRunner::assertTrue(parser.parse(emptyFile->text(), options, emptyFile)->children.empty(),
+                               "Empty mapped file parses to an empty document");
+        std::remove(path.c_str());
+    }
+
+    static void testHtmlRenderer() {
+        TestRunner::assertEqual(
+            "<h1>Title <em>x</em></h1>\n<p>Some <strong>bold</strong>, <del>gone</del> and <code>a &lt; b</code>.<br>\n"
+            "next\nline</p>\n",
+            *MarkdownHtmlRenderer::render("# Title *x*\n\nSome **bold**, ~~gone~~ and `a < b`.  \nnext\nline\n"),
+            "Blocks and spans render as HTML");
+        TestRunner::assertEqual(
+            "<blockquote>\n<p>quote</p>\n</blockquote>\n<ol start=\"3\">\n<li>three</li>\n</ol>\n<ul>\n"
+            "<li class=\"task-list-item\"><input type=\"checkbox\" disabled checked> done</li>\n"
+            "<li class=\"task-list-item\"><input type=\"checkbox\" disabled> open</li>\n</ul>\n<hr>\n",
+            *MarkdownHtmlRenderer::render("> quote\n\n3. three\n\n- [x] done\n- [ ] open\n\n---\n"),
+            "Quotes, lists and task items render as HTML");
+        TestRunner::assertEqual(
+            "<table>\n<thead>\n<tr>\n<th align=\"left\">a</th>\n<th align=\"right\">b</th>\n</tr>\n</thead>\n"
+            "<tbody>\n<tr>\n<td align=\"left\">1</td>\n<td align=\"right\"><em>2</em></td>\n</tr>\n</tbody>\n"
+            "</table>\n",
+            *MarkdownHtmlRenderer::render("| a | b |\n|:--|--:|\n| 1 | *2* |\n"), "Tables keep their alignment");
+        TestRunner::assertEqual("<pre><code class=\"language-c&quot;x\">int a &amp;&amp; b;\n</code></pre>\n",
+                                *MarkdownHtmlRenderer::render("```c\"x\nint a && b;\n```\n"),
+                                "Code blocks carry their language");
+        TestRunner::assertEqual(
+            "<p><a href=\"https://example.com/a%20b?q=1&amp;r=%22\" title=\"T &amp; &quot;t&quot;\">link</a> "
+            "<img src=\"/img.png\" alt=\"an image\" title=\"pic\"></p>\n",
+            *MarkdownHtmlRenderer::render("[link](<https://example.com/a b?q=1&r=\"> \"T & \\\"t\\\"\") "
+                                         "![an *image*](/img.png \"pic\")\n"),
+            "Links and images render with escaped attributes");
+        TestRunner::assertEqual("<p>\xC2\xA9 \xF0\x9F\x98\x80 &amp;bogus;</p>\n",
+                                *MarkdownHtmlRenderer::render("&copy; &#x1F600; &bogus;\n"),
+                                "Entities are decoded and escaped again");
+
+        std::string math = "Inline $x^2$ and $$\\sum_i a_i$$\n";
+        TestRunner::assertEqual(
+            "<p>Inline <span class=\"math math-inline\">x^2</span> and "
+            "<span class=\"math math-display\">\\sum_i a_i</span></p>\n",
+            *MarkdownHtmlRenderer::render(math), "Math renders in spans with math classes");
+        HtmlRenderOptions delimiters;
+        delimiters.mathDelimiters = true;
+        TestRunner::assertEqual("<p>Inline \\(x^2\\) and \\[\\sum_i a_i\\]</p>\n",
+                                *MarkdownHtmlRenderer::render(math, delimiters),
+                                "Math renders between delimiters for MathJax and KaTeX");
+        HtmlRenderOptions commonmark;
+        commonmark.gfm = false;
+        commonmark.math = false;
+        TestRunner::assertEqual("<p>| a |\n|---|\n~~x~~ $y$</p>\n",
+                                *MarkdownHtmlRenderer::render("| a |\n|---|\n~~x~~ $y$\n", commonmark),
+                                "Without gfm and math their syntax stays text");
+
+        std::string out = "<body>";
+        TestRunner::assertTrue(MarkdownHtmlRenderer::appendHtml(out, "hi", HtmlRenderOptions{}),
+                               "appendHtml reports success");
+        TestRunner::assertEqual("<body><p>hi</p>\n", out, "appendHtml appends to the buffer");
+        TestRunner::assertEqual("", *MarkdownHtmlRenderer::render(""), "Empty input renders nothing");
+    }
+
+    static void testHtmlSafety() {
+        TestRunner::assertEqual("<p>&lt;script&gt;alert(&quot;x&quot;)&lt;/script&gt;</p>\n",
+                                *MarkdownHtmlRenderer::render("<script>alert(\"x\")</script>\n"),
+                                "Raw HTML renders as text");
+        TestRunner::assertEqual("<p><a href=\"\">a</a> <a href=\"\">b</a> <a href=\"\">c</a> <a href=\"\">d</a> "
+                                "<a href=\"\">e</a></p>\n",
+                                *MarkdownHtmlRenderer::render("[a](javascript:alert(1)) [b](JaVaScRiPt:x) "
+                                                             "[c](&#106;avascript:x) [d](<java\tscript:x>) "
+                                                             "[e](vbscript:x)\n"),
+                                "Script URLs are dropped however they are spelled");
+        TestRunner::assertEqual("<p><img src=\"\" alt=\"a\"> <img src=\"data:image/png;base64,AAAA\" alt=\"b\"> "
+                                "<a href=\"\">c</a> <a href=\"relative/path.md#frag\">d</a></p>\n",
+                                *MarkdownHtmlRenderer::render("![a](data:text/html;base64,AAAA) "
+                                                             "![b](data:image/png;base64,AAAA) [c](file:///etc/passwd) "
+                                                             "[d](relative/path.md#frag)\n"),
+                                "Only data: images in raster formats are kept");
+        TestRunner::assertEqual("<p><img src=\"x.png\" alt=\"&quot; onerror=&quot;alert(1)\"></p>\n",
+                                *MarkdownHtmlRenderer::render("![\" onerror=\"alert(1)](x.png)\n"),
+                                "Alt text cannot break out of its attribute");
+        std::string nul("a\0b\n", 4);
+        TestRunner::assertEqual("<p>a\xEF\xBF\xBD" "b</p>\n", *MarkdownHtmlRenderer::render(nul),
+                                "Null characters become U+FFFD");
+        TestRunner::assertEqual("<pre><code>a\xEF\xBF\xBD" "b\n</code></pre>\n",
+                                *MarkdownHtmlRenderer::render(std::string("    a\0b\n", 8)),
+                                "Null characters in code become U+FFFD once");
+    }
+
+    static void testHtmlHeadingAnchors() {
+        HtmlRenderOptions options;
+        TestRunner::assertEqual("<h2>Intro</h2>\n", *MarkdownHtmlRenderer::render("## Intro\n", options),
+                                "Headings have no id by default");
+        options.headingAnchors = true;
+        TestRunner::assertEqual(
+            "<h1 id=\"hello-world\">Hello, <em>World</em>!</h1>\n<h2 id=\"hello-world-1\">Hello World</h2>\n"
+            "<h2 id=\"hello-world-2\">Hello world</h2>\n<h3 id=\"hello-world-1-1\">Hello World 1</h3>\n",
+            *MarkdownHtmlRenderer::render("# Hello, *World*!\n## Hello World\n## Hello world\n### Hello World 1\n",
+                                         options),
+            "Heading ids are slugs of their text, unique in the document");
+        TestRunner::assertEqual(
+            "<h2 id=\"a--b_c-\xE6\x97\xA5\xE6\x9C\xAC\">A &amp; B_c <code>&lt;\xE6\x97\xA5\xE6\x9C\xAC&gt;</code></h2>\n"
+            "<h2 id=\"section\">?!</h2>\n<h2 id=\"one-two\">one<br>\ntwo</h2>\n",
+            *MarkdownHtmlRenderer::render("## A & B_c `<\xE6\x97\xA5\xE6\x9C\xAC>`\n## ?!\none\\\ntwo\n---\n",
+                                         options),
+            "Slugs drop punctuation and keep non-ASCII letters");
+    }
 };
 
 } // namespace NitroMarkdown
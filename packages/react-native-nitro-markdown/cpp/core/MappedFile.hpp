@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+/**
+ * A file mapped read-only into memory, so that a large document, e.g. one
+ * bundled with the app or downloaded, is parsed where it lies instead of
+ * being read into a string first. The pages are backed by the file: they
+ * cost no heap and the OS can drop them again under pressure.
+ *
+ * Shared, so that whatever still reads from the mapping, e.g. a parser
+ * keeping the text of deferred blocks, keeps it mapped. The file must not
+ * be truncated while it is.
+ */
+class MappedFile {
+public:
+    // The file at path, or nullptr if it cannot be opened or mapped.
+    static std::shared_ptr<const MappedFile> open(const std::string& path);
+
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    std::string_view text() const { return std::string_view(data_, size_); }
+    size_t size() const { return size_; }
+
+private:
+    MappedFile(const char* data, size_t size) : data_(data), size_(size) {}
+
+    // Null for an empty file, which is not mapped.
+    const char* data_;
+    size_t size_;
+};
+
+} // namespace NitroMarkdown
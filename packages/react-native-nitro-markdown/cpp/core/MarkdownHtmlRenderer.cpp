@@ -0,0 +1,473 @@
+#include "MarkdownHtmlRenderer.hpp"
+#include "HtmlEntities.hpp"
+#include "MD4CDialect.hpp"
+#include "Tracer.hpp"
+#include "../md4c/md4c.h"
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace NitroMarkdown {
+
+namespace {
+
+inline char toLowerAscii(char c) {
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+inline bool isAlnumAscii(char c) {
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// Escapes what would end text or a double-quoted attribute value.
+void appendEscaped(std::string& out, const char* text, size_t size) {
+    const char* end = text + size;
+    const char* run = text;
+    for (const char* p = text; p < end; p++) {
+        const char* replacement;
+        switch (*p) {
+            case '&': replacement = "&amp;"; break;
+            case '<': replacement = "&lt;"; break;
+            case '>': replacement = "&gt;"; break;
+            case '"': replacement = "&quot;"; break;
+            default: continue;
+        }
+        out.append(run, p - run);
+        out += replacement;
+        run = p + 1;
+    }
+    out.append(run, end - run);
+}
+
+void appendEscaped(std::string& out, std::string_view text) {
+    appendEscaped(out, text.data(), text.size());
+}
+
+// Whether url starts with scheme, which is lowercase, as a browser reads it:
+// case-insensitively and skipping spaces and control characters.
+bool hasScheme(std::string_view url, std::string_view scheme) {
+    size_t i = 0;
+    for (char expected : scheme) {
+        while (i < url.size() && static_cast<unsigned char>(url[i]) <= 0x20) i++;
+        if (i == url.size() || toLowerAscii(url[i]) != expected) return false;
+        i++;
+    }
+    return true;
+}
+
+bool isSafeUrl(std::string_view url) {
+    if (hasScheme(url, "javascript:") || hasScheme(url, "vbscript:") || hasScheme(url, "file:")) return false;
+    if (!hasScheme(url, "data:")) return true;
+    return hasScheme(url, "data:image/png") || hasScheme(url, "data:image/gif") ||
+           hasScheme(url, "data:image/jpeg") || hasScheme(url, "data:image/webp");
+}
+
+// Writes a safe URL with what cannot stand in an attribute as it is, e.g.
+// spaces, quotes and non-ASCII bytes, percent-encoded; an unsafe one as "".
+void appendUrl(std::string& out, std::string_view url) {
+    if (!isSafeUrl(url)) return;
+    static const char kHex[] = "0123456789ABCDEF";
+    static const std::string_view kKept = "-_.~!*'();:@=+$,/?#[]%";
+    for (char c : url) {
+        if (isAlnumAscii(c) || kKept.find(c) != std::string_view::npos) {
+            out += c;
+        } else if (c == '&') {
+            out += "&amp;";
+        } else {
+            auto byte = static_cast<unsigned char>(c);
+            out += '%';
+            out += kHex[byte >> 4];
+            out += kHex[byte & 15];
+        }
+    }
+}
+
+class Renderer {
+public:
+    Renderer(std::string& out, const HtmlRenderOptions& options) : out_(out), options_(options) {}
+
+    static int enterBlock(MD_BLOCKTYPE type, void* detail, void* userdata) {
+        auto* r = static_cast<Renderer*>(userdata);
+        std::string& out = r->out_;
+        switch (type) {
+            case MD_BLOCK_DOC:
+            case MD_BLOCK_HTML:
+                break;
+            case MD_BLOCK_QUOTE:
+                out += "<blockquote>\n";
+                break;
+            case MD_BLOCK_UL:
+                out += "<ul>\n";
+                break;
+            case MD_BLOCK_OL: {
+                unsigned start = static_cast<MD_BLOCK_OL_DETAIL*>(detail)->start;
+                if (start == 1) {
+                    out += "<ol>\n";
+                } else {
+                    out += "<ol start=\"";
+                    out += std::to_string(start);
+                    out += "\">\n";
+                }
+                break;
+            }
+            case MD_BLOCK_LI: {
+                auto* d = static_cast<MD_BLOCK_LI_DETAIL*>(detail);
+                if (d->is_task) {
+                    out += "<li class=\"task-list-item\"><input type=\"checkbox\" disabled";
+                    if (d->task_mark == 'x' || d->task_mark == 'X') out += " checked";
+                    out += "> ";
+                } else {
+                    out += "<li>";
+                }
+                break;
+            }
+            case MD_BLOCK_HR:
+                out += "<hr>\n";
+                break;
+            case MD_BLOCK_H:
+                out += "<h";
+                out += static_cast<char>('0' + static_cast<MD_BLOCK_H_DETAIL*>(detail)->level);
+                if (r->options_.headingAnchors) {
+                    r->headingTagEnd_ = out.size();
+                    r->headingText_.clear();
+                }
+                out += '>';
+                break;
+            case MD_BLOCK_CODE: {
+                auto* d = static_cast<MD_BLOCK_CODE_DETAIL*>(detail);
+                out += "<pre><code";
+                if (d->lang.size > 0) {
+                    out += " class=\"language-";
+                    appendEscaped(out, r->decode(d->lang));
+                    out += '"';
+                }
+                out += '>';
+                break;
+            }
+            case MD_BLOCK_P:
+                out += "<p>";
+                break;
+            case MD_BLOCK_TABLE:
+                out += "<table>\n";
+                break;
+            case MD_BLOCK_THEAD:
+                out += "<thead>\n";
+                break;
+            case MD_BLOCK_TBODY:
+                out += "<tbody>\n";
+                break;
+            case MD_BLOCK_TR:
+                out += "<tr>\n";
+                break;
+            case MD_BLOCK_TH:
+            case MD_BLOCK_TD: {
+                out += type == MD_BLOCK_TH ? "<th" : "<td";
+                switch (static_cast<MD_BLOCK_TD_DETAIL*>(detail)->align) {
+                    case MD_ALIGN_LEFT: out += " align=\"left\""; break;
+                    case MD_ALIGN_CENTER: out += " align=\"center\""; break;
+                    case MD_ALIGN_RIGHT: out += " align=\"right\""; break;
+                    default: break;
+                }
+                out += '>';
+                break;
+            }
+        }
+        return 0;
+    }
+
+    static int leaveBlock(MD_BLOCKTYPE type, void* detail, void* userdata) {
+        auto* r = static_cast<Renderer*>(userdata);
+        std::string& out = r->out_;
+        switch (type) {
+            case MD_BLOCK_DOC:
+            case MD_BLOCK_HTML:
+            case MD_BLOCK_HR:
+                break;
+            case MD_BLOCK_QUOTE:
+                out += "</blockquote>\n";
+                break;
+            case MD_BLOCK_UL:
+                out += "</ul>\n";
+                break;
+            case MD_BLOCK_OL:
+                out += "</ol>\n";
+                break;
+            case MD_BLOCK_LI:
+                out += "</li>\n";
+                break;
+            case MD_BLOCK_H:
+                if (r->headingTagEnd_ != std::string::npos) r->insertHeadingId();
+                out += "</h";
+                out += static_cast<char>('0' + static_cast<MD_BLOCK_H_DETAIL*>(detail)->level);
+                out += ">\n";
+                break;
+            case MD_BLOCK_CODE:
+                out += "</code></pre>\n";
+                break;
+            case MD_BLOCK_P:
+                out += "</p>\n";
+                break;
+            case MD_BLOCK_TABLE:
+                out += "</table>\n";
+                break;
+            case MD_BLOCK_THEAD:
+                out += "</thead>\n";
+                break;
+            case MD_BLOCK_TBODY:
+                out += "</tbody>\n";
+                break;
+            case MD_BLOCK_TR:
+                out += "</tr>\n";
+                break;
+            case MD_BLOCK_TH:
+                out += "</th>\n";
+                break;
+            case MD_BLOCK_TD:
+                out += "</td>\n";
+                break;
+        }
+        return 0;
+    }
+
+    static int enterSpan(MD_SPANTYPE type, void* detail, void* userdata) {
+        auto* r = static_cast<Renderer*>(userdata);
+        std::string& out = r->out_;
+        // An image's content is its alt text, which carries no markup.
+        if (r->imageDepth_ > 0) {
+            if (type == MD_SPAN_IMG) r->imageDepth_++;
+            return 0;
+        }
+        switch (type) {
+            case MD_SPAN_EM:
+                out += "<em>";
+                break;
+            case MD_SPAN_STRONG:
+                out += "<strong>";
+                break;
+            case MD_SPAN_DEL:
+                out += "<del>";
+                break;
+            case MD_SPAN_U:
+                out += "<u>";
+                break;
+            case MD_SPAN_CODE:
+                out += "<code>";
+                break;
+            case MD_SPAN_A: {
+                auto* d = static_cast<MD_SPAN_A_DETAIL*>(detail);
+                out += "<a href=\"";
+                appendUrl(out, r->decode(d->href));
+                out += '"';
+                if (d->title.size > 0) {
+                    out += " title=\"";
+                    appendEscaped(out, r->decode(d->title));
+                    out += '"';
+                }
+                out += '>';
+                break;
+            }
+            case MD_SPAN_IMG: {
+                auto* d = static_cast<MD_SPAN_IMG_DETAIL*>(detail);
+                out += "<img src=\"";
+                appendUrl(out, r->decode(d->src));
+                out += "\" alt=\"";
+                r->imageDepth_ = 1;
+                break;
+            }
+            case MD_SPAN_LATEXMATH:
+                out += r->options_.mathDelimiters ? "\\(" : "<span class=\"math math-inline\">";
+                break;
+            case MD_SPAN_LATEXMATH_DISPLAY:
+                out += r->options_.mathDelimiters ? "\\[" : "<span class=\"math math-display\">";
+                break;
+            case MD_SPAN_WIKILINK:
+                break;
+        }
+        return 0;
+    }
+
+    static int leaveSpan(MD_SPANTYPE type, void* detail, void* userdata) {
+        auto* r = static_cast<Renderer*>(userdata);
+        std::string& out = r->out_;
+        if (r->imageDepth_ > 0) {
+            if (type != MD_SPAN_IMG || --r->imageDepth_ > 0) return 0;
+            out += '"';
+            auto* d = static_cast<MD_SPAN_IMG_DETAIL*>(detail);
+            if (d->title.size > 0) {
+                out += " title=\"";
+                appendEscaped(out, r->decode(d->title));
+                out += '"';
+            }
+            out += '>';
+            return 0;
+        }
+        switch (type) {
+            case MD_SPAN_EM:
+                out += "</em>";
+                break;
+            case MD_SPAN_STRONG:
+                out += "</strong>";
+                break;
+            case MD_SPAN_DEL:
+                out += "</del>";
+                break;
+            case MD_SPAN_U:
+                out += "</u>";
+                break;
+            case MD_SPAN_CODE:
+                out += "</code>";
+                break;
+            case MD_SPAN_A:
+                out += "</a>";
+                break;
+            case MD_SPAN_LATEXMATH:
+                out += r->options_.mathDelimiters ? "\\)" : "</span>";
+                break;
+            case MD_SPAN_LATEXMATH_DISPLAY:
+                out += r->options_.mathDelimiters ? "\\]" : "</span>";
+                break;
+            case MD_SPAN_IMG:
+            case MD_SPAN_WIKILINK:
+                break;
+        }
+        return 0;
+    }
+
+    static int text(MD_TEXTTYPE type, const MD_CHAR* text, MD_SIZE size, void* userdata) {
+        auto* r = static_cast<Renderer*>(userdata);
+        std::string& out = r->out_;
+        size_t start = out.size();
+        switch (type) {
+            case MD_TEXT_NULLCHAR:
+                HtmlEntities::appendUtf8(out, 0xFFFD);
+                break;
+            case MD_TEXT_BR:
+                out += r->imageDepth_ > 0 ? " " : "<br>\n";
+                break;
+            case MD_TEXT_SOFTBR:
+                out += r->imageDepth_ > 0 ? ' ' : '\n';
+                break;
+            case MD_TEXT_ENTITY:
+                r->scratch_.clear();
+                HtmlEntities::appendDecoded(r->scratch_, std::string_view(text, size));
+                appendEscaped(out, r->scratch_);
+                break;
+            default:
+                appendEscaped(out, text, size);
+                break;
+        }
+        if (r->headingTagEnd_ != std::string::npos) {
+            if (type == MD_TEXT_BR || type == MD_TEXT_SOFTBR) {
+                r->headingText_ += ' ';
+            } else {
+                r->headingText_.append(out, start, std::string::npos);
+            }
+        }
+        return 0;
+    }
+
+private:
+    // The attribute's text with entities and null characters resolved.
+    const std::string& decode(const MD_ATTRIBUTE& attribute) {
+        scratch_.clear();
+        for (unsigned i = 0; attribute.substr_offsets[i] < attribute.size; i++) {
+            MD_OFFSET begin = attribute.substr_offsets[i];
+            std::string_view part(attribute.text + begin, attribute.substr_offsets[i + 1] - begin);
+            switch (attribute.substr_types[i]) {
+                case MD_TEXT_ENTITY:
+                    HtmlEntities::appendDecoded(scratch_, part);
+                    break;
+                case MD_TEXT_NULLCHAR:
+                    HtmlEntities::appendUtf8(scratch_, 0xFFFD);
+                    break;
+                default:
+                    scratch_.append(part);
+                    break;
+            }
+        }
+        return scratch_;
+    }
+
+    // Slugs the heading's text, as written out and so already escaped, and
+    // inserts it as the id of the heading's tag.
+    void insertHeadingId() {
+        std::string slug;
+        bool inReference = false;
+        for (char c : headingText_) {
+            if (inReference) {
+                // A character escaped as &amp; and the like is punctuation.
+                inReference = c != ';';
+            } else if (c == '&') {
+                inReference = true;
+            } else if (c == ' ') {
+                slug += '-';
+            } else if (isAlnumAscii(c) || c == '-' || c == '_' || static_cast<unsigned char>(c) >= 0x80) {
+                slug += toLowerAscii(c);
+            }
+        }
+        if (slug.empty()) slug = "section";
+
+        std::string id = slug;
+        size_t& repeats = idRepeats_[slug];
+        while (!ids_.insert(id).second) id = slug + '-' + std::to_string(++repeats);
+
+        std::string attribute = " id=\"" + id + '"';
+        out_.insert(headingTagEnd_, attribute);
+        headingTagEnd_ = std::string::npos;
+    }
+
+    std::string& out_;
+    const HtmlRenderOptions& options_;
+    // Nesting of images in the alt text of the one being written.
+    int imageDepth_ = 0;
+    // Where the open heading's id goes, npos without headingAnchors or
+    // outside headings, and the heading's text so far.
+    size_t headingTagEnd_ = std::string::npos;
+    std::string headingText_;
+    std::unordered_set<std::string> ids_;
+    // Suffixes given out per slug, so that repeats do not start over at -1.
+    std::unordered_map<std::string, size_t> idRepeats_;
+    std::string scratch_;
+};
+
+} // namespace
+
+std::optional<std::string> MarkdownHtmlRenderer::render(std::string_view markdown, const HtmlRenderOptions& options) {
+    std::string out;
+    if (!appendHtml(out, markdown, options)) return std::nullopt;
+    return out;
+}
+
+bool MarkdownHtmlRenderer::appendHtml(std::string& out, std::string_view markdown, const HtmlRenderOptions& options) {
+    NITRO_MARKDOWN_TRACE_SCOPE("render html", static_cast<int64_t>(markdown.size()));
+    // HTML runs a little longer than its markdown.
+    size_t start = out.size();
+    out.reserve(start + markdown.size() + markdown.size() / 4 + 64);
+    Renderer renderer(out, options);
+    MD_PARSER parser = {
+        0,
+        MD4CDialect::flags(options.gfm, options.math),
+        &Renderer::enterBlock,
+        &Renderer::leaveBlock,
+        &Renderer::enterSpan,
+        &Renderer::leaveSpan,
+        &Renderer::text,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr,
+        nullptr
+    };
+    if (MD4CDialect::parse(markdown.data(), static_cast<MD_SIZE>(markdown.size()), &parser, &renderer) != 0) {
+        // What was written stops mid-document, with elements left open.
+        out.resize(start);
+        return false;
+    }
+    return true;
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+struct HtmlRenderOptions {
+    bool gfm = true;
+    bool math = true;
+    // Gives every heading an id made from its text, GitHub style, so that
+    // #fragment links reach it: ASCII lowercased, punctuation dropped,
+    // spaces as dashes, and -1, -2, ... appended to repeats.
+    bool headingAnchors = false;
+    // Writes math as \(...\) and \[...\] for MathJax or KaTeX auto-render
+    // instead of spans with the classes math-inline and math-display.
+    bool mathDelimiters = false;
+};
+
+/**
+ * Renders markdown to HTML straight from md4c's callbacks into one output
+ * buffer, without building a tree, for surfaces that show HTML: WebViews,
+ * email, share sheets.
+ *
+ * The output is safe to embed: text and attributes are escaped, raw HTML in
+ * the markdown is rendered as text like in the AST, and link and image URLs
+ * with a javascript:, vbscript:, file: or data: scheme are dropped, except
+ * data: images in PNG, GIF, JPEG or WebP.
+ */
+class MarkdownHtmlRenderer {
+public:
+    // nullopt when md4c fails, e.g. out of memory.
+    static std::optional<std::string> render(std::string_view markdown,
+                                             const HtmlRenderOptions& options = HtmlRenderOptions{});
+    // Appends the HTML of markdown to out. On failure returns false and
+    // leaves out as it was.
+    static bool appendHtml(std::string& out, std::string_view markdown, const HtmlRenderOptions& options);
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,119 @@
+#include "MarkdownJsonSerializer.hpp"
+#include "AllocationCounter.hpp"
+#include "BlockMemo.hpp"
+#include "Tracer.hpp"
+
+namespace NitroMarkdown {
+
+namespace {
+
+void appendStringField(std::string& out, const char* name, const std::optional<std::string>& value) {
+    if (!value.has_value()) return;
+    out += ",\"";
+    out += name;
+    out += "\":\"";
+    MarkdownJsonSerializer::appendEscaped(out, value.value());
+    out += '"';
+}
+
+void appendIntField(std::string& out, const char* name, const std::optional<int>& value) {
+    if (!value.has_value()) return;
+    out += ",\"";
+    out += name;
+    out += "\":";
+    out += std::to_string(value.value());
+}
+
+void appendBoolField(std::string& out, const char* name, const std::optional<bool>& value) {
+    if (!value.has_value()) return;
+    out += ",\"";
+    out += name;
+    out += "\":";
+    out += value.value() ? "true" : "false";
+}
+
+} // namespace
+
+std::string MarkdownJsonSerializer::toJson(const std::shared_ptr<MarkdownNode>& node) {
+    return toJson(node, nullptr);
+}
+
+std::string MarkdownJsonSerializer::toJson(const std::shared_ptr<MarkdownNode>& node, BlockMemo* memo) {
+    NITRO_MARKDOWN_TRACE_SCOPE("serialize");
+    AllocationScope scope(AllocationCategory::Serializer);
+    std::string out;
+    if (node) appendJson(out, *node, memo);
+    return out;
+}
+
+void MarkdownJsonSerializer::appendEscaped(std::string& out, std::string_view s) {
+    static const char* hex = "0123456789abcdef";
+    for (char c : s) {
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    out += "\\u00";
+                    out += hex[(c >> 4) & 0xF];
+                    out += hex[c & 0xF];
+                } else {
+                    out += c;
+                }
+        }
+    }
+}
+
+void MarkdownJsonSerializer::appendJson(std::string& out, const MarkdownNode& node, BlockMemo* memo) {
+    out += "{\"type\":\"";
+    out += nodeTypeToString(node.type);
+    out += '"';
+
+    appendStringField(out, "content", node.content);
+    appendIntField(out, "level", node.level);
+    appendStringField(out, "href", node.href);
+    appendStringField(out, "title", node.title);
+    appendStringField(out, "alt", node.alt);
+    appendStringField(out, "language", node.language);
+    appendBoolField(out, "ordered", node.ordered);
+    appendIntField(out, "start", node.start);
+    appendBoolField(out, "checked", node.checked);
+    appendBoolField(out, "isHeader", node.isHeader);
+
+    if (node.align.has_value()) {
+        std::string alignStr = textAlignToString(node.align.value());
+        if (!alignStr.empty()) {
+            out += ",\"align\":\"";
+            out += alignStr;
+            out += '"';
+        }
+    }
+
+    appendIntField(out, "blockId", node.blockId);
+    appendIntField(out, "sourceStart", node.sourceStart);
+    appendIntField(out, "sourceEnd", node.sourceEnd);
+
+    if (!node.children.empty()) {
+        out += ",\"children\":[";
+        for (size_t i = 0; i < node.children.size(); ++i) {
+            if (i > 0) out += ',';
+            // Memoized blocks are only ever children of the root.
+            const std::string* fragment = memo ? memo->json(*node.children[i]) : nullptr;
+            if (fragment) {
+                out += *fragment;
+            } else {
+                appendJson(out, *node.children[i]);
+            }
+        }
+        out += ']';
+    }
+
+    out += '}';
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+class BlockMemo;
+
+/**
+ * Serializes an AST into the JSON shape the JS side parses into MarkdownNode
+ * objects. Optional fields are omitted when unset.
+ */
+class MarkdownJsonSerializer {
+public:
+    static std::string toJson(const std::shared_ptr<MarkdownNode>& node);
+    // Same, but children of node held by memo are copied from their cached
+    // JSON instead of being serialized again.
+    static std::string toJson(const std::shared_ptr<MarkdownNode>& node, BlockMemo* memo);
+
+    // Appends the JSON for node and its subtree to out.
+    static void appendJson(std::string& out, const MarkdownNode& node, BlockMemo* memo = nullptr);
+
+    // Appends s with JSON string escaping, without the surrounding quotes.
+    static void appendEscaped(std::string& out, std::string_view s);
+};
+
+} // namespace NitroMarkdown
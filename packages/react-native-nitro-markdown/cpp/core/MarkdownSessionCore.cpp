@@ -0,0 +1,601 @@
+#include "MarkdownSessionCore.hpp"
+#include "TextCodec.hpp"
+#include "Tracer.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+
+namespace NitroMarkdown {
+
+namespace {
+
+size_t subtreeBytes(const MarkdownNode& node) {
+    MemoryFootprint footprint;
+    footprint.addTree(node);
+    return footprint.nodeBytes + footprint.stringBytes;
+}
+
+} // namespace
+
+// Text and blocks frozen by snapshot(). The text starts at textBegin, which
+// may lie inside the parent's text when a session copied its last block out
+// before freezing again; the blocks likewise start at index blockBegin and
+// hide the parent's blocks from there on.
+struct MarkdownSessionCore::Segment {
+    std::shared_ptr<const Segment> parent;
+    size_t textBegin = 0;
+    std::string text;
+    size_t blockBegin = 0;
+    std::vector<Block> blocks;
+    size_t depth = 1;
+};
+
+// Compressed text of finished blocks, starting at textBegin. The blocks keep
+// their offsets and flags but not their trees.
+struct MarkdownSessionCore::ColdChunk {
+    size_t textBegin = 0;
+    size_t textSize = 0;
+    std::string compressed;
+    size_t blockBegin = 0;
+    std::vector<Block> blocks;
+};
+
+bool MarkdownSessionCore::appendColdText(const ColdChunks& chunks, std::string& out) {
+    std::string text;
+    for (const auto& chunk : chunks) {
+        if (!TextCodec::decompress(chunk->compressed, chunk->textSize, text)) return false;
+        out += text;
+    }
+    return true;
+}
+
+template <typename Fn>
+void MarkdownSessionCore::forEachPiece(const Segment* segment, std::string_view tail, size_t tailBegin, size_t begin,
+                                       size_t end, Fn&& fn) {
+    // Collected newest first, each cut off where a newer piece starts.
+    struct Piece {
+        size_t offset;
+        std::string_view text;
+    };
+    Piece pieces[kMaxSegmentDepth + 1];
+    size_t count = 0;
+    size_t limit = end;
+    auto add = [&](size_t offset, std::string_view text) {
+        size_t pieceBegin = std::max(offset, begin);
+        size_t pieceEnd = std::min(limit, offset + text.size());
+        if (pieceBegin < pieceEnd) {
+            pieces[count++] = {pieceBegin, text.substr(pieceBegin - offset, pieceEnd - pieceBegin)};
+        }
+        limit = std::min(limit, offset);
+    };
+    add(tailBegin, tail);
+    for (; segment && limit > begin; segment = segment->parent.get()) add(segment->textBegin, segment->text);
+    while (count > 0) {
+        count--;
+        fn(pieces[count].offset, pieces[count].text);
+    }
+}
+
+std::optional<std::string> MarkdownSessionCore::Snapshot::text() const {
+    std::string text;
+    text.reserve(size_);
+    if (cold_ && !appendColdText(*cold_, text)) return std::nullopt;
+    forEachPiece(segment_.get(), {}, size_, coldSize_, size_, [&](size_t, std::string_view piece) { text += piece; });
+    return text;
+}
+
+MarkdownSessionCore::MarkdownSessionCore(const ParserOptions& options, ParserPool* parsers)
+    : options_(options),
+      parsers_(parsers),
+      parser_(parsers ? nullptr : std::make_unique<MD4CParser>()),
+      references_(std::make_shared<ReferenceDefinitionTable>()) {}
+
+MarkdownSessionCore::MarkdownSessionCore(const Snapshot& snapshot, ParserPool* parsers)
+    : options_(snapshot.options_),
+      parsers_(parsers),
+      parser_(parsers ? nullptr : std::make_unique<MD4CParser>()),
+      references_(snapshot.references_ ? snapshot.references_ : std::make_shared<ReferenceDefinitionTable>()),
+      cold_(snapshot.cold_),
+      coldBlocks_(snapshot.coldBlocks_),
+      coldSize_(snapshot.coldSize_),
+      segment_(snapshot.segment_),
+      frozenBlocks_(snapshot.blocks_),
+      tailBegin_(snapshot.size_),
+      root_(snapshot.root_),
+      parsedSize_(snapshot.parsedSize_),
+      treeBytes_(snapshot.treeBytes_) {}
+
+void MarkdownSessionCore::append(std::string_view chunk) {
+    tail_ += chunk;
+}
+
+void MarkdownSessionCore::clear() {
+    cold_.reset();
+    coldBlocks_ = 0;
+    coldSize_ = 0;
+    cachedChunk_ = SIZE_MAX;
+    std::string().swap(cachedText_);
+    segment_.reset();
+    tail_.clear();
+    tailBegin_ = 0;
+    scratch_.clear();
+    releaseTree();
+    lastReparsedBytes_ = 0;
+}
+
+void MarkdownSessionCore::releaseTree() {
+    clearBlocks();
+    root_.reset();
+    parsedSize_ = 0;
+    if (parser_) parser_->releaseTree();
+    // Segments would keep the blocks' subtrees alive.
+    if (segment_) flatten(false);
+}
+
+void MarkdownSessionCore::trim() {
+    std::string().swap(scratch_);
+    cachedChunk_ = SIZE_MAX;
+    std::string().swap(cachedText_);
+    tail_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+    if (parser_) parser_->trim();
+}
+
+void MarkdownSessionCore::clearBlocks() {
+    blocks_.clear();
+    frozenBlocks_ = coldBlocks_;
+    // Cold blocks are not parsed again, so their definitions stay.
+    if (coldBlocks_ == 0) {
+        references_ = std::make_shared<ReferenceDefinitionTable>();
+    } else {
+        mutableReferences().removeOwnersFrom(coldSize_);
+    }
+    treeBytes_ = 0;
+}
+
+MarkdownSessionCore::Snapshot MarkdownSessionCore::snapshot() {
+    freeze();
+    Snapshot snapshot;
+    snapshot.options_ = options_;
+    snapshot.cold_ = cold_;
+    snapshot.coldBlocks_ = coldBlocks_;
+    snapshot.coldSize_ = coldSize_;
+    snapshot.segment_ = segment_;
+    snapshot.blocks_ = frozenBlocks_;
+    snapshot.size_ = size();
+    snapshot.references_ = references_;
+    snapshot.root_ = root_;
+    snapshot.parsedSize_ = parsedSize_;
+    snapshot.treeBytes_ = treeBytes_;
+    return snapshot;
+}
+
+MarkdownSessionCore MarkdownSessionCore::fork() {
+    return MarkdownSessionCore(snapshot(), parsers_);
+}
+
+std::optional<std::string> MarkdownSessionCore::text() const {
+    std::string text;
+    text.reserve(size());
+    if (cold_ && !appendColdText(*cold_, text)) return std::nullopt;
+    forEachPiece(segment_.get(), tail_, tailBegin_, coldSize_, size(),
+                 [&](size_t, std::string_view piece) { text += piece; });
+    return text;
+}
+
+std::string MarkdownSessionCore::hotText() const {
+    std::string text;
+    text.reserve(size() - coldSize_);
+    forEachPiece(segment_.get(), tail_, tailBegin_, coldSize_, size(),
+                 [&](size_t, std::string_view piece) { text += piece; });
+    return text;
+}
+
+std::shared_ptr<MarkdownNode> MarkdownSessionCore::document() {
+    NITRO_MARKDOWN_TRACE_SCOPE("session document");
+    if (root_ && parsedSize_ == size()) {
+        lastReparsedBytes_ = 0;
+        return root_;
+    }
+
+    lastReparsedBytes_ = 0;
+    size_t reparseOffset = firstUnstableOffset();
+    size_t stableBlocks = blocksBefore(reparseOffset);
+    auto previousDefinitions = references_->definitionsFrom(reparseOffset);
+
+    std::optional<ParserPool::Lease> lease;
+    if (parsers_) lease.emplace(parsers_->acquire());
+    MD4CParser& parser = lease ? **lease : *parser_;
+
+    bool ok = reparseFrom(parser, reparseOffset);
+
+    if (ok) {
+        auto definitions = references_->definitionsFrom(reparseOffset);
+        std::sort(previousDefinitions.begin(), previousDefinitions.end());
+        std::sort(definitions.begin(), definitions.end());
+
+        // New or removed definitions may turn brackets in earlier blocks
+        // into links (or back), so those blocks have to be redone.
+        if (definitions != previousDefinitions) {
+            // Cold blocks are parsed against the table when they are read.
+            for (size_t i = coldBlocks_; ok && i < stableBlocks; i++) {
+                if (block(i).mayReference) ok = reparseBlock(parser, i);
+            }
+        }
+    }
+
+    if (!ok) {
+        // Block boundaries did not line up; fall back to a full reparse.
+        clearBlocks();
+        reparseFrom(parser, coldSize_);
+    }
+
+    parsedSize_ = size();
+    rebuildRoot();
+    return root_;
+}
+
+size_t MarkdownSessionCore::compact(size_t hotBytes) {
+    NITRO_MARKDOWN_TRACE_SCOPE("session compact", static_cast<int64_t>(size()));
+    document();
+    size_t limit = std::min(size() > hotBytes ? size() - hotBytes : 0, firstUnstableOffset());
+    // The first block left hot is the last one starting at or before limit.
+    size_t end = blocksBefore(limit + 1);
+    if (end <= coldBlocks_ + 1) return 0;
+    end--;
+    size_t oldColdSize = coldSize_;
+    size_t newColdSize = block(end).offset;
+
+    auto chunks = std::make_shared<ColdChunks>(cold_ ? *cold_ : ColdChunks{});
+    std::string text;
+    size_t chunkBegin = coldSize_;
+    for (size_t first = coldBlocks_; first < end;) {
+        // Blocks up to kColdChunkBytes of text, or one larger block.
+        size_t last = first + 1;
+        while (last < end && blockEnd(last) - chunkBegin <= kColdChunkBytes) last++;
+        size_t chunkEnd = block(last).offset;
+
+        auto chunk = std::make_shared<ColdChunk>();
+        chunk->textBegin = chunkBegin;
+        chunk->textSize = chunkEnd - chunkBegin;
+        text.clear();
+        forEachPiece(segment_.get(), tail_, tailBegin_, chunkBegin, chunkEnd,
+                     [&](size_t, std::string_view piece) { text += piece; });
+        chunk->compressed = TextCodec::compress(text);
+        chunk->compressed.shrink_to_fit();
+        chunk->blockBegin = first;
+        chunk->blocks.reserve(last - first);
+        for (size_t i = first; i < last; i++) {
+            Block block = this->block(i);
+            treeBytes_ -= block.bytes;
+            block.node.reset();
+            block.bytes = 0;
+            chunk->blocks.push_back(std::move(block));
+        }
+        chunks->push_back(std::move(chunk));
+        first = last;
+        chunkBegin = chunkEnd;
+    }
+
+    // The hot text and blocks move into the session's own, so that the
+    // segments, which may hold the compacted text, can go.
+    thawText(newColdSize);
+    if (tailBegin_ < newColdSize) {
+        tail_.erase(0, newColdSize - tailBegin_);
+        tailBegin_ = newColdSize;
+    }
+    thawBlocks(end);
+    if (frozenBlocks_ < end) {
+        blocks_.erase(blocks_.begin(), blocks_.begin() + static_cast<std::ptrdiff_t>(end - frozenBlocks_));
+        frozenBlocks_ = end;
+    }
+    tail_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+    segment_.reset();
+    // The parser's last tree may share the compacted blocks' subtrees.
+    if (parser_) parser_->releaseTree();
+
+    cold_ = std::move(chunks);
+    coldBlocks_ = end;
+    coldSize_ = newColdSize;
+    rebuildRoot();
+    return newColdSize - oldColdSize;
+}
+
+std::optional<std::vector<std::shared_ptr<MarkdownNode>>> MarkdownSessionCore::coldBlocks(size_t begin,
+                                                                                       size_t end) {
+    std::vector<std::shared_ptr<MarkdownNode>> nodes;
+    end = std::min(end, coldBlocks_);
+    if (begin >= end) return nodes;
+    NITRO_MARKDOWN_TRACE_SCOPE("session cold blocks", static_cast<int64_t>(begin));
+
+    std::optional<ParserPool::Lease> lease;
+    if (parsers_) lease.emplace(parsers_->acquire());
+    MD4CParser& parser = lease ? **lease : *parser_;
+
+    for (size_t i = begin; i < end; i++) {
+        size_t chunkIndex = coldChunkOf(i);
+        const ColdChunk& chunk = *(*cold_)[chunkIndex];
+        if (cachedChunk_ != chunkIndex) {
+            cachedChunk_ = SIZE_MAX;
+            if (!TextCodec::decompress(chunk.compressed, chunk.textSize, cachedText_)) return std::nullopt;
+            cachedChunk_ = chunkIndex;
+        }
+        size_t local = i - chunk.blockBegin;
+        size_t blockBegin = chunk.blocks[local].offset;
+        size_t blockEnd = local + 1 < chunk.blocks.size() ? chunk.blocks[local + 1].offset
+                                                           : chunk.textBegin + chunk.textSize;
+        std::string_view source =
+            std::string_view(cachedText_).substr(blockBegin - chunk.textBegin, blockEnd - blockBegin);
+        auto root = parser.parse(source, options_, ExternalReferences{references_.get(), blockBegin});
+        nodes.insert(nodes.end(), root->children.begin(), root->children.end());
+    }
+    return nodes;
+}
+
+bool MarkdownSessionCore::reparseFrom(MD4CParser& parser, size_t offset) {
+    while (blockCount() > 0 && block(blockCount() - 1).offset >= offset) {
+        treeBytes_ -= block(blockCount() - 1).bytes;
+        if (blocks_.empty()) {
+            frozenBlocks_--;
+        } else {
+            blocks_.pop_back();
+        }
+    }
+    mutableReferences().removeOwnersFrom(offset);
+
+    thawText(offset);
+    std::string_view source = std::string_view(tail_).substr(offset - tailBegin_);
+    auto tail = parser.parse(source, options_, ExternalReferences{references_.get(), offset});
+    lastReparsedBytes_ += source.size();
+
+    const auto& offsets = parser.lastBlockOffsets();
+    if (offsets.size() != tail->children.size()) return false;
+
+    size_t firstNewBlock = blocks_.size();
+    for (size_t i = 0; i < offsets.size(); i++) {
+        // The first block also owns any blank lines or definitions before it.
+        size_t blockOffset = i == 0 ? offset : offset + offsets[i];
+        size_t bytes = subtreeBytes(*tail->children[i]);
+        blocks_.push_back({blockOffset, tail->children[i], false, bytes});
+        treeBytes_ += bytes;
+    }
+    for (size_t i = firstNewBlock; i < blocks_.size(); i++) {
+        size_t begin = blocks_[i].offset - offset;
+        size_t end = i + 1 < blocks_.size() ? blocks_[i + 1].offset - offset : source.size();
+        blocks_[i].mayReference = std::memchr(source.data() + begin, '[', end - begin) != nullptr;
+    }
+
+    for (const auto& entry : parser.lastReferenceDefinitions()) {
+        size_t position = offset + entry.owner;
+        auto owner = std::upper_bound(blocks_.begin() + static_cast<std::ptrdiff_t>(firstNewBlock), blocks_.end(),
+            position, [](size_t value, const Block& block) { return value < block.offset; });
+        size_t ownerOffset = owner == blocks_.begin() + static_cast<std::ptrdiff_t>(firstNewBlock)
+            ? offset : std::prev(owner)->offset;
+        references_->add(ownerOffset, entry.definition);
+    }
+    return true;
+}
+
+size_t MarkdownSessionCore::firstUnstableOffset() const {
+    if (parsedSize_ == 0 || blockCount() == coldBlocks_) return coldSize_;
+
+    // The first line that can change is the old last line if it was not
+    // terminated, otherwise the first appended line.
+    size_t start = lineStart(parsedSize_);
+    if (start == coldSize_) return coldSize_;
+
+    // That line may still be absorbed by the block of the line before it
+    // (lazy continuation, list items, setext and table underlines), so the
+    // block holding the previous line is reparsed as well.
+    size_t index = blocksBefore(start);
+    return index <= coldBlocks_ ? coldSize_ : block(index - 1).offset;
+}
+
+bool MarkdownSessionCore::reparseBlock(MD4CParser& parser, size_t index) {
+    thawBlocks(index);
+    auto& block = blocks_[index - frozenBlocks_];
+    std::string_view source = textView(block.offset, blockEnd(index));
+
+    // The block's own definitions stay in the table; the parser prefers its
+    // local copies over table entries owned by the block itself.
+    auto node = parser.parse(source, options_, ExternalReferences{references_.get(), block.offset});
+    lastReparsedBytes_ += source.size();
+
+    if (node->children.size() != 1) return false;
+    block.node = node->children[0];
+    treeBytes_ -= block.bytes;
+    block.bytes = subtreeBytes(*block.node);
+    treeBytes_ += block.bytes;
+    return true;
+}
+
+size_t MarkdownSessionCore::blockEnd(size_t index) const {
+    return index + 1 < blockCount() ? block(index + 1).offset : size();
+}
+
+const MarkdownSessionCore::Block& MarkdownSessionCore::block(size_t index) const {
+    if (index >= frozenBlocks_) return blocks_[index - frozenBlocks_];
+    if (index < coldBlocks_) {
+        const ColdChunk& chunk = *(*cold_)[coldChunkOf(index)];
+        return chunk.blocks[index - chunk.blockBegin];
+    }
+    const Segment* segment = segment_.get();
+    while (index < segment->blockBegin) segment = segment->parent.get();
+    return segment->blocks[index - segment->blockBegin];
+}
+
+size_t MarkdownSessionCore::coldChunkOf(size_t index) const {
+    auto chunk = std::upper_bound(cold_->begin(), cold_->end(), index,
+        [](size_t value, const std::shared_ptr<const ColdChunk>& chunk) { return value < chunk->blockBegin; });
+    return static_cast<size_t>(chunk - cold_->begin()) - 1;
+}
+
+size_t MarkdownSessionCore::blocksBefore(size_t offset) const {
+    size_t low = 0;
+    size_t high = blockCount();
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (block(middle).offset < offset) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+template <typename Fn>
+void MarkdownSessionCore::forEachBlock(Fn&& fn) const {
+    struct Range {
+        const Segment* segment;
+        size_t begin;
+        size_t end;
+    };
+    Range ranges[kMaxSegmentDepth];
+    size_t count = 0;
+    size_t limit = frozenBlocks_;
+    for (const Segment* segment = segment_.get(); segment && limit > coldBlocks_; segment = segment->parent.get()) {
+        size_t begin = std::max(coldBlocks_, std::min(limit, segment->blockBegin));
+        size_t end = std::min(limit, segment->blockBegin + segment->blocks.size());
+        if (begin < end) ranges[count++] = {segment, begin, end};
+        limit = begin;
+    }
+    while (count > 0) {
+        const Range& range = ranges[--count];
+        for (size_t i = range.begin; i < range.end; i++) fn(range.segment->blocks[i - range.segment->blockBegin]);
+    }
+    for (const auto& block : blocks_) fn(block);
+}
+
+std::string_view MarkdownSessionCore::textView(size_t begin, size_t end) {
+    if (begin >= tailBegin_) return std::string_view(tail_).substr(begin - tailBegin_, end - begin);
+
+    std::string_view single;
+    size_t pieces = 0;
+    forEachPiece(segment_.get(), tail_, tailBegin_, begin, end, [&](size_t, std::string_view piece) {
+        single = piece;
+        pieces++;
+    });
+    if (pieces == 1) return single;
+
+    scratch_.clear();
+    forEachPiece(segment_.get(), tail_, tailBegin_, begin, end,
+                 [&](size_t, std::string_view piece) { scratch_ += piece; });
+    return scratch_;
+}
+
+size_t MarkdownSessionCore::lineStart(size_t position) const {
+    // Usually the line is in the tail.
+    if (position > tailBegin_) {
+        size_t newline = std::string_view(tail_.data(), position - tailBegin_).rfind('\n');
+        if (newline != std::string_view::npos) return tailBegin_ + newline + 1;
+    }
+    // Otherwise the last newline is near the end of some piece, where rfind
+    // finds it without scanning the rest.
+    size_t start = coldSize_;
+    forEachPiece(segment_.get(), tail_, tailBegin_, coldSize_, position, [&](size_t offset, std::string_view piece) {
+        size_t newline = piece.rfind('\n');
+        if (newline != std::string_view::npos) start = offset + newline + 1;
+    });
+    return start;
+}
+
+void MarkdownSessionCore::freeze() {
+    if (tail_.empty() && blocks_.empty()) return;
+    if (segment_ && segment_->depth == kMaxSegmentDepth) {
+        // Copying everything once per kMaxSegmentDepth freezes keeps reads
+        // before the tail bounded.
+        flatten(true);
+        return;
+    }
+
+    auto segment = std::make_shared<Segment>();
+    segment->parent = segment_;
+    segment->textBegin = tailBegin_;
+    segment->text = std::move(tail_);
+    segment->blockBegin = frozenBlocks_;
+    segment->blocks = std::move(blocks_);
+    segment->depth = segment_ ? segment_->depth + 1 : 1;
+    tailBegin_ += segment->text.size();
+    frozenBlocks_ += segment->blocks.size();
+    tail_.clear();
+    blocks_.clear();
+    segment_ = std::move(segment);
+}
+
+void MarkdownSessionCore::flatten(bool keepBlocks) {
+    auto segment = std::make_shared<Segment>();
+    segment->textBegin = coldSize_;
+    segment->text = hotText();
+    segment->blockBegin = coldBlocks_;
+    if (keepBlocks) {
+        segment->blocks.reserve(blockCount() - coldBlocks_);
+        forEachBlock([&](const Block& block) { segment->blocks.push_back(block); });
+        frozenBlocks_ = coldBlocks_ + segment->blocks.size();
+        blocks_.clear();
+    }
+    tailBegin_ = coldSize_ + segment->text.size();
+    tail_.clear();
+    segment_ = std::move(segment);
+}
+
+void MarkdownSessionCore::thawText(size_t offset) {
+    if (offset >= tailBegin_) return;
+    std::string text;
+    text.reserve(size() - offset);
+    forEachPiece(segment_.get(), tail_, tailBegin_, offset, size(),
+                 [&](size_t, std::string_view piece) { text += piece; });
+    tail_.swap(text);
+    tailBegin_ = offset;
+}
+
+void MarkdownSessionCore::thawBlocks(size_t index) {
+    if (index >= frozenBlocks_) return;
+    std::vector<Block> blocks;
+    blocks.reserve(blockCount() - index);
+    for (size_t i = index; i < frozenBlocks_; i++) blocks.push_back(block(i));
+    blocks.insert(blocks.end(), blocks_.begin(), blocks_.end());
+    blocks_.swap(blocks);
+    frozenBlocks_ = index;
+}
+
+ReferenceDefinitionTable& MarkdownSessionCore::mutableReferences() {
+    // A count of one cannot grow behind our back: only this session can
+    // hand the table out.
+    if (references_.use_count() > 1) references_ = std::make_shared<ReferenceDefinitionTable>(*references_);
+    return *references_;
+}
+
+MemoryFootprint MarkdownSessionCore::memoryFootprint() const {
+    MemoryFootprint footprint = parser_ ? parser_->memoryFootprint(false) : MemoryFootprint{};
+    footprint.inputBytes += MemoryFootprint::heapBytes(tail_);
+    footprint.scratchBytes +=
+        MemoryFootprint::heapBytes(blocks_) + references_->memoryBytes() + MemoryFootprint::heapBytes(scratch_);
+    for (const Segment* segment = segment_.get(); segment; segment = segment->parent.get()) {
+        footprint.inputBytes += MemoryFootprint::heapBytes(segment->text);
+        footprint.scratchBytes += MemoryFootprint::heapBytes(segment->blocks);
+    }
+    if (cold_) {
+        for (const auto& chunk : *cold_) {
+            footprint.inputBytes += MemoryFootprint::heapBytes(chunk->compressed);
+            footprint.scratchBytes += MemoryFootprint::heapBytes(chunk->blocks);
+        }
+        footprint.scratchBytes += MemoryFootprint::heapBytes(*cold_) + MemoryFootprint::heapBytes(cachedText_);
+    }
+    if (root_) {
+        footprint.addTree(*root_);
+    } else {
+        forEachBlock([&](const Block& block) { footprint.addTree(*block.node); });
+    }
+    return footprint;
+}
+
+void MarkdownSessionCore::rebuildRoot() {
+    root_ = std::make_shared<MarkdownNode>(NodeType::Document);
+    root_->children.reserve(blockCount() - coldBlocks_);
+    forEachBlock([&](const Block& block) { root_->children.push_back(block.node); });
+}
+
+} // namespace NitroMarkdown
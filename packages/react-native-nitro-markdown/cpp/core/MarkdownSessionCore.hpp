@@ -0,0 +1,211 @@
+#pragma once
+
+#include "MD4CParser.hpp"
+#include "MarkdownTypes.hpp"
+#include "ParserPool.hpp"
+#include "ReferenceDefinitionTable.hpp"
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Native streaming document. Text is only ever appended, so only the blocks
+ * around the last line can change; document() reparses from the start of
+ * those and reuses the subtrees of every block before them.
+ *
+ * Link reference definitions are kept in a table owned by the block that
+ * defines them. When the tail adds or removes definitions, earlier blocks
+ * that may use them are reparsed on their own against the table.
+ *
+ * Given a ParserPool, the session borrows a parser for each reparse instead
+ * of keeping its own.
+ *
+ * snapshot() and fork() take O(1): the session's text and blocks so far are
+ * frozen into a segment shared with the snapshot, and the session goes on
+ * with an empty tail of its own. The next reparse copies only the text of
+ * the last block, which may still grow, into the tail. Segments form a
+ * chain that reads before the tail walk; it is flattened into one segment
+ * once it is kMaxSegmentDepth deep.
+ *
+ * compact() moves finished history out of memory for sessions that run for
+ * hours: the text of blocks that later text can no longer change is
+ * compressed in chunks and their trees are dropped, keeping only the block
+ * table. document() then covers the hot text from coldSize() on, and
+ * coldBlocks() parses cold blocks again when they are scrolled to.
+ */
+class MarkdownSessionCore {
+    struct Segment;
+    struct ColdChunk;
+    using ColdChunks = std::vector<std::shared_ptr<const ColdChunk>>;
+
+public:
+    static constexpr size_t kMaxSegmentDepth = 16;
+    // Text compact() leaves hot by default, and the size of its chunks:
+    // a chunk is decompressed as a whole for any of its blocks.
+    static constexpr size_t kDefaultHotBytes = 64u << 10;
+    static constexpr size_t kColdChunkBytes = 32u << 10;
+
+    // A session's state at one point, e.g. before an answer that may be
+    // regenerated. Immutable, so it can be kept and shared across threads.
+    class Snapshot {
+    public:
+        size_t size() const { return size_; }
+        size_t coldSize() const { return coldSize_; }
+        // Null if compressed cold text fails to decompress.
+        std::optional<std::string> text() const;
+        // The tree of the hot text at that point, or null if not all of the
+        // text had been parsed.
+        std::shared_ptr<MarkdownNode> document() const { return parsedSize_ == size_ ? root_ : nullptr; }
+
+    private:
+        friend class MarkdownSessionCore;
+        ParserOptions options_;
+        std::shared_ptr<const ColdChunks> cold_;
+        size_t coldBlocks_ = 0;
+        size_t coldSize_ = 0;
+        std::shared_ptr<const Segment> segment_;
+        size_t blocks_ = 0;
+        size_t size_ = 0;
+        std::shared_ptr<ReferenceDefinitionTable> references_;
+        std::shared_ptr<MarkdownNode> root_;
+        size_t parsedSize_ = 0;
+        size_t treeBytes_ = 0;
+    };
+
+    // parsers, if given, must outlive the session.
+    explicit MarkdownSessionCore(const ParserOptions& options = ParserOptions{}, ParserPool* parsers = nullptr);
+    // Continues from snapshot, sharing its text, blocks and tree.
+    explicit MarkdownSessionCore(const Snapshot& snapshot, ParserPool* parsers = nullptr);
+
+    void append(std::string_view chunk);
+    void clear();
+    // Drops the tree and block table but keeps the text; the next document()
+    // parses all of it again.
+    void releaseTree();
+    bool hasTree() const { return root_ != nullptr; }
+    // Gives back spare capacity of the session's buffers and its parser's
+    // working buffers, keeping the text and tree.
+    void trim();
+
+    Snapshot snapshot();
+    // A new session with the same text and tree that appends independently.
+    MarkdownSessionCore fork();
+
+    size_t size() const { return tailBegin_ + tail_.size(); }
+    // All of the text, cold history included; null if compressed cold text
+    // fails to decompress.
+    std::optional<std::string> text() const;
+    const ReferenceDefinitionTable& references() const { return *references_; }
+
+    // Tree of the text from coldSize() on; its children follow the
+    // coldBlockCount() cold blocks.
+    std::shared_ptr<MarkdownNode> document();
+
+    // Compresses the text and drops the trees of the parsed blocks that end
+    // before the last hotBytes of text and can no longer change. Returns the
+    // bytes of text compacted.
+    size_t compact(size_t hotBytes = kDefaultHotBytes);
+    size_t coldSize() const { return coldSize_; }
+    size_t coldBlockCount() const { return coldBlocks_; }
+    // Trees of cold blocks [begin, end), parsed from their decompressed text
+    // against the current link reference definitions; null if that text
+    // fails to decompress.
+    std::optional<std::vector<std::shared_ptr<MarkdownNode>>> coldBlocks(size_t begin, size_t end);
+
+    // Bytes of source handed to md4c by the last document() call.
+    size_t lastReparsedBytes() const { return lastReparsedBytes_; }
+
+    // Memory held by the session: its text, the current tree (block subtrees
+    // shared with the parser count once), block table, definitions and parser.
+    // Segments and cold chunks shared with snapshots and forks count in each
+    // of them; cold text counts compressed.
+    MemoryFootprint memoryFootprint() const;
+    // Node and string bytes of the blocks' trees, as memoryFootprint() counts
+    // them. Kept up to date block by block, so it costs nothing to read.
+    size_t treeBytes() const { return treeBytes_; }
+
+private:
+    struct Block {
+        size_t offset;
+        std::shared_ptr<MarkdownNode> node;
+        bool mayReference;
+        size_t bytes;
+    };
+
+    size_t blockCount() const { return frozenBlocks_ + blocks_.size(); }
+    const Block& block(size_t index) const;
+    // Number of blocks starting before offset.
+    size_t blocksBefore(size_t offset) const;
+    template <typename Fn>
+    void forEachBlock(Fn&& fn) const;
+
+    // Calls fn(offset, text) for the pieces [begin, end) is stored in, in
+    // order: parts of the segments' texts and of tail, which starts at
+    // tailBegin. Where texts overlap, the newer one is read.
+    template <typename Fn>
+    static void forEachPiece(const Segment* segment, std::string_view tail, size_t tailBegin, size_t begin,
+                             size_t end, Fn&& fn);
+    // Text in [begin, end), as a view into a segment or the tail where it
+    // lies in one, otherwise copied into scratch_.
+    std::string_view textView(size_t begin, size_t end);
+    // Offset just after the last newline before position, or coldSize_,
+    // which always starts a line.
+    size_t lineStart(size_t position) const;
+    // False if a chunk fails to decompress.
+    static bool appendColdText(const ColdChunks& chunks, std::string& out);
+    // Index of the cold chunk holding block index.
+    size_t coldChunkOf(size_t index) const;
+
+    // Moves the session's own text and blocks into a new segment.
+    void freeze();
+    // Replaces the segments and the session's own text with one segment of
+    // the hot text, holding the hot blocks too if keepBlocks.
+    void flatten(bool keepBlocks);
+    // Copies the text from offset on, and the blocks from index on, out of
+    // the segments so that the session can change them.
+    void thawText(size_t offset);
+    void thawBlocks(size_t index);
+    ReferenceDefinitionTable& mutableReferences();
+
+    // Hot text, from coldSize_ on.
+    std::string hotText() const;
+    size_t firstUnstableOffset() const;
+    bool reparseFrom(MD4CParser& parser, size_t offset);
+    bool reparseBlock(MD4CParser& parser, size_t index);
+    size_t blockEnd(size_t index) const;
+    void rebuildRoot();
+    void clearBlocks();
+
+    ParserOptions options_;
+    ParserPool* parsers_;
+    // Null when parsers come from parsers_.
+    std::unique_ptr<MD4CParser> parser_;
+    // Shared with snapshots until the session changes it.
+    std::shared_ptr<ReferenceDefinitionTable> references_;
+    // The first coldBlocks_ blocks and text before coldSize_, in chunks
+    // shared with snapshots. The last chunk read is kept decompressed.
+    std::shared_ptr<const ColdChunks> cold_;
+    size_t coldBlocks_ = 0;
+    size_t coldSize_ = 0;
+    size_t cachedChunk_ = SIZE_MAX;
+    std::string cachedText_;
+    // Hot text before tailBegin_ and the blocks before frozenBlocks_ come
+    // from segment_; the session's own text and blocks follow.
+    std::shared_ptr<const Segment> segment_;
+    size_t frozenBlocks_ = 0;
+    std::string tail_;
+    size_t tailBegin_ = 0;
+    std::vector<Block> blocks_;
+    std::string scratch_;
+    std::shared_ptr<MarkdownNode> root_;
+    size_t parsedSize_ = 0;
+    size_t lastReparsedBytes_ = 0;
+    size_t treeBytes_ = 0;
+};
+
+} // namespace NitroMarkdown
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <compare>
 #include <string>
 #include <vector>
 #include <optional>
@@ -99,6 +100,12 @@ struct MarkdownNode {
     std::optional<bool> checked;
     std::optional<bool> isHeader;
     std::optional<TextAlign> align;
+    // Set on paragraphs, headings and table cells whose inline children were
+    // deferred (ParserOptions::deferInlines); sourceStart/sourceEnd span the
+    // block's inline source.
+    std::optional<int> blockId;
+    std::optional<int> sourceStart;
+    std::optional<int> sourceEnd;
     std::vector<std::shared_ptr<MarkdownNode>> children;
 
     explicit MarkdownNode(NodeType t) : type(t) {}
@@ -110,9 +117,54 @@ struct MarkdownNode {
     }
 };
 
+struct ReferenceDefinition {
+    std::string label;
+    std::string destination;
+    std::string title;
+
+    auto operator<=>(const ReferenceDefinition&) const = default;
+};
+
 struct ParserOptions {
     bool gfm = true;
     bool math = true;
+    // Work budget for a single parse, in md4c work units (roughly lines, inline
+    // marks and links examined); 0 means unlimited.
+    size_t maxOperations = 0;
+    // Wall-clock budget for a single parse in milliseconds; 0 means unlimited.
+    double maxParseTimeMs = 0;
+    // Emit only the block structure; inline children of paragraphs, headings
+    // and table cells are materialized on demand via MD4CParser::parseInlines().
+    bool deferInlines = false;
+    // Fill in the phase timings and tree shape of ParseStats. Costs a couple
+    // of clock reads per leaf block and a few counters per node.
+    bool collectStats = false;
+};
+
+struct ParseStats {
+    size_t operations = 0;
+    double parseTimeMs = 0;
+    // Set when a budget was exceeded and the parse was cut short.
+    bool budgetExceeded = false;
+    // Source offset from which the input was rendered as plain text; only
+    // meaningful when budgetExceeded is set.
+    size_t plainTextOffset = 0;
+
+    // The rest is only filled in with ParserOptions::collectStats.
+    double blockAnalysisMs = 0;
+    double inlineAnalysisMs = 0;
+    // parseTimeMs minus both analysis phases: emitting events and building nodes.
+    double astBuildMs = 0;
+    // Set by whoever serializes the tree, e.g. the JS binding.
+    double serializationMs = 0;
+    size_t outputBytes = 0;
+    size_t nodeCount = 0;
+    size_t maxDepth = 0;
+    // Heap allocations made for the tree, estimated from its shape: one per
+    // node, one per growth of a children vector, one per out-of-line string.
+    // An estimate in every build; AllocationCounter has the real counts in
+    // test and bench builds.
+    size_t estimatedAllocations = 0;
 };
 
 } // namespace NitroMarkdown
@@ -0,0 +1,51 @@
+#include "MemoryAccounting.hpp"
+
+namespace NitroMarkdown {
+
+namespace {
+
+// std::make_shared puts the node behind its reference counts and a vtable
+// pointer in one allocation.
+constexpr size_t kControlBlockBytes = sizeof(void*) + 2 * sizeof(long);
+
+size_t optionalStringBytes(const std::optional<std::string>& s) {
+    return s ? MemoryFootprint::heapBytes(*s) : 0;
+}
+
+} // namespace
+
+MemoryFootprint& MemoryFootprint::operator+=(const MemoryFootprint& other) {
+    inputBytes += other.inputBytes;
+    nodeBytes += other.nodeBytes;
+    stringBytes += other.stringBytes;
+    scratchBytes += other.scratchBytes;
+    cacheBytes += other.cacheBytes;
+    return *this;
+}
+
+void MemoryFootprint::addTree(const MarkdownNode& node) {
+    addNode(node);
+    for (const auto& child : node.children) {
+        if (child) addTree(*child);
+    }
+}
+
+void MemoryFootprint::addNode(const MarkdownNode& node) {
+    nodeBytes += kControlBlockBytes + sizeof(MarkdownNode) + heapBytes(node.children);
+    stringBytes += optionalStringBytes(node.content) + optionalStringBytes(node.href) +
+                   optionalStringBytes(node.title) + optionalStringBytes(node.alt) +
+                   optionalStringBytes(node.language);
+}
+
+size_t MemoryFootprint::heapBytes(const std::string& s) {
+    const char* data = s.data();
+    const char* object = reinterpret_cast<const char*>(&s);
+    if (data >= object && data < object + sizeof(s)) return 0;
+    return s.capacity() + 1;
+}
+
+size_t MemoryFootprint::heapBytes(const ReferenceDefinition& definition) {
+    return heapBytes(definition.label) + heapBytes(definition.destination) + heapBytes(definition.title);
+}
+
+} // namespace NitroMarkdown
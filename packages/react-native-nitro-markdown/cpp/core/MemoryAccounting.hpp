@@ -0,0 +1,52 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Native memory retained by a parser or session between calls, in bytes
+ * requested from the allocator; allocator rounding and headers are not
+ * included. md4c's own buffers are freed at the end of every parse, so they
+ * only ever show up as the parser's retained scratch.
+ */
+struct MemoryFootprint {
+    // Source text kept alive, e.g. a session's buffer or the input of a
+    // parse with deferred inlines.
+    size_t inputBytes = 0;
+    // AST nodes with their shared_ptr control blocks and children arrays.
+    size_t nodeBytes = 0;
+    // Heap payloads of node strings; short strings stored inline count as 0.
+    size_t stringBytes = 0;
+    // Working buffers kept between calls: node stacks, block and line tables,
+    // link reference definitions.
+    size_t scratchBytes = 0;
+    // Cached parse results and serializations.
+    size_t cacheBytes = 0;
+
+    size_t total() const {
+        return inputBytes + nodeBytes + stringBytes + scratchBytes + cacheBytes;
+    }
+
+    MemoryFootprint& operator+=(const MemoryFootprint& other);
+
+    // Adds node and its subtree to nodeBytes and stringBytes. Shared subtrees
+    // are counted once per path to them.
+    void addTree(const MarkdownNode& node);
+    // Adds node without its children.
+    void addNode(const MarkdownNode& node);
+
+    // Heap bytes behind s, or 0 when it is stored inline.
+    static size_t heapBytes(const std::string& s);
+    static size_t heapBytes(const ReferenceDefinition& definition);
+
+    template <typename T>
+    static size_t heapBytes(const std::vector<T>& v) {
+        return v.capacity() * sizeof(T);
+    }
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,98 @@
+#include "MemoryPressure.hpp"
+#include "Tracer.hpp"
+
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace NitroMarkdown {
+
+namespace {
+
+struct Registry {
+    std::mutex mutex;
+    std::map<uint64_t, std::shared_ptr<const MemoryPressure::Handler>> handlers;
+    uint64_t nextId = 1;
+    // The handler notify() is running and its thread; unsubscribing waits
+    // for it on finished.
+    uint64_t running = 0;
+    std::thread::id runner;
+    std::condition_variable finished;
+    // Held by notify() throughout, one notification at a time.
+    std::mutex notifying;
+};
+
+// Leaked like TaskScheduler::shared(), so that subscriptions in other
+// statics can still unsubscribe during exit.
+Registry& registry() {
+    static Registry* registry = new Registry();
+    return *registry;
+}
+
+} // namespace
+
+MemoryPressure::Subscription::Subscription(Subscription&& other) noexcept : id_(std::exchange(other.id_, 0)) {}
+
+MemoryPressure::Subscription& MemoryPressure::Subscription::operator=(Subscription&& other) noexcept {
+    if (this != &other) {
+        reset();
+        id_ = std::exchange(other.id_, 0);
+    }
+    return *this;
+}
+
+MemoryPressure::Subscription::~Subscription() {
+    reset();
+}
+
+void MemoryPressure::Subscription::reset() {
+    if (id_ == 0) return;
+    auto& r = registry();
+    std::unique_lock<std::mutex> lock(r.mutex);
+    r.handlers.erase(id_);
+    if (r.runner != std::this_thread::get_id()) {
+        r.finished.wait(lock, [&] { return r.running != id_; });
+    }
+    id_ = 0;
+}
+
+MemoryPressure::Subscription MemoryPressure::subscribe(Handler handler) {
+    auto& r = registry();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    uint64_t id = r.nextId++;
+    r.handlers.emplace(id, std::make_shared<const Handler>(std::move(handler)));
+    return Subscription(id);
+}
+
+void MemoryPressure::notify(Level level) {
+    NITRO_MARKDOWN_TRACE_SCOPE("memory pressure", static_cast<int64_t>(level));
+    auto& r = registry();
+    std::lock_guard<std::mutex> serial(r.notifying);
+    std::vector<std::pair<uint64_t, std::shared_ptr<const Handler>>> handlers;
+    {
+        std::lock_guard<std::mutex> lock(r.mutex);
+        handlers.assign(r.handlers.begin(), r.handlers.end());
+    }
+    for (const auto& [id, handler] : handlers) {
+        {
+            std::lock_guard<std::mutex> lock(r.mutex);
+            // Unsubscribed by an earlier handler.
+            if (r.handlers.count(id) == 0) continue;
+            r.running = id;
+            r.runner = std::this_thread::get_id();
+        }
+        (*handler)(level);
+        {
+            std::lock_guard<std::mutex> lock(r.mutex);
+            r.running = 0;
+            r.runner = std::thread::id();
+        }
+        r.finished.notify_all();
+    }
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace NitroMarkdown {
+
+/**
+ * Process-wide memory-pressure notifications, e.g. forwarded from
+ * didReceiveMemoryWarning on iOS or onTrimMemory on Android, handed to
+ * everything in the library that holds memory it can give back: parsers,
+ * their pools, session hosts and caches.
+ *
+ * Handlers run on the thread that calls notify(), one notification at a
+ * time and without the registry locked, so they may subscribe and
+ * unsubscribe but not notify. That thread is usually not the one using the
+ * handler's object, so a handler must lock what it touches or leave the
+ * work to the object's own thread. Handlers must not throw.
+ */
+class MemoryPressure {
+public:
+    enum class Level {
+        // Give back what costs little to rebuild: idle parsers and spare
+        // buffer capacity.
+        Moderate,
+        // Also drop caches and trees that can be parsed again.
+        Critical,
+    };
+
+    using Handler = std::function<void(Level)>;
+
+    // Keeps a handler subscribed while it lives. Destroying it waits for a
+    // notification that is running the handler, unless the handler itself
+    // unsubscribes.
+    class Subscription {
+    public:
+        Subscription() = default;
+        Subscription(Subscription&& other) noexcept;
+        Subscription& operator=(Subscription&& other) noexcept;
+        ~Subscription();
+
+        void reset();
+
+    private:
+        friend class MemoryPressure;
+        explicit Subscription(uint64_t id) : id_(id) {}
+
+        uint64_t id_ = 0;
+    };
+
+    static Subscription subscribe(Handler handler);
+    // Calls every subscribed handler with level.
+    static void notify(Level level);
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,99 @@
+#include "ParseResultCache.hpp"
+#include "ContentHash.hpp"
+#include "MemoryAccounting.hpp"
+
+#include <cstring>
+
+namespace NitroMarkdown {
+
+namespace {
+
+// A list node holds two pointers besides the entry; a map node holds a next
+// pointer, the key, the iterator and usually a cached hash.
+constexpr size_t kListNodeOverhead = 2 * sizeof(void*);
+constexpr size_t kIndexNodeBytes = 3 * sizeof(void*) + sizeof(ParseResultCache::Key);
+
+} // namespace
+
+ParseResultCache::ParseResultCache(size_t capacityBytes) : capacityBytes_(capacityBytes) {}
+
+bool ParseResultCache::cacheable(const ParserOptions& options) {
+    return !options.deferInlines && !options.collectStats;
+}
+
+ParseResultCache::Key ParseResultCache::makeKey(std::string_view text, const ParserOptions& options, OffsetUnit unit) {
+    uint64_t timeBits = 0;
+    static_assert(sizeof(timeBits) == sizeof(options.maxParseTimeMs));
+    std::memcpy(&timeBits, &options.maxParseTimeMs, sizeof(timeBits));
+    uint64_t flags = (options.gfm ? 1u : 0u) | (options.math ? 2u : 0u) | (unit == OffsetUnit::Utf16 ? 4u : 0u);
+    uint64_t optionsHash = ContentHash::combine(ContentHash::combine(flags, options.maxOperations), timeBits);
+    return Key{ContentHash::hash(text, optionsHash), text.size()};
+}
+
+const ParseResultCache::Entry* ParseResultCache::find(const Key& key) {
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+        misses_++;
+        return nullptr;
+    }
+    hits_++;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return &*it->second;
+}
+
+void ParseResultCache::insert(const Key& key, std::string json, const ParseStats& stats) {
+    if (capacityBytes_ == 0) return;
+
+    auto existing = index_.find(key);
+    if (existing != index_.end()) {
+        bytes_ -= entryBytes(*existing->second);
+        entries_.erase(existing->second);
+        index_.erase(existing);
+    }
+
+    entries_.push_front(Entry{key, std::move(json), stats});
+    size_t size = entryBytes(entries_.front());
+    if (size > capacityBytes_) {
+        // Would evict everything else and still not fit.
+        entries_.pop_front();
+        return;
+    }
+    index_[key] = entries_.begin();
+    bytes_ += size;
+    evictToCapacity();
+}
+
+void ParseResultCache::setCapacity(size_t capacityBytes) {
+    capacityBytes_ = capacityBytes;
+    evictToCapacity();
+}
+
+void ParseResultCache::clear() {
+    entries_.clear();
+    index_.clear();
+    bytes_ = 0;
+}
+
+ParseResultCache::Stats ParseResultCache::stats() const {
+    return Stats{hits_, misses_, evictions_, entries_.size(), bytes_, capacityBytes_};
+}
+
+size_t ParseResultCache::memoryBytes() const {
+    return bytes_ + index_.bucket_count() * sizeof(void*);
+}
+
+size_t ParseResultCache::entryBytes(const Entry& entry) {
+    return sizeof(Entry) + kListNodeOverhead + kIndexNodeBytes + MemoryFootprint::heapBytes(entry.json);
+}
+
+void ParseResultCache::evictToCapacity() {
+    while (bytes_ > capacityBytes_ && !entries_.empty()) {
+        const Entry& oldest = entries_.back();
+        bytes_ -= entryBytes(oldest);
+        index_.erase(oldest.key);
+        entries_.pop_back();
+        evictions_++;
+    }
+}
+
+} // namespace NitroMarkdown
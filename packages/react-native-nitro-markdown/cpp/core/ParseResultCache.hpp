@@ -0,0 +1,94 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace NitroMarkdown {
+
+/**
+ * Bounded LRU cache of serialized parse results, keyed by a hash of the text
+ * and the options that affect the output. Lookups and inserts are O(1) after
+ * hashing the text. Entries are evicted, least recently used first, once
+ * their total size exceeds the capacity.
+ *
+ * Keys are 64-bit hashes plus the text length, so two different texts share
+ * an entry only on a hash collision (about 2^-64 per pair).
+ */
+class ParseResultCache {
+public:
+    static constexpr size_t kDefaultCapacityBytes = 4u << 20;
+
+    struct Key {
+        uint64_t hash = 0;
+        size_t size = 0;
+
+        bool operator==(const Key& other) const { return hash == other.hash && size == other.size; }
+    };
+
+    struct Entry {
+        Key key;
+        std::string json;
+        // Stats of the parse that produced json, reported again on a hit.
+        ParseStats stats;
+    };
+
+    struct Stats {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        size_t bytes = 0;
+        size_t capacityBytes = 0;
+    };
+
+    explicit ParseResultCache(size_t capacityBytes = kDefaultCapacityBytes);
+
+    // Whether results of parses with these options may be cached. Deferred
+    // inlines leave state in the parser that a cached result would not
+    // restore, and collectStats asks for the cost of a real parse.
+    static bool cacheable(const ParserOptions& options);
+
+    // Unit of the source offsets a result reports: indices into a JS string
+    // count UTF-16 code units, offsets into a buffer or file count bytes. The
+    // same text parsed both ways gets a key for each.
+    enum class OffsetUnit : uint8_t { Bytes, Utf16 };
+    static Key makeKey(std::string_view text, const ParserOptions& options, OffsetUnit unit = OffsetUnit::Bytes);
+
+    // Returns the entry and marks it most recently used, or nullptr. The
+    // pointer is valid until the next insert, setCapacity or clear.
+    const Entry* find(const Key& key);
+    void insert(const Key& key, std::string json, const ParseStats& stats);
+
+    // 0 disables the cache.
+    void setCapacity(size_t capacityBytes);
+    bool enabled() const { return capacityBytes_ > 0; }
+    void clear();
+
+    Stats stats() const;
+    // Heap bytes held by the entries and the index.
+    size_t memoryBytes() const;
+
+private:
+    struct KeyHash {
+        size_t operator()(const Key& key) const { return static_cast<size_t>(key.hash); }
+    };
+
+    static size_t entryBytes(const Entry& entry);
+    void evictToCapacity();
+
+    size_t capacityBytes_;
+    size_t bytes_ = 0;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+    size_t evictions_ = 0;
+    // Most recently used first.
+    std::list<Entry> entries_;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+};
+
+} // namespace NitroMarkdown
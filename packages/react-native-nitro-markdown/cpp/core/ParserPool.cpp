@@ -0,0 +1,57 @@
+#include "ParserPool.hpp"
+
+namespace NitroMarkdown {
+
+ParserPool::Lease::Lease(ParserPool* pool, std::unique_ptr<MD4CParser> parser)
+    : pool_(pool), parser_(std::move(parser)) {}
+
+ParserPool::Lease::~Lease() {
+    if (parser_) pool_->release(std::move(parser_));
+}
+
+ParserPool::ParserPool(size_t maxIdle) : maxIdle_(maxIdle) {}
+
+ParserPool::Lease ParserPool::acquire() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!idle_.empty()) {
+            auto parser = std::move(idle_.back());
+            idle_.pop_back();
+            return Lease(this, std::move(parser));
+        }
+        created_++;
+    }
+    return Lease(this, std::make_unique<MD4CParser>());
+}
+
+void ParserPool::release(std::unique_ptr<MD4CParser> parser) {
+    // The tree belongs to whoever parsed it; an idle parser must not keep it.
+    parser->releaseTree();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_.size() < maxIdle_) idle_.push_back(std::move(parser));
+}
+
+void ParserPool::trim() {
+    std::vector<std::unique_ptr<MD4CParser>> dropped;
+    std::lock_guard<std::mutex> lock(mutex_);
+    dropped.swap(idle_);
+}
+
+size_t ParserPool::idle() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_.size();
+}
+
+size_t ParserPool::created() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return created_;
+}
+
+MemoryFootprint ParserPool::memoryFootprint() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    MemoryFootprint footprint;
+    for (const auto& parser : idle_) footprint += parser->memoryFootprint(false);
+    return footprint;
+}
+
+} // namespace NitroMarkdown
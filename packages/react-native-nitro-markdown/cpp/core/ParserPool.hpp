@@ -0,0 +1,62 @@
+#pragma once
+
+#include "MD4CParser.hpp"
+#include "MarkdownTypes.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * MD4CParser instances lent out for one parse at a time, so that many
+ * documents share the working buffers of a few parsers instead of keeping
+ * one parser each. Parsers come back without their last tree. Thread-safe.
+ */
+class ParserPool {
+public:
+    static constexpr size_t kDefaultMaxIdle = 4;
+
+    // A parser on loan; returned to the pool when destroyed.
+    class Lease {
+    public:
+        Lease(Lease&&) = default;
+        Lease& operator=(Lease&&) = delete;
+        ~Lease();
+
+        MD4CParser& operator*() const { return *parser_; }
+        MD4CParser* operator->() const { return parser_.get(); }
+
+    private:
+        friend class ParserPool;
+        Lease(ParserPool* pool, std::unique_ptr<MD4CParser> parser);
+
+        ParserPool* pool_;
+        std::unique_ptr<MD4CParser> parser_;
+    };
+
+    // Keeps at most maxIdle parsers between loans; more are created when
+    // needed and dropped when they come back.
+    explicit ParserPool(size_t maxIdle = kDefaultMaxIdle);
+
+    Lease acquire();
+    // Drops the idle parsers and their buffers.
+    void trim();
+
+    size_t idle() const;
+    // Parsers created so far, including dropped ones.
+    size_t created() const;
+    // Buffers of the idle parsers.
+    MemoryFootprint memoryFootprint() const;
+
+private:
+    void release(std::unique_ptr<MD4CParser> parser);
+
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<MD4CParser>> idle_;
+    size_t maxIdle_;
+    size_t created_ = 0;
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,74 @@
+#include "ReferenceDefinitionTable.hpp"
+#include "MemoryAccounting.hpp"
+#include "../md4c/md4c.h"
+
+#include <algorithm>
+
+namespace NitroMarkdown {
+
+void ReferenceDefinitionTable::add(size_t owner, ReferenceDefinition definition) {
+    unsigned hash = md_ref_label_hash(definition.label.data(),
+                                      static_cast<MD_SIZE>(definition.label.size()));
+    auto& bucket = buckets_[hash];
+    auto pos = std::upper_bound(bucket.begin(), bucket.end(), owner,
+        [](size_t value, const Entry& entry) { return value < entry.owner; });
+    bucket.insert(pos, Entry{owner, std::move(definition)});
+    size_++;
+}
+
+void ReferenceDefinitionTable::removeOwnersFrom(size_t offset) {
+    for (auto it = buckets_.begin(); it != buckets_.end();) {
+        auto& bucket = it->second;
+        auto pos = std::lower_bound(bucket.begin(), bucket.end(), offset,
+            [](const Entry& entry, size_t value) { return entry.owner < value; });
+        size_ -= static_cast<size_t>(bucket.end() - pos);
+        bucket.erase(pos, bucket.end());
+        it = bucket.empty() ? buckets_.erase(it) : std::next(it);
+    }
+}
+
+void ReferenceDefinitionTable::clear() {
+    buckets_.clear();
+    size_ = 0;
+}
+
+const ReferenceDefinitionTable::Entry* ReferenceDefinitionTable::find(const char* label, size_t size) const {
+    if (size_ == 0) return nullptr;
+
+    auto it = buckets_.find(md_ref_label_hash(label, static_cast<MD_SIZE>(size)));
+    if (it == buckets_.end()) return nullptr;
+
+    for (const auto& entry : it->second) {
+        const auto& defLabel = entry.definition.label;
+        if (md_ref_label_equal(defLabel.data(), static_cast<MD_SIZE>(defLabel.size()),
+                               label, static_cast<MD_SIZE>(size))) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+std::vector<ReferenceDefinition> ReferenceDefinitionTable::definitionsFrom(size_t offset) const {
+    std::vector<ReferenceDefinition> result;
+    for (const auto& [hash, bucket] : buckets_) {
+        for (const auto& entry : bucket) {
+            if (entry.owner >= offset) result.push_back(entry.definition);
+        }
+    }
+    return result;
+}
+
+size_t ReferenceDefinitionTable::memoryBytes() const {
+    // Each map node holds the key/value pair and a next pointer.
+    size_t bytes = buckets_.bucket_count() * sizeof(void*);
+    for (const auto& [hash, bucket] : buckets_) {
+        bytes += sizeof(void*) + sizeof(std::pair<const unsigned, std::vector<Entry>>) +
+                 MemoryFootprint::heapBytes(bucket);
+        for (const auto& entry : bucket) {
+            bytes += MemoryFootprint::heapBytes(entry.definition);
+        }
+    }
+    return bytes;
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "MarkdownTypes.hpp"
+#include <cstddef>
+#include <unordered_map>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Link reference definitions of a document, kept outside of md4c so they
+ * survive partial reparses. Every definition is owned by the offset of the
+ * block that defines it, which lets callers replace definitions block by
+ * block and preserves "first definition wins" ordering.
+ */
+class ReferenceDefinitionTable {
+public:
+    struct Entry {
+        size_t owner;
+        ReferenceDefinition definition;
+    };
+
+    void add(size_t owner, ReferenceDefinition definition);
+    void removeOwnersFrom(size_t offset);
+    void clear();
+
+    // Returns the first definition in document order matching the label,
+    // using md4c's label equivalence rules, or nullptr.
+    const Entry* find(const char* label, size_t size) const;
+
+    // Definitions owned by blocks at or after the given offset, in no particular order.
+    std::vector<ReferenceDefinition> definitionsFrom(size_t offset) const;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    // Heap bytes held by the table: hash buckets, entries and their strings.
+    size_t memoryBytes() const;
+
+private:
+    std::unordered_map<unsigned, std::vector<Entry>> buckets_;
+    size_t size_ = 0;
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,369 @@
+#include "SessionHost.hpp"
+#include "Tracer.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace NitroMarkdown {
+
+SessionHost::Session::Session(SessionId id, const ParserOptions& options, ParserPool* parsers, Listener listener)
+    : id(id), listener(std::move(listener)), core(options, parsers) {}
+
+SessionHost::Session::Session(SessionId id, const MarkdownSessionCore::Snapshot& snapshot, ParserPool* parsers,
+                              Listener listener)
+    : id(id), listener(std::move(listener)), textBytes(snapshot.size()), core(snapshot, parsers) {}
+
+SessionHost::SessionHost(size_t memoryBudget, size_t maxConcurrent, TaskScheduler& scheduler)
+    : scheduler_(scheduler),
+      parsers_(maxConcurrent == 0 ? scheduler.threads() : maxConcurrent),
+      memoryBudget_(memoryBudget),
+      maxConcurrent_(maxConcurrent == 0 ? scheduler.threads() : maxConcurrent) {
+    pressure_ = MemoryPressure::subscribe(
+        [this](MemoryPressure::Level level) { trim(level == MemoryPressure::Level::Critical); });
+}
+
+SessionHost& SessionHost::shared() {
+    // Leaked like TaskScheduler::shared(): sessions of objects the JS GC
+    // collects late may still be closing during static destruction.
+    static SessionHost* host = new SessionHost();
+    return *host;
+}
+
+SessionHost::~SessionHost() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+    ready_.clear();
+}
+
+SessionHost::SessionId SessionHost::open(const ParserOptions& options, Listener listener) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SessionId id = nextId_++;
+    sessions_.emplace(id, std::make_shared<Session>(id, options, &parsers_, std::move(listener)));
+    return id;
+}
+
+SessionHost::SessionId SessionHost::open(const MarkdownSessionCore::Snapshot& snapshot, Listener listener) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    SessionId id = nextId_++;
+    // Its tree, if the snapshot has one, is published on the first document().
+    sessions_.emplace(id, std::make_shared<Session>(id, snapshot, &parsers_, std::move(listener)));
+    textBytes_ += snapshot.size();
+    return id;
+}
+
+void SessionHost::close(SessionId id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto session = find(id);
+    // A worker updating it finishes but publishes nothing.
+    session->closed = true;
+    session->pending.clear();
+    session->published.reset();
+    treeBytes_ -= session->treeBytes;
+    textBytes_ -= session->textBytes;
+    sessions_.erase(id);
+}
+
+void SessionHost::setListener(SessionId id, Listener listener) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    find(id)->listener = std::move(listener);
+}
+
+void SessionHost::append(SessionId id, std::string_view chunk) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    std::shared_ptr<Session> session = findHealthy(id);
+    if (chunk.empty()) return;
+    session->pending += chunk;
+    session->textBytes += chunk.size();
+    textBytes_ += chunk.size();
+    schedule(lock, std::move(session));
+}
+
+void SessionHost::clear(SessionId id) {
+    std::shared_ptr<Session> session = lookup(id);
+    std::lock_guard<std::mutex> core(session->coreMutex);
+    std::lock_guard<std::mutex> lock(mutex_);
+    find(id);
+    session->pending.clear();
+    session->error = nullptr;
+    session->core.clear();
+    session->published.reset();
+    session->publishedBytes = 0;
+    treeBytes_ -= session->treeBytes;
+    textBytes_ -= session->textBytes;
+    session->treeBytes = 0;
+    session->textBytes = 0;
+}
+
+std::optional<std::string> SessionHost::text(SessionId id) {
+    std::shared_ptr<Session> session = lookup(id);
+    std::lock_guard<std::mutex> core(session->coreMutex);
+    std::string pending;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending = find(id)->pending;
+    }
+    // Read without moving pending into the core, which would make the
+    // published tree stale.
+    auto text = session->core.text();
+    if (text) *text += pending;
+    return text;
+}
+
+MarkdownSessionCore::Snapshot SessionHost::snapshot(SessionId id) {
+    std::shared_ptr<Session> session = lookup(id);
+    std::lock_guard<std::mutex> core(session->coreMutex);
+    std::unique_lock<std::mutex> lock(mutex_);
+    findHealthy(id);
+    std::string chunk;
+    chunk.swap(session->pending);
+    lock.unlock();
+    try {
+        session->core.append(chunk);
+    } catch (...) {
+        lock.lock();
+        session->error = std::current_exception();
+        throw;
+    }
+    return session->core.snapshot();
+}
+
+size_t SessionHost::compact(SessionId id, size_t hotBytes) {
+    std::shared_ptr<Session> session = lookup(id);
+    size_t compacted;
+    {
+        std::lock_guard<std::mutex> core(session->coreMutex);
+        compacted = session->core.compact(hotBytes);
+    }
+    if (compacted == 0) return 0;
+
+    // Dropped rather than replaced, since a worker may have published a
+    // newer tree by now; the core rebuilds it without parsing.
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!session->closed) {
+        session->published.reset();
+        treeBytes_ -= session->treeBytes;
+        session->treeBytes = 0;
+    }
+    return compacted;
+}
+
+size_t SessionHost::coldBlockCount(SessionId id) {
+    std::shared_ptr<Session> session = lookup(id);
+    std::lock_guard<std::mutex> core(session->coreMutex);
+    return session->core.coldBlockCount();
+}
+
+std::optional<std::vector<std::shared_ptr<MarkdownNode>>> SessionHost::coldBlocks(SessionId id, size_t begin,
+                                                                                   size_t end) {
+    std::shared_ptr<Session> session = lookup(id);
+    std::lock_guard<std::mutex> core(session->coreMutex);
+    return session->core.coldBlocks(begin, end);
+}
+
+size_t SessionHost::memoryBytes(SessionId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = sessions_.find(id);
+    if (it == sessions_.end()) return 0;
+    return it->second->textBytes + it->second->treeBytes;
+}
+
+std::shared_ptr<MarkdownNode> SessionHost::document(SessionId id) {
+    std::shared_ptr<Session> session;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        session = findHealthy(id);
+        if (session->current()) return session->published;
+    }
+
+    std::lock_guard<std::mutex> core(session->coreMutex);
+    std::unique_lock<std::mutex> lock(mutex_);
+    // A worker may have failed it or published a current tree meanwhile.
+    findHealthy(id);
+    return update(lock, *session);
+}
+
+void SessionHost::flush() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    idle_.wait(lock, [&] { return ready_.empty() && draining_ == 0; });
+    if (error_) {
+        std::exception_ptr error = error_;
+        error_ = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void SessionHost::trim(bool dropTrees) {
+    NITRO_MARKDOWN_TRACE_SCOPE("session host trim", static_cast<int64_t>(dropTrees));
+    parsers_.trim();
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto& [id, session] : sessions_) {
+        if (session->scheduled) continue;
+        std::unique_lock<std::mutex> core(session->coreMutex, std::try_to_lock);
+        if (!core) continue;
+        if (dropTrees && session->published) evict(*session);
+        session->core.trim();
+    }
+}
+
+SessionHost::Stats SessionHost::stats() const {
+    Stats stats;
+    stats.parsers = parsers_.created();
+    stats.parserBytes = parsers_.memoryFootprint().total();
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.sessions = sessions_.size();
+    stats.pending = ready_.size();
+    stats.updates = updates_;
+    stats.evictions = evictions_;
+    stats.treeBytes = treeBytes_;
+    stats.textBytes = textBytes_;
+    return stats;
+}
+
+std::shared_ptr<SessionHost::Session> SessionHost::lookup(SessionId id) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return find(id);
+}
+
+const std::shared_ptr<SessionHost::Session>& SessionHost::find(SessionId id) const {
+    auto it = sessions_.find(id);
+    if (it == sessions_.end()) throw std::invalid_argument("Unknown session");
+    return it->second;
+}
+
+const std::shared_ptr<SessionHost::Session>& SessionHost::findHealthy(SessionId id) const {
+    const auto& session = find(id);
+    if (session->error) std::rethrow_exception(session->error);
+    return session;
+}
+
+void SessionHost::schedule(std::unique_lock<std::mutex>& lock, std::shared_ptr<Session> session) {
+    if (!session->listener || session->scheduled || session->pending.empty()) return;
+    session->scheduled = true;
+    ready_.push_back(std::move(session));
+    startDrain(lock);
+}
+
+void SessionHost::startDrain(std::unique_lock<std::mutex>& lock) {
+    if (stopping_ || draining_ >= maxConcurrent_) return;
+    draining_++;
+    lock.unlock();
+    if (!scheduler_.submit(drains_, TaskScheduler::Priority::Visible, [this] { drain(); })) drain();
+    lock.lock();
+}
+
+void SessionHost::drain() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    size_t turns = ready_.size();
+    for (;;) {
+        while (!ready_.empty() && ready_.front()->closed) ready_.pop_front();
+        if (stopping_ || ready_.empty()) break;
+        if (turns == 0) {
+            // After a round, queue again behind whatever else the scheduler
+            // has, e.g. batch parses.
+            lock.unlock();
+            if (scheduler_.submit(drains_, TaskScheduler::Priority::Visible, [this] { drain(); })) return;
+            lock.lock();
+            turns = ready_.size();
+            continue;
+        }
+        turns--;
+        std::shared_ptr<Session> session = std::move(ready_.front());
+        ready_.pop_front();
+        lock.unlock();
+
+        std::unique_lock<std::mutex> core(session->coreMutex);
+        lock.lock();
+        std::shared_ptr<MarkdownNode> root;
+        Listener listener;
+        // document() may have parsed it meanwhile.
+        if (!session->closed && !session->error && !session->current()) {
+            try {
+                NITRO_MARKDOWN_TRACE_SCOPE("session host update", static_cast<int64_t>(session->id));
+                root = update(lock, *session);
+                updates_++;
+                if (!session->closed) listener = session->listener;
+            } catch (...) {
+                if (!error_) error_ = std::current_exception();
+            }
+        }
+        core.unlock();
+        if (listener) {
+            // Still scheduled, so the next update of this session waits.
+            lock.unlock();
+            listener(session->id, root);
+            lock.lock();
+        }
+        // Text that arrived meanwhile waits behind everyone already queued.
+        if (!session->pending.empty() && session->listener && !session->error && !session->closed && !stopping_) {
+            ready_.push_back(std::move(session));
+        } else {
+            session->scheduled = false;
+        }
+    }
+    draining_--;
+    idle_.notify_all();
+}
+
+void SessionHost::publish(Session& session, std::shared_ptr<MarkdownNode> root, size_t treeBytes,
+                          size_t textBytes) {
+    session.published = std::move(root);
+    session.publishedBytes = textBytes;
+    session.lastUpdate = ++clock_;
+    treeBytes_ += treeBytes;
+    treeBytes_ -= session.treeBytes;
+    session.treeBytes = treeBytes;
+    if (treeBytes_ <= memoryBudget_) return;
+
+    std::vector<Session*> idle;
+    for (const auto& [id, other] : sessions_) {
+        if (other.get() != &session && !other->scheduled && other->published) idle.push_back(other.get());
+    }
+    std::sort(idle.begin(), idle.end(),
+              [](const Session* a, const Session* b) { return a->lastUpdate < b->lastUpdate; });
+    for (Session* other : idle) {
+        if (treeBytes_ <= memoryBudget_) break;
+        // Skip a session being parsed by document() on another thread.
+        std::unique_lock<std::mutex> core(other->coreMutex, std::try_to_lock);
+        if (!core) continue;
+        evict(*other);
+    }
+}
+
+std::shared_ptr<MarkdownNode> SessionHost::update(std::unique_lock<std::mutex>& lock, Session& session) {
+    if (session.current()) return session.published;
+    std::string chunk;
+    chunk.swap(session.pending);
+    size_t textBytes = session.textBytes;
+    lock.unlock();
+
+    std::shared_ptr<MarkdownNode> root;
+    size_t treeBytes = 0;
+    std::exception_ptr error;
+    try {
+        session.core.append(chunk);
+        root = session.core.document();
+        treeBytes = session.core.treeBytes();
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    lock.lock();
+    if (error) {
+        // The core may hold only part of the text now.
+        session.error = error;
+        std::rethrow_exception(error);
+    }
+    if (!session.closed) publish(session, root, treeBytes, textBytes);
+    return root;
+}
+
+void SessionHost::evict(Session& session) {
+    session.core.releaseTree();
+    session.published.reset();
+    treeBytes_ -= session.treeBytes;
+    session.treeBytes = 0;
+    evictions_++;
+}
+
+} // namespace NitroMarkdown
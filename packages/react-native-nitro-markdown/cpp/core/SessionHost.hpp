@@ -0,0 +1,212 @@
+#pragma once
+
+#include "MarkdownSessionCore.hpp"
+#include "MarkdownTypes.hpp"
+#include "MemoryPressure.hpp"
+#include "ParserPool.hpp"
+#include "TaskScheduler.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Streaming documents updated side by side, e.g. the answers of several
+ * models compared at once. The sessions share one ParserPool, the
+ * TaskScheduler and one memory budget for their trees, instead of each
+ * keeping a parser and trees of any size.
+ *
+ * append() only queues text. Only sessions with a listener are reparsed in
+ * the background: they wait in one queue, oldest first; a worker takes the
+ * first, reparses it with everything it received since its last turn,
+ * publishes the tree and calls the listener. A session is in the queue at
+ * most once, so a fast stream gets one reparse per round however many
+ * chunks it appends, and cannot starve the others. A session without a
+ * listener is parsed when document() asks for its tree.
+ *
+ * When the trees of all sessions together exceed the budget, the sessions
+ * updated least recently drop theirs, keeping the text, and parse it again
+ * on their next update or document() call. On MemoryPressure notifications
+ * the host trims itself, dropping all idle trees when pressure is critical.
+ *
+ * A session whose reparse throws, e.g. std::bad_alloc, fails: append() and
+ * document() rethrow the exception until clear().
+ */
+class SessionHost {
+public:
+    using SessionId = uint64_t;
+    // Called on a worker thread with each tree a session publishes. Calls for
+    // one session never overlap; the listener may call into the host.
+    using Listener = std::function<void(SessionId, const std::shared_ptr<MarkdownNode>&)>;
+
+    static constexpr size_t kDefaultMemoryBudget = 16u << 20;
+
+    // The host all MarkdownSession objects live in, so that every JS
+    // runtime's streams share its parsers and budget. Never destroyed.
+    static SessionHost& shared();
+
+    struct Stats {
+        size_t sessions = 0;
+        // Sessions waiting for a worker.
+        size_t pending = 0;
+        // Trees published by workers.
+        size_t updates = 0;
+        // Trees dropped to stay within the budget.
+        size_t evictions = 0;
+        size_t treeBytes = 0;
+        size_t textBytes = 0;
+        // Parsers the pool created, and buffers of the idle ones.
+        size_t parsers = 0;
+        size_t parserBytes = 0;
+    };
+
+    // Updates at most maxConcurrent sessions at a time; 0 allows one per
+    // worker of scheduler.
+    explicit SessionHost(size_t memoryBudget = kDefaultMemoryBudget, size_t maxConcurrent = 0,
+                         TaskScheduler& scheduler = TaskScheduler::shared());
+    // Drops queued updates and waits for the ones in progress.
+    ~SessionHost();
+    SessionHost(const SessionHost&) = delete;
+    SessionHost& operator=(const SessionHost&) = delete;
+
+    SessionId open(const ParserOptions& options = ParserOptions{}, Listener listener = nullptr);
+    // A session that goes on from snapshot, e.g. to regenerate an answer.
+    SessionId open(const MarkdownSessionCore::Snapshot& snapshot, Listener listener = nullptr);
+    void close(SessionId id);
+
+    // Methods taking an id throw std::invalid_argument for one that is not open.
+    // Replaces the session's listener, which decides whether text appended
+    // from now on is reparsed in the background. A call in progress may
+    // still reach the old listener.
+    void setListener(SessionId id, Listener listener);
+    void append(SessionId id, std::string_view chunk);
+    // Drops the session's text, queued text included, and its tree, and
+    // clears a failure.
+    void clear(SessionId id);
+    // All text appended so far, queued text included; null if compacted
+    // text fails to decompress. Waits for a reparse of the session in
+    // progress, but does not start one.
+    std::optional<std::string> text(SessionId id);
+    // The session's state with all text appended so far; O(1), see
+    // MarkdownSessionCore::snapshot().
+    MarkdownSessionCore::Snapshot snapshot(SessionId id);
+    // Compacts the session's history, see MarkdownSessionCore::compact(),
+    // and drops its published tree, which the next document() rebuilds
+    // from the hot blocks. Returns the bytes of text compacted.
+    size_t compact(SessionId id, size_t hotBytes = MarkdownSessionCore::kDefaultHotBytes);
+    size_t coldBlockCount(SessionId id);
+    // Trees of the session's cold blocks [begin, end); null if their text
+    // fails to decompress.
+    std::optional<std::vector<std::shared_ptr<MarkdownNode>>> coldBlocks(SessionId id, size_t begin, size_t end);
+    // Text and tree bytes the session holds; 0 for one that is not open.
+    size_t memoryBytes(SessionId id) const;
+    // The tree of all text appended so far. Unless the last tree published
+    // is still current, e.g. after new text or an eviction, the session is
+    // parsed on the calling thread, after a reparse in progress.
+    std::shared_ptr<MarkdownNode> document(SessionId id);
+
+    // Blocks until every queued update has been published, then rethrows the
+    // first exception an update threw since the last call. Not from a listener.
+    void flush();
+
+    // Drops the idle parsers and spare buffer capacity of the sessions not
+    // being updated; with dropTrees also their trees, as the budget would.
+    void trim(bool dropTrees = false);
+
+    size_t maxConcurrent() const { return maxConcurrent_; }
+    Stats stats() const;
+
+private:
+    struct Session {
+        Session(SessionId id, const ParserOptions& options, ParserPool* parsers, Listener listener);
+        Session(SessionId id, const MarkdownSessionCore::Snapshot& snapshot, ParserPool* parsers, Listener listener);
+
+        const SessionId id;
+
+        // Guarded by the host's mutex_. A scheduled session is queued or
+        // being updated, and is not evicted. published is the tree of the
+        // first publishedBytes of text, current while that is all of it.
+        Listener listener;
+        std::string pending;
+        bool scheduled = false;
+        bool closed = false;
+        std::exception_ptr error;
+        std::shared_ptr<MarkdownNode> published;
+        size_t publishedBytes = 0;
+        uint64_t lastUpdate = 0;
+        size_t treeBytes = 0;
+        size_t textBytes = 0;
+
+        // Locked before mutex_, which only ever try-locks it, so that a
+        // reparse holds it without blocking the host. core has all text
+        // appended but pending.
+        std::mutex coreMutex;
+        MarkdownSessionCore core;
+
+        bool current() const { return published && publishedBytes == textBytes; }
+    };
+
+    // find() under its own lock of mutex_.
+    std::shared_ptr<Session> lookup(SessionId id) const;
+
+    // These require mutex_.
+    const std::shared_ptr<Session>& find(SessionId id) const;
+    // find(), throwing the session's failure if it has one.
+    const std::shared_ptr<Session>& findHealthy(SessionId id) const;
+    // Queues session for a worker if it has a listener and new text.
+    void schedule(std::unique_lock<std::mutex>& lock, std::shared_ptr<Session> session);
+    // Starts a worker unless maxConcurrent_ already run; when the scheduler's
+    // queue is full, works through the queue on the calling thread instead.
+    void startDrain(std::unique_lock<std::mutex>& lock);
+    // Records session's new tree of its first textBytes, then evicts trees
+    // of other idle sessions, least recently updated first, until the
+    // budget holds.
+    void publish(Session& session, std::shared_ptr<MarkdownNode> root, size_t treeBytes, size_t textBytes);
+    // Drops session's tree; also requires its coreMutex.
+    void evict(Session& session);
+    // Moves the session's queued text into its core and returns the tree of
+    // it, reparsing unless the published one is current. Requires the
+    // session's coreMutex; takes mutex_ through lock, which it holds again
+    // on return. A reparse that throws fails the session.
+    std::shared_ptr<MarkdownNode> update(std::unique_lock<std::mutex>& lock, Session& session);
+
+    // Updates queued sessions until the queue is empty, a round at a time.
+    void drain();
+
+    TaskScheduler& scheduler_;
+    ParserPool parsers_;
+    size_t memoryBudget_;
+    size_t maxConcurrent_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable idle_;
+    std::unordered_map<SessionId, std::shared_ptr<Session>> sessions_;
+    std::deque<std::shared_ptr<Session>> ready_;
+    SessionId nextId_ = 1;
+    uint64_t clock_ = 0;
+    size_t draining_ = 0;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+    size_t updates_ = 0;
+    size_t evictions_ = 0;
+    size_t treeBytes_ = 0;
+    size_t textBytes_ = 0;
+
+    // Last, so that they are destroyed first: no more trims once the host
+    // goes, then waiting for running workers.
+    TaskScheduler::Group drains_;
+    MemoryPressure::Subscription pressure_;
+};
+
+} // namespace NitroMarkdown
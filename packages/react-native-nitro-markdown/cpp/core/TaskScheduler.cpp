@@ -0,0 +1,222 @@
+#include "TaskScheduler.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace NitroMarkdown {
+
+namespace {
+
+// The scheduler and queue index of the calling thread, if it is a worker.
+thread_local TaskScheduler* currentScheduler = nullptr;
+thread_local size_t currentIndex = 0;
+
+} // namespace
+
+TaskScheduler::Group::Group() : state_(std::make_shared<State>()) {}
+
+TaskScheduler::Group::~Group() {
+    cancel();
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->done.wait(lock, [&] { return state_->idle(); });
+}
+
+void TaskScheduler::Group::cancel() {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    state_->cancelled = true;
+    state_->done.notify_all();
+}
+
+bool TaskScheduler::Group::cancelled() const {
+    return state_->cancelled;
+}
+
+void TaskScheduler::Group::wait() {
+    // A worker waiting for other tasks runs them, or whatever else is queued,
+    // instead of blocking; with every worker waiting nothing would run.
+    if (currentScheduler) currentScheduler->helpUntilIdle(*state_);
+
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->done.wait(lock, [&] { return state_->idle(); });
+    if (state_->error) {
+        std::exception_ptr error = state_->error;
+        state_->error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+bool TaskScheduler::Group::State::idle() const {
+    return running == 0 && (queued == 0 || cancelled);
+}
+
+TaskScheduler& TaskScheduler::shared() {
+    // Never destroyed: joining workers during static destruction would race
+    // with whatever else is being torn down.
+    static TaskScheduler* scheduler = [] {
+        size_t hardware = std::max(1u, std::thread::hardware_concurrency());
+        return new TaskScheduler(std::clamp<size_t>(hardware - 1, 1, 3));
+    }();
+    return *scheduler;
+}
+
+TaskScheduler::TaskScheduler(size_t threads, size_t maxQueuedTasks) : maxQueuedTasks_(maxQueuedTasks) {
+    threads = std::max<size_t>(threads, 1);
+    for (size_t i = 0; i < threads; i++) queues_.push_back(std::make_unique<Queue>());
+    workers_.reserve(threads);
+    for (size_t i = 0; i < threads; i++) workers_.emplace_back([this, i] { workerLoop(i); });
+}
+
+TaskScheduler::~TaskScheduler() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+        stopping_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) worker.join();
+
+    // Release whoever waits for tasks that will never run.
+    auto drop = [](Queue& queue) {
+        for (auto& tasks : queue.tasks) {
+            for (auto& task : tasks) {
+                task.run = nullptr;
+                std::lock_guard<std::mutex> lock(task.group->mutex);
+                task.group->queued--;
+                task.group->cancelled = true;
+                task.group->done.notify_all();
+            }
+            tasks.clear();
+        }
+    };
+    for (auto& queue : queues_) drop(*queue);
+    drop(injected_);
+}
+
+bool TaskScheduler::submit(Group& group, Priority priority, std::function<void()> task) {
+    size_t queued = queued_.load();
+    do {
+        if (queued >= maxQueuedTasks_) {
+            rejected_++;
+            return false;
+        }
+    } while (!queued_.compare_exchange_weak(queued, queued + 1));
+
+    {
+        std::lock_guard<std::mutex> lock(group.state_->mutex);
+        if (group.state_->cancelled) {
+            queued_--;
+            return false;
+        }
+        group.state_->queued++;
+    }
+
+    Queue& queue = currentScheduler == this ? *queues_[currentIndex] : injected_;
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.tasks[static_cast<size_t>(priority)].push_back(Task{std::move(task), group.state_});
+    }
+    {
+        // Taking the lock orders this against a worker's check of queued_
+        // before it sleeps, so the notification cannot be missed.
+        std::lock_guard<std::mutex> lock(sleepMutex_);
+    }
+    wake_.notify_one();
+    return true;
+}
+
+TaskScheduler::Stats TaskScheduler::stats() const {
+    return Stats{executed_, stolen_, cancelled_, rejected_, queued_};
+}
+
+void TaskScheduler::workerLoop(size_t index) {
+    currentScheduler = this;
+    currentIndex = index;
+    for (;;) {
+        Task task;
+        if (take(index, task)) {
+            execute(task);
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleepMutex_);
+        wake_.wait(lock, [&] { return stopping_ || queued_ > 0; });
+        if (stopping_) return;
+    }
+}
+
+bool TaskScheduler::take(size_t index, Task& task) {
+    auto pop = [&](Queue& queue, size_t priority, bool newest) {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        auto& tasks = queue.tasks[priority];
+        if (tasks.empty()) return false;
+        if (newest) {
+            task = std::move(tasks.back());
+            tasks.pop_back();
+        } else {
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        queued_--;
+        return true;
+    };
+
+    for (size_t priority = 0; priority < kPriorities; priority++) {
+        if (pop(*queues_[index], priority, true)) return true;
+        if (pop(injected_, priority, false)) return true;
+        for (size_t k = 1; k < queues_.size(); k++) {
+            if (pop(*queues_[(index + k) % queues_.size()], priority, false)) {
+                stolen_++;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void TaskScheduler::execute(Task& task) {
+    Group::State& group = *task.group;
+    {
+        std::lock_guard<std::mutex> lock(group.mutex);
+        group.queued--;
+        if (group.cancelled) {
+            cancelled_++;
+            task.run = nullptr;
+            group.done.notify_all();
+            return;
+        }
+        group.running++;
+    }
+
+    std::exception_ptr error;
+    try {
+        task.run();
+    } catch (...) {
+        error = std::current_exception();
+    }
+    // The task may refer to the waiter's stack; release it before the waiter
+    // can return.
+    task.run = nullptr;
+    executed_++;
+
+    std::lock_guard<std::mutex> lock(group.mutex);
+    if (error && !group.error) group.error = error;
+    group.running--;
+    group.done.notify_all();
+}
+
+void TaskScheduler::helpUntilIdle(Group::State& group) {
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(group.mutex);
+            if (group.idle()) return;
+        }
+        Task task;
+        if (take(currentIndex, task)) {
+            execute(task);
+            continue;
+        }
+        // Everything left is running on other workers.
+        std::unique_lock<std::mutex> lock(group.mutex);
+        group.done.wait_for(lock, std::chrono::milliseconds(1), [&] { return group.idle(); });
+    }
+}
+
+} // namespace NitroMarkdown
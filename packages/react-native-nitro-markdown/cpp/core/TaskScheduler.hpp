@@ -0,0 +1,139 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NitroMarkdown {
+
+/**
+ * Worker threads shared by everything in the library that parses off the
+ * calling thread, so that concurrent batches, sessions and cache warm-ups
+ * neither start threads of their own nor oversubscribe the cores.
+ *
+ * Each worker has a deque per priority. Tasks submitted from a worker go to
+ * its own deque, where it takes the newest first while its data is still in
+ * cache; idle workers steal the oldest from the others. Tasks from other
+ * threads go to a shared queue. Every Visible task anywhere runs before any
+ * Prefetch task. At most maxQueuedTasks wait at a time; submit() refuses
+ * more, so a producer that outpaces the workers has to do the work itself.
+ */
+class TaskScheduler {
+public:
+    enum class Priority {
+        // Work someone is waiting for, e.g. the messages on screen.
+        Visible,
+        // Work done ahead of need, e.g. parsing history that is not shown yet.
+        Prefetch,
+    };
+
+    static constexpr size_t kDefaultMaxQueuedTasks = 256;
+
+    // Tasks submitted together, to be waited for or cancelled as a whole.
+    // Destroying a group cancels and waits for it, so tasks may refer to
+    // anything that outlives the group.
+    class Group {
+    public:
+        Group();
+        ~Group();
+        Group(const Group&) = delete;
+        Group& operator=(const Group&) = delete;
+
+        // Tasks of the group that have not started are dropped; running ones
+        // can poll cancelled() to stop early.
+        void cancel();
+        bool cancelled() const;
+        // Blocks until every task of the group has run or been dropped, then
+        // rethrows the first exception one of them threw.
+        void wait();
+
+    private:
+        friend class TaskScheduler;
+        // Counters are guarded by mutex. Queued tasks wait in a queue; running
+        // ones have been taken by a worker and passed the cancellation check.
+        // A cancelled group is idle as soon as none of its tasks runs.
+        struct State {
+            std::atomic<bool> cancelled{false};
+            std::mutex mutex;
+            std::condition_variable done;
+            size_t queued = 0;
+            size_t running = 0;
+            std::exception_ptr error;
+
+            bool idle() const;
+        };
+        std::shared_ptr<State> state_;
+    };
+
+    struct Stats {
+        size_t executed = 0;
+        // Tasks a worker took from another worker's deque.
+        size_t stolen = 0;
+        // Tasks dropped because their group was cancelled.
+        size_t cancelled = 0;
+        // Tasks submit() refused because the queue was full.
+        size_t rejected = 0;
+        size_t queued = 0;
+    };
+
+    // Shared by the whole library: one worker per hardware thread besides
+    // the caller's, at least one and at most three.
+    static TaskScheduler& shared();
+
+    explicit TaskScheduler(size_t threads, size_t maxQueuedTasks = kDefaultMaxQueuedTasks);
+    // Drops queued tasks and joins the workers.
+    ~TaskScheduler();
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    // Queues task as part of group. Returns false, without running it, when
+    // maxQueuedTasks are already waiting or the group is cancelled.
+    bool submit(Group& group, Priority priority, std::function<void()> task);
+
+    size_t threads() const { return workers_.size(); }
+    Stats stats() const;
+
+private:
+    static constexpr size_t kPriorities = 2;
+
+    struct Task {
+        std::function<void()> run;
+        std::shared_ptr<Group::State> group;
+    };
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks[kPriorities];
+    };
+
+    void workerLoop(size_t index);
+    bool take(size_t index, Task& task);
+    void execute(Task& task);
+    // Runs queued tasks on the calling worker until group is idle.
+    void helpUntilIdle(Group::State& group);
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    // Tasks submitted from threads that are not workers.
+    Queue injected_;
+    std::vector<std::thread> workers_;
+    size_t maxQueuedTasks_;
+
+    std::mutex sleepMutex_;
+    std::condition_variable wake_;
+    bool stopping_ = false;
+
+    std::atomic<size_t> queued_{0};
+    std::atomic<size_t> executed_{0};
+    std::atomic<size_t> stolen_{0};
+    std::atomic<size_t> cancelled_{0};
+    std::atomic<size_t> rejected_{0};
+};
+
+} // namespace NitroMarkdown
@@ -0,0 +1,125 @@
+#include "TextCodec.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace NitroMarkdown {
+
+namespace {
+
+// Each sequence is a token byte holding the literal count and the match
+// length minus kMinMatch in its two nibbles, the literals, then a 16-bit
+// little-endian match offset. A nibble of 15 continues in further bytes,
+// each added until one is below 255. The last sequence has literals only.
+constexpr size_t kMinMatch = 4;
+constexpr size_t kMaxOffset = 65535;
+constexpr int kHashBits = 13;
+
+inline uint32_t read32(const char* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+inline uint32_t hashOf(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+}
+
+void appendLength(std::string& out, size_t length) {
+    for (; length >= 255; length -= 255) out += static_cast<char>(255);
+    out += static_cast<char>(length);
+}
+
+void appendSequence(std::string& out, std::string_view literals, size_t offset, size_t matchLength) {
+    size_t matchCode = matchLength == 0 ? 0 : matchLength - kMinMatch;
+    out += static_cast<char>((std::min<size_t>(literals.size(), 15) << 4) | std::min<size_t>(matchCode, 15));
+    if (literals.size() >= 15) appendLength(out, literals.size() - 15);
+    out.append(literals);
+    if (matchLength == 0) return;
+    out += static_cast<char>(offset & 0xff);
+    out += static_cast<char>(offset >> 8);
+    if (matchCode >= 15) appendLength(out, matchCode - 15);
+}
+
+} // namespace
+
+std::string TextCodec::compress(std::string_view text) {
+    std::string out;
+    out.reserve(text.size() / 2 + 16);
+    const char* data = text.data();
+    size_t size = text.size();
+    // Last position each hash was seen at, plus one; 0 for none.
+    std::vector<uint32_t> table(size_t(1) << kHashBits, 0);
+
+    size_t anchor = 0;
+    size_t position = 0;
+    while (position + kMinMatch <= size) {
+        uint32_t sequence = read32(data + position);
+        uint32_t& slot = table[hashOf(sequence)];
+        size_t candidate = slot;
+        slot = static_cast<uint32_t>(position + 1);
+        if (candidate != 0 && position - (candidate - 1) <= kMaxOffset && read32(data + candidate - 1) == sequence) {
+            size_t match = candidate - 1;
+            size_t length = kMinMatch;
+            while (position + length < size && data[match + length] == data[position + length]) length++;
+            appendSequence(out, text.substr(anchor, position - anchor), position - match, length);
+            position += length;
+            anchor = position;
+        } else {
+            // Step faster through text that does not compress.
+            position += 1 + ((position - anchor) >> 5);
+        }
+    }
+    appendSequence(out, text.substr(anchor), 0, 0);
+    return out;
+}
+
+bool TextCodec::decompress(std::string_view compressed, size_t rawSize, std::string& out) {
+    out.resize(rawSize);
+    char* dst = out.data();
+    size_t written = 0;
+    const auto* in = reinterpret_cast<const unsigned char*>(compressed.data());
+    size_t size = compressed.size();
+    size_t position = 0;
+
+    auto readLength = [&](size_t& length) {
+        for (;;) {
+            if (position >= size) return false;
+            unsigned char byte = in[position++];
+            length += byte;
+            if (byte != 255) return true;
+        }
+    };
+
+    while (position < size) {
+        unsigned char token = in[position++];
+        size_t literals = token >> 4;
+        if (literals == 15 && !readLength(literals)) return false;
+        if (literals > size - position || literals > rawSize - written) return false;
+        std::memcpy(dst + written, in + position, literals);
+        position += literals;
+        written += literals;
+        if (position == size) break;
+
+        if (size - position < 2) return false;
+        size_t offset = in[position] | static_cast<size_t>(in[position + 1]) << 8;
+        position += 2;
+        size_t length = token & 15;
+        if (length == 15 && !readLength(length)) return false;
+        length += kMinMatch;
+        if (offset == 0 || offset > written || length > rawSize - written) return false;
+        const char* from = dst + written - offset;
+        if (offset >= length) {
+            std::memcpy(dst + written, from, length);
+        } else {
+            // The match repeats the bytes it is copying.
+            for (size_t i = 0; i < length; i++) dst[written + i] = from[i];
+        }
+        written += length;
+    }
+    return written == rawSize;
+}
+
+} // namespace NitroMarkdown
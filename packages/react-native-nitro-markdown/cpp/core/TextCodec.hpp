@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+/**
+ * Byte-oriented LZ77 compression in the style of LZ4 for text kept in
+ * memory, e.g. the cold history of a long session. Markdown shrinks to
+ * about a third; both directions run at several hundred MB/s, so text can
+ * be decompressed whenever it is needed again instead of staying resident.
+ *
+ * The format has no header: decompress() needs the original size. Not
+ * meant for persisting, since it may change between versions.
+ */
+class TextCodec {
+public:
+    static std::string compress(std::string_view text);
+
+    // Replaces out with the text of compressed, which must be rawSize bytes
+    // long. Returns false, leaving out unspecified, if compressed is damaged.
+    static bool decompress(std::string_view compressed, size_t rawSize, std::string& out);
+};
+
+} // namespace NitroMarkdown
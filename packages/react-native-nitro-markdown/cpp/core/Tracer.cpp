@@ -0,0 +1,129 @@
+#include "Tracer.hpp"
+#include "MarkdownJsonSerializer.hpp"
+#include "../md4c/md4c.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <vector>
+
+namespace NitroMarkdown {
+
+namespace {
+
+struct Event {
+    const char* name;
+    int64_t offset;
+    double startUs;
+    double durationUs;
+    uint32_t thread;
+};
+
+struct OpenSpan {
+    const char* name;
+    int64_t offset;
+    std::chrono::steady_clock::time_point start;
+};
+
+std::atomic<bool> isRecording{false};
+std::atomic<uint32_t> nextThread{1};
+std::mutex eventsMutex;
+std::vector<Event> events;
+std::chrono::steady_clock::time_point origin;
+
+thread_local std::vector<OpenSpan> openSpans;
+thread_local uint32_t threadNumber = 0;
+
+double microseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+} // namespace
+
+void Tracer::start() {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    events.clear();
+    origin = std::chrono::steady_clock::now();
+    isRecording = true;
+}
+
+void Tracer::stop() {
+    isRecording = false;
+}
+
+bool Tracer::recording() {
+    return isRecording;
+}
+
+void Tracer::begin(const char* name, int64_t offset) {
+    if (!isRecording) return;
+    openSpans.push_back({name, offset, std::chrono::steady_clock::now()});
+}
+
+void Tracer::end() {
+    if (openSpans.empty()) return;
+    auto now = std::chrono::steady_clock::now();
+    OpenSpan span = openSpans.back();
+    openSpans.pop_back();
+    if (!isRecording) return;
+
+    if (threadNumber == 0) threadNumber = nextThread++;
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    events.push_back({span.name, span.offset, microseconds(span.start - origin), microseconds(now - span.start),
+                      threadNumber});
+}
+
+void Tracer::endTo(size_t depth) {
+    while (openSpans.size() > depth) end();
+}
+
+size_t Tracer::depth() {
+    return openSpans.size();
+}
+
+std::string Tracer::toJson() {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    std::string out = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    char buffer[160];
+    for (size_t i = 0; i < events.size(); i++) {
+        const auto& event = events[i];
+        if (i > 0) out += ',';
+        out += "\n{\"name\":\"";
+        MarkdownJsonSerializer::appendEscaped(out, event.name);
+        std::snprintf(buffer, sizeof(buffer),
+                      "\",\"cat\":\"markdown\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f",
+                      event.thread, event.startUs, event.durationUs);
+        out += buffer;
+        if (event.offset >= 0) {
+            std::snprintf(buffer, sizeof(buffer), ",\"args\":{\"offset\":%lld}", static_cast<long long>(event.offset));
+            out += buffer;
+        }
+        out += '}';
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+size_t Tracer::eventCount() {
+    std::lock_guard<std::mutex> lock(eventsMutex);
+    return events.size();
+}
+
+} // namespace NitroMarkdown
+
+#ifdef NITRO_MARKDOWN_TRACE
+
+extern "C" {
+
+void md_hook_trace_begin(const char* name, MD_OFFSET offset) {
+    NitroMarkdown::Tracer::begin(name, offset);
+}
+
+void md_hook_trace_end(void) {
+    NitroMarkdown::Tracer::end();
+}
+
+} // extern "C"
+
+#endif
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace NitroMarkdown {
+
+/**
+ * Records parser phases as Chrome trace events ("X" complete events), for
+ * chrome://tracing, Perfetto or speedscope. Trace points only exist in
+ * builds with NITRO_MARKDOWN_TRACE (which also build md4c with
+ * MD4C_TRACE_HOOKS); elsewhere NITRO_MARKDOWN_TRACE_SCOPE compiles to nothing
+ * and a recording stays empty.
+ *
+ * Spans: "parse" / "parseInlines" / "session document" and "serialize" from
+ * the C++ side; "analyze blocks", one "leaf block: <type>" per leaf block and
+ * within it "analyze inlines" and "emit inlines" (where the AST is built)
+ * from md4c. Spans carry the offset they start at within the text handed to
+ * the parser.
+ */
+class Tracer {
+public:
+    static constexpr bool kEnabled =
+#ifdef NITRO_MARKDOWN_TRACE
+        true;
+#else
+        false;
+#endif
+
+    // Discards earlier events and records until stop().
+    static void start();
+    static void stop();
+    static bool recording();
+
+    static void begin(const char* name, int64_t offset = -1);
+    // Closes the innermost open span of the calling thread.
+    static void end();
+    // Closes open spans of the calling thread until `depth` remain.
+    static void endTo(size_t depth);
+    static size_t depth();
+
+    // {"traceEvents":[...]} with every event recorded so far.
+    static std::string toJson();
+    static size_t eventCount();
+};
+
+class TraceScope {
+public:
+    explicit TraceScope(const char* name, int64_t offset = -1) : depth_(Tracer::depth()) {
+        Tracer::begin(name, offset);
+    }
+    // Also closes spans md4c left open when a callback aborted the parse.
+    ~TraceScope() { Tracer::endTo(depth_); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    size_t depth_;
+};
+
+} // namespace NitroMarkdown
+
+#ifdef NITRO_MARKDOWN_TRACE
+#define NITRO_MARKDOWN_TRACE_CONCAT_(a, b) a##b
+#define NITRO_MARKDOWN_TRACE_CONCAT(a, b) NITRO_MARKDOWN_TRACE_CONCAT_(a, b)
+#define NITRO_MARKDOWN_TRACE_SCOPE(...) \
+    ::NitroMarkdown::TraceScope NITRO_MARKDOWN_TRACE_CONCAT(traceScope_, __LINE__)(__VA_ARGS__)
+#else
+#define NITRO_MARKDOWN_TRACE_SCOPE(...) ((void)0)
+#endif
@@ -0,0 +1,27 @@
+#include "Utf16.hpp"
+
+#include <algorithm>
+
+namespace NitroMarkdown {
+
+size_t Utf16::length(std::string_view text) {
+    size_t length = 0;
+    for (unsigned char c : text) {
+        // Continuation bytes add nothing; 4-byte sequences become surrogate pairs.
+        if ((c & 0xC0) != 0x80) length += c >= 0xF0 ? 2 : 1;
+    }
+    return length;
+}
+
+size_t Utf16::OffsetMap::operator()(size_t offset) {
+    offset = std::min(offset, text_.size());
+    if (offset < byteOffset_) {
+        byteOffset_ = 0;
+        unitOffset_ = 0;
+    }
+    unitOffset_ += length(text_.substr(byteOffset_, offset - byteOffset_));
+    byteOffset_ = offset;
+    return unitOffset_;
+}
+
+} // namespace NitroMarkdown
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+
+namespace NitroMarkdown {
+
+/**
+ * UTF-16 lengths and offsets of UTF-8 text. The parser works on UTF-8 and
+ * reports byte offsets; JS strings index UTF-16 code units, which differ
+ * from bytes beyond ASCII.
+ *
+ * There is no UTF-16 input path: Nitro passes a JS string to the binding as
+ * a std::string the JS engine already converted to UTF-8, so parsing the
+ * string's UTF-16 text without that conversion cannot be done from here.
+ * Offsets into it are mapped back instead.
+ */
+class Utf16 {
+public:
+    // Length of UTF-8 text in UTF-16 code units, the unit of JS string offsets.
+    static size_t length(std::string_view text);
+
+    // Converts byte offsets into one text to UTF-16 offsets, counting from
+    // the last offset converted, so that ascending offsets, e.g. those of a
+    // tree in document order, cost one pass over the text together.
+    class OffsetMap {
+    public:
+        explicit OffsetMap(std::string_view text) : text_(text) {}
+        size_t operator()(size_t offset);
+
+    private:
+        std::string_view text_;
+        size_t byteOffset_ = 0;
+        size_t unitOffset_ = 0;
+    };
+};
+
+} // namespace NitroMarkdown
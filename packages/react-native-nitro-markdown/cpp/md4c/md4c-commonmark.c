@@ -0,0 +1,11 @@
+/*
+ * md_parse_commonmark(): md4c compiled with MD_SPECIALIZED_FLAGS_COMMONMARK as
+ * compile-time constant flags. See MD_PARSER_FLAGS() in md4c.c.
+ */
+
+#include "md4c.h"
+
+#define MD4C_FIXED_FLAGS    MD_SPECIALIZED_FLAGS_COMMONMARK
+#define md_parse            md_parse_commonmark
+
+#include "md4c.c"
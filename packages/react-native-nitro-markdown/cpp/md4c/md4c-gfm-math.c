@@ -0,0 +1,11 @@
+/*
+ * md_parse_gfm_math(): md4c compiled with MD_SPECIALIZED_FLAGS_GFM_MATH as
+ * compile-time constant flags. See MD_PARSER_FLAGS() in md4c.c.
+ */
+
+#include "md4c.h"
+
+#define MD4C_FIXED_FLAGS    MD_SPECIALIZED_FLAGS_GFM_MATH
+#define md_parse            md_parse_gfm_math
+
+#include "md4c.c"
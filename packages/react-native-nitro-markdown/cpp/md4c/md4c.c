@@ -31,6 +31,33 @@
 #include <stdlib.h>
 #include <string.h>
 
+/* Builds with MD4C_ALLOC_HOOKS route all heap allocations through hooks the
+ * application provides, e.g. to count them. */
+#ifdef MD4C_ALLOC_HOOKS
+    void* md_hook_malloc(size_t size);
+    void* md_hook_realloc(void* ptr, size_t size);
+    void md_hook_free(void* ptr);
+
+    #define malloc(size)            md_hook_malloc(size)
+    #define realloc(ptr, size)      md_hook_realloc((ptr), (size))
+    #define free(ptr)               md_hook_free(ptr)
+#endif
+
+/* Builds with MD4C_TRACE_HOOKS report the main parsing phases as nested spans;
+ * otherwise the trace points compile to nothing. md_hook_trace_end() closes
+ * the innermost open span. Spans left open by an abort are the application's
+ * to close. */
+#ifdef MD4C_TRACE_HOOKS
+    void md_hook_trace_begin(const char* name, MD_OFFSET offset);
+    void md_hook_trace_end(void);
+
+    #define MD_TRACE_BEGIN(name, off)   md_hook_trace_begin((name), (MD_OFFSET)(off))
+    #define MD_TRACE_END()              md_hook_trace_end()
+#else
+    #define MD_TRACE_BEGIN(name, off)   do {} while(0)
+    #define MD_TRACE_END()              do {} while(0)
+#endif
+
 
 /*****************************
  ***  Miscellaneous Stuff  ***
@@ -251,6 +278,10 @@ struct MD_CTX_tag {
     int n_block_bytes;
     int alloc_block_bytes;
 
+    /* Offset in block_bytes of the most recently pushed MD_BLOCK header,
+     * or -1 if it has been removed. */
+    int last_block_byte_off;
+
     /* For container block analysis. */
     MD_CONTAINER* containers;
     int n_containers;
@@ -259,6 +290,16 @@ struct MD_CTX_tag {
     /* Minimal indentation to call the block "indented code block". */
     unsigned code_indent_offset;
 
+    /* Offset of the start of the line currently being analyzed. */
+    OFF line_beg;
+
+    /* Work accounting for MD_PARSER::work(). */
+    unsigned long work;
+    unsigned long work_next_report;
+    /* Non-zero result of MD_PARSER::work() reported where it could not be
+     * returned right away (see MD_WORK_DEFERRED()). */
+    int work_ret;
+
     /* Contextual info for line analysis. */
     SZ code_fence_length;   /* For checking closing fence length. */
     int html_block_type;    /* For checking closing raw HTML condition. */
@@ -309,6 +350,15 @@ struct MD_VERBATIMLINE_tag {
  ***  Helpers  ***
  *****************/
 
+/* Parser flags. A translation unit which defines MD4C_FIXED_FLAGS before
+ * including this file (see md4c-gfm.c and friends) gets them as a compile-time
+ * constant, so the branches of disabled extensions are compiled out. */
+#ifdef MD4C_FIXED_FLAGS
+    #define MD_PARSER_FLAGS(ctx)    ((unsigned) (MD4C_FIXED_FLAGS))
+#else
+    #define MD_PARSER_FLAGS(ctx)    ((ctx)->parser.flags)
+#endif
+
 /* Character accessors. */
 #define CH(off)                 (ctx->text[(off)])
 #define STR(off)                (ctx->text + (off))
@@ -407,7 +457,9 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
         ret = ctx->parser.text(MD_TEXT_NULLCHAR, _T(""), 1, ctx->userdata);
         if(ret != 0)
             return ret;
-        off++;
+        /* Skip the NUL itself, or the next text run would start with it. */
+        str++;
+        size--;
     }
 }
 
@@ -420,6 +472,42 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
     } while(0)
 
 
+/* How many work units may pass between two calls of MD_PARSER::work(). */
+#define MD_WORK_QUANTUM     256
+
+#define MD_WORK(units)                                                      \
+    do {                                                                    \
+        ctx->work += (units);                                               \
+        if(ctx->work >= ctx->work_next_report) {                            \
+            ret = md_report_work(ctx);                                      \
+            if(ret != 0)                                                    \
+                goto abort;                                                 \
+        }                                                                   \
+    } while(0)
+
+/* Like MD_WORK() for the void functions of inline analysis, which have no
+ * abort label to jump to: a non-zero result is kept in ctx->work_ret, their
+ * loops stop as soon as it is set and md_analyze_inlines() returns it. */
+#define MD_WORK_DEFERRED(units)                                             \
+    do {                                                                    \
+        ctx->work += (units);                                               \
+        if(ctx->work >= ctx->work_next_report  &&  ctx->work_ret == 0)      \
+            ctx->work_ret = md_report_work(ctx);                            \
+    } while(0)
+
+static int
+md_report_work(MD_CTX* ctx)
+{
+    if(ctx->parser.work == NULL) {
+        ctx->work_next_report = (unsigned long)(-1);
+        return 0;
+    }
+
+    ctx->work_next_report = ctx->work + MD_WORK_QUANTUM;
+    return ctx->parser.work(ctx->work, ctx->userdata);
+}
+
+
 #define MD_TEMP_BUFFER(sz)                                                  \
     do {                                                                    \
         if(sz > ctx->alloc_buffer) {                                        \
@@ -439,6 +527,12 @@ md_text_with_null_replacement(MD_CTX* ctx, MD_TEXTTYPE type, const CHAR* str, SZ
     } while(0)
 
 
+#define MD_BLOCK_OFFSET(type, off)                                          \
+    do {                                                                    \
+        if(ctx->parser.block_offset != NULL)                                \
+            ctx->parser.block_offset((type), (off), ctx->userdata);         \
+    } while(0)
+
 #define MD_ENTER_BLOCK(type, arg)                                           \
     do {                                                                    \
         ret = ctx->parser.enter_block((type), (arg), ctx->userdata);        \
@@ -1870,6 +1964,36 @@ md_free_ref_def_hashtable(MD_CTX* ctx)
     }
 }
 
+static int
+md_report_ref_defs(MD_CTX* ctx)
+{
+    int i;
+    int ret = 0;
+
+    if(ctx->parser.ref_def == NULL)
+        return 0;
+
+    for(i = 0; i < ctx->n_ref_defs; i++) {
+        const MD_REF_DEF* def = &ctx->ref_defs[i];
+        MD_REF_DEF_DETAIL det;
+
+        det.label = def->label;
+        det.label_size = def->label_size;
+        det.dest = STR(def->dest_beg);
+        det.dest_size = def->dest_end - def->dest_beg;
+        det.title = def->title;
+        det.title_size = def->title_size;
+
+        ret = ctx->parser.ref_def(&det, ctx->userdata);
+        if(ret != 0) {
+            MD_LOG("Aborted from ref_def() callback.");
+            return ret;
+        }
+    }
+
+    return ret;
+}
+
 static const MD_REF_DEF*
 md_lookup_ref_def(MD_CTX* ctx, const CHAR* label, SZ label_size)
 {
@@ -1924,6 +2048,11 @@ struct MD_LINK_ATTR_tag {
     OFF dest_beg;
     OFF dest_end;
 
+    /* Set instead of dest_beg/dest_end when the destination comes from
+     * MD_PARSER::lookup_ref_def(), i.e. it does not live in the document. */
+    const CHAR* ext_dest;
+    SZ ext_dest_size;
+
     CHAR* title;
     SZ title_size;
     int title_needs_free;
@@ -2288,6 +2417,8 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     int is_multiline;
     CHAR* label;
     SZ label_size;
+    MD_SIZE output_size_estimation = 0;
+    int is_found = FALSE;
     int ret = FALSE;
 
     MD_ASSERT(CH(beg) == _T('[') || CH(beg) == _T('!'));
@@ -2311,21 +2442,41 @@ md_is_link_reference(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
         label_size = end - beg;
     }
 
-    def = md_lookup_ref_def(ctx, label, label_size);
-    if(def != NULL) {
-        attr->dest_beg = def->dest_beg;
-        attr->dest_end = def->dest_end;
-        attr->title = def->title;
-        attr->title_size = def->title_size;
-        attr->title_needs_free = FALSE;
+    if(ctx->parser.lookup_ref_def != NULL) {
+        MD_REF_DEF_DETAIL ext_def;
+
+        memset(&ext_def, 0, sizeof(MD_REF_DEF_DETAIL));
+        if(ctx->parser.lookup_ref_def(label, label_size, &ext_def, ctx->userdata)) {
+            attr->dest_beg = 0;
+            attr->dest_end = 0;
+            attr->ext_dest = ext_def.dest;
+            attr->ext_dest_size = ext_def.dest_size;
+            attr->title = (CHAR*) ext_def.title;
+            attr->title_size = ext_def.title_size;
+            attr->title_needs_free = FALSE;
+            output_size_estimation = ext_def.label_size + ext_def.title_size + ext_def.dest_size;
+            is_found = TRUE;
+        }
+    }
+
+    if(!is_found) {
+        def = md_lookup_ref_def(ctx, label, label_size);
+        if(def != NULL) {
+            attr->dest_beg = def->dest_beg;
+            attr->dest_end = def->dest_end;
+            attr->title = def->title;
+            attr->title_size = def->title_size;
+            attr->title_needs_free = FALSE;
+            output_size_estimation = def->label_size + def->title_size + def->dest_end - def->dest_beg;
+            is_found = TRUE;
+        }
     }
 
     if(is_multiline)
         free(label);
 
-    if(def != NULL) {
+    if(is_found) {
         /* See https://github.com/mity/md4c/issues/238 */
-        MD_SIZE output_size_estimation = def->label_size + def->title_size + def->dest_end - def->dest_beg;
         if(output_size_estimation < ctx->max_ref_def_output) {
             ctx->max_ref_def_output -= output_size_estimation;
             ret = TRUE;
@@ -2552,6 +2703,7 @@ struct MD_MARK_tag {
 #define MD_MARK_AUTOLINK_MISSING_MAILTO     0x40
 #define MD_MARK_VALIDPERMISSIVEAUTOLINK     0x20  /* For permissive autolinks. */
 #define MD_MARK_HASNESTEDBRACKETS           0x20  /* For '[' to rule out invalid link labels early */
+#define MD_MARK_EXTERNALDEST                0x20  /* For 'D' holding a pointer to a destination outside of the document */
 
 static MD_MARKSTACK*
 md_emph_stack(MD_CTX* ctx, MD_CHAR ch, unsigned flags)
@@ -2715,11 +2867,14 @@ md_rollback(MD_CTX* ctx, int opener_index, int closer_index, int how)
 
     for(i = 0; i < (int) SIZEOF_ARRAY(ctx->opener_stacks); i++) {
         MD_MARKSTACK* stack = &ctx->opener_stacks[i];
-        while(stack->top >= opener_index)
+        while(stack->top >= opener_index) {
             md_mark_stack_pop(ctx, stack);
+            MD_WORK_DEFERRED(1);
+        }
     }
 
     if(how == MD_ROLLBACK_ALL) {
+        MD_WORK_DEFERRED(closer_index - opener_index);
         for(i = opener_index + 1; i < closer_index; i++) {
             ctx->marks[i].ch = 'D';
             ctx->marks[i].flags = 0;
@@ -2745,25 +2900,25 @@ md_build_mark_char_map(MD_CTX* ctx)
     ctx->mark_char_map[']'] = 1;
     ctx->mark_char_map['\0'] = 1;
 
-    if(ctx->parser.flags & MD_FLAG_STRIKETHROUGH)
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_STRIKETHROUGH)
         ctx->mark_char_map['~'] = 1;
 
-    if(ctx->parser.flags & MD_FLAG_LATEXMATHSPANS)
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_LATEXMATHSPANS)
         ctx->mark_char_map['$'] = 1;
 
-    if(ctx->parser.flags & MD_FLAG_PERMISSIVEEMAILAUTOLINKS)
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEEMAILAUTOLINKS)
         ctx->mark_char_map['@'] = 1;
 
-    if(ctx->parser.flags & MD_FLAG_PERMISSIVEURLAUTOLINKS)
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEURLAUTOLINKS)
         ctx->mark_char_map[':'] = 1;
 
-    if(ctx->parser.flags & MD_FLAG_PERMISSIVEWWWAUTOLINKS)
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEWWWAUTOLINKS)
         ctx->mark_char_map['.'] = 1;
 
-    if((ctx->parser.flags & MD_FLAG_TABLES) || (ctx->parser.flags & MD_FLAG_WIKILINKS))
+    if((MD_PARSER_FLAGS(ctx) & MD_FLAG_TABLES) || (MD_PARSER_FLAGS(ctx) & MD_FLAG_WIKILINKS))
         ctx->mark_char_map['|'] = 1;
 
-    if(ctx->parser.flags & MD_FLAG_COLLAPSEWHITESPACE) {
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_COLLAPSEWHITESPACE) {
         int i;
 
         for(i = 0; i < (int) sizeof(ctx->mark_char_map); i++) {
@@ -2902,8 +3057,9 @@ md_is_autolink_uri(MD_CTX* ctx, OFF beg, OFF max_end, OFF* p_end)
 
     MD_ASSERT(CH(beg) == _T('<'));
 
-    /* Check for scheme. */
-    if(off >= max_end  ||  !ISASCII(off))
+    /* Check for scheme. It starts with a letter; anything else, a newline
+     * in particular, would let the autolink span lines. */
+    if(off >= max_end  ||  !ISALPHA(off))
         return FALSE;
     off++;
     while(1) {
@@ -3163,7 +3319,7 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table_m
                 OFF autolink_end;
                 int missing_mailto;
 
-                if(!(ctx->parser.flags & MD_FLAG_NOHTMLSPANS)) {
+                if(!(MD_PARSER_FLAGS(ctx) & MD_FLAG_NOHTMLSPANS)) {
                     int is_html;
                     OFF html_end;
 
@@ -3289,7 +3445,7 @@ md_collect_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table_m
             }
 
             /* A potential table cell boundary or wiki link label delimiter. */
-            if((table_mode || ctx->parser.flags & MD_FLAG_WIKILINKS) && ch == _T('|')) {
+            if((table_mode || MD_PARSER_FLAGS(ctx) & MD_FLAG_WIKILINKS) && ch == _T('|')) {
                 ADD_MARK(ch, off, off+1, 0);
                 off++;
                 continue;
@@ -3419,6 +3575,9 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
         MD_LINK_ATTR attr;
         int is_link = FALSE;
 
+        attr.ext_dest = NULL;
+        attr.ext_dest_size = 0;
+
         if(next_index >= 0) {
             next_opener = &ctx->marks[next_index];
             next_closer = &ctx->marks[next_opener->next];
@@ -3427,6 +3586,11 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
             next_closer = NULL;
         }
 
+        /* Also stops once the analysis of a link's contents ran out. */
+        MD_WORK_DEFERRED(1);
+        if(ctx->work_ret != 0)
+            return ctx->work_ret;
+
         /* If nested ("[ [ ] ]"), we need to make sure that:
          *   - The outer does not end inside of (...) belonging to the inner.
          *   - The outer cannot be link if the inner is link (i.e. not image).
@@ -3445,7 +3609,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
         /* Recognize and resolve wiki links.
          * Wiki-links maybe '[[destination]]' or '[[destination|label]]'.
          */
-        if ((ctx->parser.flags & MD_FLAG_WIKILINKS) &&
+        if ((MD_PARSER_FLAGS(ctx) & MD_FLAG_WIKILINKS) &&
             (opener->end - opener->beg == 1) &&         /* not image */
             next_opener != NULL &&                      /* double '[' opener */
             next_opener->ch == '[' &&
@@ -3589,8 +3753,19 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
                 }
 
                 if(is_link) {
+                    int i = closer_index + 1;
+
                     /* Eat the "(...)" */
                     closer->end = inline_link_end;
+
+                    /* Marks inside the destination and title are plain text;
+                     * e.g. a '*' there must not pair with one after the link,
+                     * or the emphasis is entered or left without the other. */
+                    while(i < ctx->n_marks  &&  ctx->marks[i].beg < inline_link_end) {
+                        ctx->marks[i].ch = 'D';
+                        ctx->marks[i].flags = 0;
+                        i++;
+                    }
                 }
             }
 
@@ -3611,8 +3786,14 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
             /* If it is a link, we store the destination and title in the two
              * dummy marks after the opener. */
             MD_ASSERT(ctx->marks[opener_index+1].ch == 'D');
-            ctx->marks[opener_index+1].beg = attr.dest_beg;
-            ctx->marks[opener_index+1].end = attr.dest_end;
+            if(attr.ext_dest != NULL) {
+                md_mark_store_ptr(ctx, opener_index+1, (void*) attr.ext_dest);
+                ctx->marks[opener_index+1].prev = attr.ext_dest_size;
+                ctx->marks[opener_index+1].flags |= MD_MARK_EXTERNALDEST;
+            } else {
+                ctx->marks[opener_index+1].beg = attr.dest_beg;
+                ctx->marks[opener_index+1].end = attr.dest_end;
+            }
 
             MD_ASSERT(ctx->marks[opener_index+2].ch == 'D');
             md_mark_store_ptr(ctx, opener_index+2, attr.title);
@@ -3634,7 +3815,7 @@ md_resolve_links(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
             /* If the link text is formed by nothing but permissive autolink,
              * suppress the autolink.
              * See https://github.com/mity/md4c/issues/152 for more info. */
-            if(ctx->parser.flags & MD_FLAG_PERMISSIVEAUTOLINKS) {
+            if(MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEAUTOLINKS) {
                 MD_MARK* first_nested;
                 MD_MARK* last_nested;
 
@@ -4048,6 +4229,11 @@ md_analyze_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     while(i < mark_end) {
         MD_MARK* mark = &ctx->marks[i];
 
+        /* A paragraph may hold enough marks to exceed the budget alone. */
+        MD_WORK_DEFERRED(1);
+        if(ctx->work_ret != 0)
+            return;
+
         /* Skip resolved spans. */
         if(mark->flags & MD_MARK_RESOLVED) {
             if((mark->flags & MD_MARK_OPENER)  &&
@@ -4100,6 +4286,15 @@ md_analyze_marks(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     }
 }
 
+/* Returns what MD_WORK_DEFERRED() kept from the analysis before. */
+#define MD_CHECK_WORK()                                                     \
+    do {                                                                    \
+        if(ctx->work_ret != 0) {                                            \
+            ret = ctx->work_ret;                                            \
+            goto abort;                                                     \
+        }                                                                   \
+    } while(0)
+
 /* Analyze marks (build ctx->marks). */
 static int
 md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table_mode)
@@ -4111,9 +4306,11 @@ md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table
 
     /* Collect all marks. */
     MD_CHECK(md_collect_marks(ctx, lines, n_lines, table_mode));
+    MD_WORK(n_lines + ctx->n_marks);
 
     /* (1) Links. */
     md_analyze_marks(ctx, lines, n_lines, 0, ctx->n_marks, _T("[]!"), 0);
+    MD_CHECK_WORK();
     MD_CHECK(md_resolve_links(ctx, lines, n_lines));
     BRACKET_OPENERS.top = -1;
     ctx->unresolved_link_head = -1;
@@ -4124,11 +4321,13 @@ md_analyze_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines, int table
         MD_ASSERT(n_lines == 1);
         ctx->n_table_cell_boundaries = 0;
         md_analyze_marks(ctx, lines, n_lines, 0, ctx->n_marks, _T("|"), 0);
+        MD_CHECK_WORK();
         return ret;
     }
 
     /* (3) Emphasis and strong emphasis; permissive autolinks. */
     md_analyze_link_contents(ctx, lines, n_lines, 0, ctx->n_marks);
+    MD_CHECK_WORK();
 
 abort:
     return ret;
@@ -4143,7 +4342,7 @@ md_analyze_link_contents(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines,
     md_analyze_marks(ctx, lines, n_lines, mark_beg, mark_end, _T("&"), 0);
     md_analyze_marks(ctx, lines, n_lines, mark_beg, mark_end, _T("*_~$"), 0);
 
-    if((ctx->parser.flags & MD_FLAG_PERMISSIVEAUTOLINKS) != 0) {
+    if((MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEAUTOLINKS) != 0) {
         /* These have to be processed last, as they may be greedy and expand
          * from their original mark. Also their implementation must be careful
          * not to cross any (previously) resolved marks when doing so. */
@@ -4261,7 +4460,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
                     break;
 
                 case '_':       /* Underline (or emphasis if we fall through). */
-                    if(ctx->parser.flags & MD_FLAG_UNDERLINE) {
+                    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_UNDERLINE) {
                         if(mark->flags & MD_MARK_OPENER) {
                             while(off < mark->end) {
                                 MD_ENTER_SPAN(MD_SPAN_U, NULL);
@@ -4349,11 +4548,19 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
                     title_mark = opener+2;
                     MD_ASSERT(title_mark->ch == 'D');
 
-                    MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
-                                (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A),
-                                STR(dest_mark->beg), dest_mark->end - dest_mark->beg, FALSE,
-                                md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
-								title_mark->prev));
+                    if(dest_mark->flags & MD_MARK_EXTERNALDEST) {
+                        MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
+                                    (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A),
+                                    md_mark_get_ptr(ctx, (int)(dest_mark - ctx->marks)), dest_mark->prev, FALSE,
+                                    md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
+                                    title_mark->prev));
+                    } else {
+                        MD_CHECK(md_enter_leave_span_a(ctx, (mark->ch != ']'),
+                                    (opener->ch == '!' ? MD_SPAN_IMG : MD_SPAN_A),
+                                    STR(dest_mark->beg), dest_mark->end - dest_mark->beg, FALSE,
+                                    md_mark_get_ptr(ctx, (int)(title_mark - ctx->marks)),
+                                    title_mark->prev));
+                    }
 
                     /* link/image closer may span multiple lines. */
                     if(mark->ch == ']') {
@@ -4470,7 +4677,7 @@ md_process_inlines(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_lines)
                 MD_TEXTTYPE break_type = MD_TEXT_SOFTBR;
 
                 if(text_type == MD_TEXT_NORMAL) {
-                    if(enforce_hardbreak  ||  (ctx->parser.flags & MD_FLAG_HARD_SOFT_BREAKS)) {
+                    if(enforce_hardbreak  ||  (MD_PARSER_FLAGS(ctx) & MD_FLAG_HARD_SOFT_BREAKS)) {
                         break_type = MD_TEXT_BR;
                     } else {
                         while(off < ctx->size  &&  ISBLANK(off))
@@ -4673,6 +4880,9 @@ struct MD_BLOCK_tag {
      * MD_BLOCK_OL:     Start item number.
      */
     MD_SIZE n_lines;
+
+    /* Offset of the start of the source line where the block begins. */
+    OFF beg;
 };
 
 struct MD_CONTAINER_tag {
@@ -4693,8 +4903,23 @@ md_process_normal_block_contents(MD_CTX* ctx, const MD_LINE* lines, MD_SIZE n_li
     int i;
     int ret;
 
-    MD_CHECK(md_analyze_inlines(ctx, lines, n_lines, FALSE));
-    MD_CHECK(md_process_inlines(ctx, lines, n_lines));
+    if(MD_PARSER_FLAGS(ctx) & MD_FLAG_NOINLINES) {
+        /* MD_LINE and MD_LINE_RANGE share their layout. */
+        if(ctx->parser.raw_inlines != NULL)
+            return ctx->parser.raw_inlines((const MD_LINE_RANGE*) lines, n_lines, ctx->userdata);
+        return 0;
+    }
+
+    MD_TRACE_BEGIN("analyze inlines", n_lines > 0 ? lines[0].beg : 0);
+    ret = md_analyze_inlines(ctx, lines, n_lines, FALSE);
+    MD_TRACE_END();
+    if(ret < 0)
+        goto abort;
+
+    /* Emitting the inline events is where the application builds its tree. */
+    MD_TRACE_BEGIN("emit inlines", n_lines > 0 ? lines[0].beg : 0);
+    ret = md_process_inlines(ctx, lines, n_lines);
+    MD_TRACE_END();
 
 abort:
     /* Free any temporary memory blocks stored within some dummy marks. */
@@ -4801,6 +5026,21 @@ abort:
     return ret;
 }
 
+#ifdef MD4C_TRACE_HOOKS
+static const char*
+md_leaf_block_trace_name(MD_BLOCKTYPE type)
+{
+    switch(type) {
+        case MD_BLOCK_H:        return "leaf block: h";
+        case MD_BLOCK_CODE:     return "leaf block: code";
+        case MD_BLOCK_HTML:     return "leaf block: html";
+        case MD_BLOCK_TABLE:    return "leaf block: table";
+        case MD_BLOCK_HR:       return "leaf block: hr";
+        default:                return "leaf block: p";
+    }
+}
+#endif
+
 static int
 md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
 {
@@ -4815,6 +5055,7 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
     int clean_fence_code_detail = FALSE;
     int ret = 0;
 
+    MD_TRACE_BEGIN(md_leaf_block_trace_name(block->type), block->beg);
     memset(&det, 0, sizeof(det));
 
     if(ctx->n_containers == 0)
@@ -4847,8 +5088,10 @@ md_process_leaf_block(MD_CTX* ctx, const MD_BLOCK* block)
             break;
     }
 
-    if(!is_in_tight_list  ||  block->type != MD_BLOCK_P)
+    if(!is_in_tight_list  ||  block->type != MD_BLOCK_P) {
+        MD_BLOCK_OFFSET(block->type, block->beg);
         MD_ENTER_BLOCK(block->type, (void*) &det);
+    }
 
     /* Process the block contents accordingly to is type. */
     switch(block->type) {
@@ -4885,9 +5128,59 @@ abort:
         md_free_attribute(ctx, &info_build);
         md_free_attribute(ctx, &lang_build);
     }
+    MD_TRACE_END();
     return ret;
 }
 
+static int
+md_block_record_size(const MD_BLOCK* block)
+{
+    if(block->flags & MD_BLOCK_CONTAINER)
+        return sizeof(MD_BLOCK);
+    if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
+        return sizeof(MD_BLOCK) + block->n_lines * sizeof(MD_VERBATIMLINE);
+    return sizeof(MD_BLOCK) + block->n_lines * sizeof(MD_LINE);
+}
+
+/* For the top-level block at 'byte_off', finds the offset of the record
+ * following it and where the next top-level block begins. Returns FALSE if
+ * the block cannot be skipped as a whole, i.e. its closer also opens the
+ * next block. */
+static int
+md_top_level_block_extent(MD_CTX* ctx, int byte_off, int* p_next_off, OFF* p_end)
+{
+    const MD_BLOCK* block = (const MD_BLOCK*)((const char*)ctx->block_bytes + byte_off);
+    int depth = (block->flags & MD_BLOCK_CONTAINER) ? 1 : 0;
+
+    byte_off += md_block_record_size(block);
+    while(depth > 0  &&  byte_off < ctx->n_block_bytes) {
+        block = (const MD_BLOCK*)((const char*)ctx->block_bytes + byte_off);
+        if(block->flags & MD_BLOCK_CONTAINER_CLOSER) {
+            depth--;
+            if(depth == 0  &&  (block->flags & MD_BLOCK_CONTAINER_OPENER))
+                return FALSE;
+        }
+        /* Also a closer for the next list item. */
+        if(block->flags & MD_BLOCK_CONTAINER_OPENER)
+            depth++;
+        byte_off += md_block_record_size(block);
+    }
+
+    *p_next_off = byte_off;
+    *p_end = ctx->size;
+    /* Container closers carry no source; the next block that opens is the
+     * next top-level one. */
+    while(byte_off < ctx->n_block_bytes) {
+        block = (const MD_BLOCK*)((const char*)ctx->block_bytes + byte_off);
+        if(!(block->flags & MD_BLOCK_CONTAINER)  ||  (block->flags & MD_BLOCK_CONTAINER_OPENER)) {
+            *p_end = block->beg;
+            break;
+        }
+        byte_off += md_block_record_size(block);
+    }
+    return TRUE;
+}
+
 static int
 md_process_all_blocks(MD_CTX* ctx)
 {
@@ -4908,6 +5201,20 @@ md_process_all_blocks(MD_CTX* ctx)
             MD_BLOCK_LI_DETAIL li;
         } det;
 
+        if(ctx->parser.skip_block != NULL  &&  ctx->n_containers == 0  &&
+           !(block->flags & MD_BLOCK_CONTAINER_CLOSER))
+        {
+            int next_off;
+            OFF end;
+
+            if(md_top_level_block_extent(ctx, byte_off, &next_off, &end)  &&
+               ctx->parser.skip_block(block->type, block->beg, end, ctx->userdata))
+            {
+                byte_off = next_off;
+                continue;
+            }
+        }
+
         switch(block->type) {
             case MD_BLOCK_UL:
                 det.ul.is_tight = (block->flags & MD_BLOCK_LOOSE_LIST) ? FALSE : TRUE;
@@ -4940,6 +5247,7 @@ md_process_all_blocks(MD_CTX* ctx)
             }
 
             if(block->flags & MD_BLOCK_CONTAINER_OPENER) {
+                MD_BLOCK_OFFSET(block->type, block->beg);
                 MD_ENTER_BLOCK(block->type, &det);
 
                 if(block->type == MD_BLOCK_UL || block->type == MD_BLOCK_OL) {
@@ -4954,6 +5262,7 @@ md_process_all_blocks(MD_CTX* ctx)
                 }
             }
         } else {
+            MD_WORK(1);
             MD_CHECK(md_process_leaf_block(ctx, block));
 
             if(block->type == MD_BLOCK_CODE || block->type == MD_BLOCK_HTML)
@@ -5007,6 +5316,19 @@ md_push_block_bytes(MD_CTX* ctx, int n_bytes)
     return ptr;
 }
 
+/* Returns the block header which is the very last thing in ctx->block_bytes,
+ * or NULL if any lines follow it. (The bytes at the end of the buffer are
+ * not necessarily a header, so they must not be reinterpreted as one.) */
+static MD_BLOCK*
+md_top_block(MD_CTX* ctx)
+{
+    if(ctx->last_block_byte_off < 0  ||
+       ctx->last_block_byte_off + (int) sizeof(MD_BLOCK) != ctx->n_block_bytes)
+        return NULL;
+
+    return (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->last_block_byte_off);
+}
+
 static int
 md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
 {
@@ -5052,6 +5374,8 @@ md_start_new_block(MD_CTX* ctx, const MD_LINE_ANALYSIS* line)
     block->flags = 0;
     block->data = line->data;
     block->n_lines = 0;
+    block->beg = ctx->line_beg;
+    ctx->last_block_byte_off = (int) ((char*) block - (char*) ctx->block_bytes);
 
     ctx->current_block = block;
     return 0;
@@ -5097,6 +5421,7 @@ md_consume_link_reference_definitions(MD_CTX* ctx)
             ctx->n_block_bytes -= n * sizeof(MD_LINE);
             ctx->n_block_bytes -= sizeof(MD_BLOCK);
             ctx->current_block = NULL;
+            ctx->last_block_byte_off = -1;
         } else {
             /* Remove just some initial lines from the block. */
             memmove(lines, lines + n, (n_lines - n) * sizeof(MD_LINE));
@@ -5199,6 +5524,8 @@ md_push_container_bytes(MD_CTX* ctx, MD_BLOCKTYPE type, unsigned start,
     block->flags = flags;
     block->data = data;
     block->n_lines = start;
+    block->beg = ctx->line_beg;
+    ctx->last_block_byte_off = (int) ((char*) block - (char*) ctx->block_bytes);
 
 abort:
     return ret;
@@ -5251,7 +5578,7 @@ md_is_atxheader_line(MD_CTX* ctx, OFF beg, OFF* p_beg, OFF* p_end, unsigned* p_l
         return FALSE;
     *p_level = n;
 
-    if(!(ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS)  &&  off < ctx->size  &&
+    if(!(MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEATXHEADERS)  &&  off < ctx->size  &&
        !ISBLANK(off)  &&  !ISNEWLINE(off))
         return FALSE;
 
@@ -5832,6 +6159,7 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
     OFF hr_killer = 0;
     int ret = 0;
 
+    ctx->line_beg = beg;
     line->indent = md_line_indentation(ctx, total_indent, off, &off);
     total_indent += line->indent;
     line->beg = off;
@@ -5867,6 +6195,8 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
         n_parents++;
     }
 
+    MD_WORK(1 + n_parents);
+
     if(off >= ctx->size  ||  ISNEWLINE(off)) {
         /* Blank line does not need any real indentation to be nested inside
          * a list. */
@@ -5961,11 +6291,10 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
                  * item can begin with at most one blank line."
                  */
                 if(n_parents > 0  &&  ctx->containers[n_parents-1].ch != _T('>')  &&
-                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
+                   n_brothers + n_children == 0  &&  ctx->current_block == NULL)
                 {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI)
+                    MD_BLOCK* top_block = md_top_block(ctx);
+                    if(top_block != NULL  &&  top_block->type == MD_BLOCK_LI)
                         ctx->last_list_item_starts_with_two_blank_lines = TRUE;
                 }
     #endif
@@ -5980,11 +6309,10 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
             if(ctx->last_list_item_starts_with_two_blank_lines) {
                 if(n_parents > 0  &&  n_parents == ctx->n_containers  &&
                    ctx->containers[n_parents-1].ch != _T('>')  &&
-                   n_brothers + n_children == 0  &&  ctx->current_block == NULL  &&
-                   ctx->n_block_bytes > (int) sizeof(MD_BLOCK))
+                   n_brothers + n_children == 0  &&  ctx->current_block == NULL)
                 {
-                    MD_BLOCK* top_block = (MD_BLOCK*) ((char*)ctx->block_bytes + ctx->n_block_bytes - sizeof(MD_BLOCK));
-                    if(top_block->type == MD_BLOCK_LI) {
+                    MD_BLOCK* top_block = md_top_block(ctx);
+                    if(top_block != NULL  &&  top_block->type == MD_BLOCK_LI) {
                         n_parents--;
 
                         line->indent = total_indent;
@@ -6145,7 +6473,7 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
 
         /* Check for start of raw HTML block. */
         if(off < ctx->size  &&  CH(off) == _T('<')
-            &&  !(ctx->parser.flags & MD_FLAG_NOHTMLBLOCKS))
+            &&  !(MD_PARSER_FLAGS(ctx) & MD_FLAG_NOHTMLBLOCKS))
         {
             ctx->html_block_type = md_is_html_block_start_condition(ctx, off);
 
@@ -6167,7 +6495,7 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
         }
 
         /* Check for table underline. */
-        if((ctx->parser.flags & MD_FLAG_TABLES)  &&  pivot_line->type == MD_LINE_TEXT
+        if((MD_PARSER_FLAGS(ctx) & MD_FLAG_TABLES)  &&  pivot_line->type == MD_LINE_TEXT
             &&  off < ctx->size  &&  ISANYOF3(off, _T('|'), _T('-'), _T(':'))
             &&  n_parents == ctx->n_containers)
         {
@@ -6190,7 +6518,7 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
         }
 
         /* Check for task mark. */
-        if((ctx->parser.flags & MD_FLAG_TASKLISTS)  &&  n_brothers + n_children > 0  &&
+        if((MD_PARSER_FLAGS(ctx) & MD_FLAG_TASKLISTS)  &&  n_brothers + n_children > 0  &&
            ISANYOF_(ctx->containers[ctx->n_containers-1].ch, _T("-+*.)")))
         {
             OFF tmp = off;
@@ -6254,7 +6582,7 @@ md_analyze_line(MD_CTX* ctx, OFF beg, OFF* p_end,
             tmp--;
         while(tmp > line->beg && CH(tmp-1) == _T('#'))
             tmp--;
-        if(tmp == line->beg || ISBLANK(tmp-1) || (ctx->parser.flags & MD_FLAG_PERMISSIVEATXHEADERS))
+        if(tmp == line->beg || ISBLANK(tmp-1) || (MD_PARSER_FLAGS(ctx) & MD_FLAG_PERMISSIVEATXHEADERS))
             line->end = tmp;
     }
 
@@ -6394,6 +6722,7 @@ md_process_doc(MD_CTX *ctx)
 
     MD_ENTER_BLOCK(MD_BLOCK_DOC, NULL);
 
+    MD_TRACE_BEGIN("analyze blocks", 0);
     while(off < ctx->size) {
         if(line == pivot_line)
             line = (line == &line_buf[0] ? &line_buf[1] : &line_buf[0]);
@@ -6405,6 +6734,8 @@ md_process_doc(MD_CTX *ctx)
     md_end_current_block(ctx);
 
     MD_CHECK(md_build_ref_def_hashtable(ctx));
+    MD_CHECK(md_report_ref_defs(ctx));
+    MD_TRACE_END();
 
     /* Process all blocks. */
     MD_CHECK(md_leave_child_containers(ctx, 0));
@@ -6444,11 +6775,48 @@ abort:
  ***  Public API  ***
  ********************/
 
+static void
+md_setup_ctx(MD_CTX* ctx, const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
+{
+    int i;
+
+    /* Setup context structure. */
+    memset(ctx, 0, sizeof(MD_CTX));
+    ctx->text = text;
+    ctx->size = size;
+    memcpy(&ctx->parser, parser, sizeof(MD_PARSER));
+    ctx->userdata = userdata;
+    ctx->code_indent_offset = (MD_PARSER_FLAGS(ctx) & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
+    md_build_mark_char_map(ctx);
+    ctx->doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
+    ctx->max_ref_def_output = MIN(MIN(16 * (uint64_t)size, (uint64_t)(1024 * 1024)), (uint64_t)SZ_MAX);
+
+    /* Reset all mark stacks and lists. */
+    for(i = 0; i < (int) SIZEOF_ARRAY(ctx->opener_stacks); i++)
+        ctx->opener_stacks[i].top = -1;
+    ctx->ptr_stack.top = -1;
+    ctx->unresolved_link_head = -1;
+    ctx->unresolved_link_tail = -1;
+    ctx->table_cell_boundaries_head = -1;
+    ctx->table_cell_boundaries_tail = -1;
+    ctx->last_block_byte_off = -1;
+}
+
+static void
+md_cleanup_ctx(MD_CTX* ctx)
+{
+    md_free_ref_defs(ctx);
+    md_free_ref_def_hashtable(ctx);
+    free(ctx->buffer);
+    free(ctx->marks);
+    free(ctx->block_bytes);
+    free(ctx->containers);
+}
+
 int
 md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata)
 {
     MD_CTX ctx;
-    int i;
     int ret;
 
     if(parser->abi_version != 0) {
@@ -6457,36 +6825,75 @@ md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userd
         return -1;
     }
 
-    /* Setup context structure. */
-    memset(&ctx, 0, sizeof(MD_CTX));
-    ctx.text = text;
-    ctx.size = size;
-    memcpy(&ctx.parser, parser, sizeof(MD_PARSER));
-    ctx.userdata = userdata;
-    ctx.code_indent_offset = (ctx.parser.flags & MD_FLAG_NOINDENTEDCODEBLOCKS) ? (OFF)(-1) : 4;
-    md_build_mark_char_map(&ctx);
-    ctx.doc_ends_with_newline = (size > 0  &&  ISNEWLINE_(text[size-1]));
-    ctx.max_ref_def_output = MIN(MIN(16 * (uint64_t)size, (uint64_t)(1024 * 1024)), (uint64_t)SZ_MAX);
+#ifdef MD4C_FIXED_FLAGS
+    if(parser->flags != (unsigned) (MD4C_FIXED_FLAGS)) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Flags do not match this specialized build.", userdata);
+        return -1;
+    }
+#endif
 
-    /* Reset all mark stacks and lists. */
-    for(i = 0; i < (int) SIZEOF_ARRAY(ctx.opener_stacks); i++)
-        ctx.opener_stacks[i].top = -1;
-    ctx.ptr_stack.top = -1;
-    ctx.unresolved_link_head = -1;
-    ctx.unresolved_link_tail = -1;
-    ctx.table_cell_boundaries_head = -1;
-    ctx.table_cell_boundaries_tail = -1;
+    md_setup_ctx(&ctx, text, size, parser, userdata);
 
     /* All the work. */
     ret = md_process_doc(&ctx);
+    if(ret == 0  &&  ctx.parser.work != NULL)
+        ctx.parser.work(ctx.work, userdata);
+
+    md_cleanup_ctx(&ctx);
+    return ret;
+}
 
-    /* Clean-up. */
-    md_free_ref_defs(&ctx);
-    md_free_ref_def_hashtable(&ctx);
-    free(ctx.buffer);
-    free(ctx.marks);
-    free(ctx.block_bytes);
-    free(ctx.containers);
+#ifndef MD4C_FIXED_FLAGS
 
+int
+md_parse_inlines(const MD_CHAR* text, MD_SIZE size, const MD_LINE_RANGE* lines, MD_SIZE n_lines,
+                 const MD_PARSER* parser, void* userdata)
+{
+    MD_CTX ctx;
+    MD_SIZE i;
+    int ret;
+
+    if(parser->abi_version != 0) {
+        if(parser->debug_log != NULL)
+            parser->debug_log("Unsupported abi_version.", userdata);
+        return -1;
+    }
+
+    for(i = 0; i < n_lines; i++) {
+        if(lines[i].beg > lines[i].end  ||  lines[i].end > size  ||
+           (i > 0  &&  lines[i].beg < lines[i-1].end))
+        {
+            if(parser->debug_log != NULL)
+                parser->debug_log("Invalid line ranges.", userdata);
+            return -1;
+        }
+    }
+
+    md_setup_ctx(&ctx, text, size, parser, userdata);
+    ctx.parser.flags &= ~MD_FLAG_NOINLINES;
+
+    if(n_lines > 0)
+        ret = md_process_normal_block_contents(&ctx, (const MD_LINE*) lines, n_lines);
+    else
+        ret = 0;
+    if(ret == 0  &&  ctx.parser.work != NULL)
+        ctx.parser.work(ctx.work, userdata);
+
+    md_cleanup_ctx(&ctx);
     return ret;
 }
+
+unsigned
+md_ref_label_hash(const MD_CHAR* label, MD_SIZE size)
+{
+    return md_link_label_hash(label, size);
+}
+
+int
+md_ref_label_equal(const MD_CHAR* a, MD_SIZE a_size, const MD_CHAR* b, MD_SIZE b_size)
+{
+    return (md_link_label_cmp(a, a_size, b, b_size) == 0);
+}
+
+#endif  /* MD4C_FIXED_FLAGS */
@@ -298,6 +298,31 @@ typedef struct MD_SPAN_WIKILINK {
     MD_ATTRIBUTE target;
 } MD_SPAN_WIKILINK_DETAIL;
 
+/* Link reference definition, as reported by MD_PARSER::ref_def() and as
+ * provided by MD_PARSER::lookup_ref_def().
+ *
+ * All strings are raw (not yet unescaped) as they appear in the source.
+ * Strings passed to ref_def() are only valid during the callback. Strings
+ * provided by lookup_ref_def() must stay valid until md_parse() returns.
+ */
+typedef struct MD_REF_DEF_DETAIL {
+    const MD_CHAR* label;
+    MD_SIZE label_size;
+    const MD_CHAR* dest;
+    MD_SIZE dest_size;
+    const MD_CHAR* title;
+    MD_SIZE title_size;
+} MD_REF_DEF_DETAIL;
+
+/* Source range of one line of a block's inline contents, as reported by
+ * MD_PARSER::raw_inlines(). Container marks and indentation are excluded,
+ * so the lines of a single block need not be contiguous in the source.
+ */
+typedef struct MD_LINE_RANGE {
+    MD_OFFSET beg;
+    MD_OFFSET end;
+} MD_LINE_RANGE;
+
 /* Flags specifying extensions/deviations from CommonMark specification.
  *
  * By default (when MD_PARSER::flags == 0), we follow CommonMark specification.
@@ -318,6 +343,7 @@ typedef struct MD_SPAN_WIKILINK {
 #define MD_FLAG_WIKILINKS                   0x2000  /* Enable wiki links extension. */
 #define MD_FLAG_UNDERLINE                   0x4000  /* Enable underline extension (and disables '_' for normal emphasis). */
 #define MD_FLAG_HARD_SOFT_BREAKS            0x8000  /* Force all soft breaks to act as hard breaks. */
+#define MD_FLAG_NOINLINES                   0x10000 /* Do not process inline contents; report its lines via MD_PARSER::raw_inlines(). */
 
 #define MD_FLAG_PERMISSIVEAUTOLINKS         (MD_FLAG_PERMISSIVEEMAILAUTOLINKS | MD_FLAG_PERMISSIVEURLAUTOLINKS | MD_FLAG_PERMISSIVEWWWAUTOLINKS)
 #define MD_FLAG_NOHTML                      (MD_FLAG_NOHTMLBLOCKS | MD_FLAG_NOHTMLSPANS)
@@ -380,6 +406,53 @@ typedef struct MD_PARSER {
     /* Reserved. Set to NULL.
      */
     void (*syntax)(void);
+
+    /* Optional (may be NULL). Called right before enter_block() of every
+     * leaf block and every container block opener, with the offset of the
+     * start of the source line where the block begins.
+     */
+    void (*block_offset)(MD_BLOCKTYPE /*type*/, MD_OFFSET /*offset*/, void* /*userdata*/);
+
+    /* Optional (may be NULL). Called for each link reference definition
+     * found in the document, in document order, before any block is
+     * processed.
+     */
+    int (*ref_def)(const MD_REF_DEF_DETAIL* /*def*/, void* /*userdata*/);
+
+    /* Optional (may be NULL). Consulted before the document's own reference
+     * definitions whenever a link label needs to be resolved. Return non-zero
+     * and fill 'def' to resolve the label from an external table, or zero to
+     * fall back to the definitions found in the document.
+     */
+    int (*lookup_ref_def)(const MD_CHAR* /*label*/, MD_SIZE /*label_size*/,
+                          MD_REF_DEF_DETAIL* /*def*/, void* /*userdata*/);
+
+    /* Optional (may be NULL). Called periodically with the amount of work
+     * done so far, in abstract units roughly proportional to the parsing
+     * time (lines and container marks analyzed, inline marks collected and
+     * resolved, links and blocks processed). Returning a negative value
+     * aborts the parsing and md_parse() returns that value.
+     *
+     * It is called once more with the final total when the parsing finishes;
+     * the return value of that last call is ignored.
+     */
+    int (*work)(unsigned long /*units*/, void* /*userdata*/);
+
+    /* Optional (may be NULL). With MD_FLAG_NOINLINES, called instead of the
+     * inline callbacks (enter_span(), text(), ...) for the contents of every
+     * paragraph, heading and table cell, between its enter_block() and
+     * leave_block(). The ranges are only valid during the callback; pass a
+     * copy to md_parse_inlines() to process the contents later.
+     */
+    int (*raw_inlines)(const MD_LINE_RANGE* /*lines*/, MD_SIZE /*n_lines*/, void* /*userdata*/);
+
+    /* Optional (may be NULL). Called for every block at the top level of the
+     * document, before its block_offset(), with its source range: from the
+     * start of its first line to the start of the next top-level block or
+     * the end of the document. Return non-zero to skip the block; then none
+     * of its callbacks are called and its inlines are not analyzed.
+     */
+    int (*skip_block)(MD_BLOCKTYPE /*type*/, MD_OFFSET /*beg*/, MD_OFFSET /*end*/, void* /*userdata*/);
 } MD_PARSER;
 
 
@@ -399,6 +472,39 @@ typedef MD_PARSER MD_RENDERER;
  */
 int md_parse(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
 
+/* Flag sets for which specialized builds of md_parse() exist. */
+#define MD_SPECIALIZED_FLAGS_GFM_MATH       (MD_FLAG_NOHTML | MD_DIALECT_GITHUB | MD_FLAG_LATEXMATHSPANS)
+#define MD_SPECIALIZED_FLAGS_GFM            (MD_FLAG_NOHTML | MD_DIALECT_GITHUB)
+#define MD_SPECIALIZED_FLAGS_COMMONMARK     (MD_FLAG_NOHTML | MD_DIALECT_COMMONMARK)
+
+/* Same as md_parse(), but compiled with the parser flags fixed to one of the
+ * sets above so that disabled extensions cost nothing in the inner loops.
+ * MD_PARSER::flags must be equal to the respective set, otherwise -1 is
+ * returned.
+ */
+int md_parse_gfm_math(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
+int md_parse_gfm(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
+int md_parse_commonmark(const MD_CHAR* text, MD_SIZE size, const MD_PARSER* parser, void* userdata);
+
+/* Process the inline contents of a single block, given the line ranges
+ * MD_PARSER::raw_inlines() reported for it during a MD_FLAG_NOINLINES parse
+ * of the same text. Only span and text callbacks are called. Reference
+ * links resolve only through MD_PARSER::lookup_ref_def().
+ */
+int md_parse_inlines(const MD_CHAR* text, MD_SIZE size, const MD_LINE_RANGE* lines, MD_SIZE n_lines,
+                     const MD_PARSER* parser, void* userdata);
+
+/* Helpers for applications maintaining their own table of link reference
+ * definitions (see MD_PARSER::lookup_ref_def()). Labels are matched the way
+ * the parser matches them, i.e. case-insensitively and with whitespace
+ * collapsed.
+ *
+ * md_ref_label_hash() returns a hash which is equal for all equivalent labels.
+ * md_ref_label_equal() returns non-zero if the two labels are equivalent.
+ */
+unsigned md_ref_label_hash(const MD_CHAR* label, MD_SIZE size);
+int md_ref_label_equal(const MD_CHAR* a, MD_SIZE a_size, const MD_CHAR* b, MD_SIZE b_size);
+
 
 #ifdef __cplusplus
     }  /* extern "C" { */
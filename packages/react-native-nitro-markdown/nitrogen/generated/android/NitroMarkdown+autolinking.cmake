@@ -35,8 +35,9 @@ target_sources(
   # Shared Nitrogen C++ sources
   ../nitrogen/generated/shared/c++/HybridMarkdownParserSpec.cpp
   ../nitrogen/generated/shared/c++/HybridMarkdownSessionSpec.cpp
+  ../nitrogen/generated/shared/c++/HybridMarkdownSessionSnapshotSpec.cpp
   # Android-specific Nitrogen C++ sources
-  ../nitrogen/generated/android/c++/JHybridMarkdownSessionSpec.cpp
+
 )
 
 # From node_modules/react-native/ReactAndroid/cmake-utils/folly-flags.cmake
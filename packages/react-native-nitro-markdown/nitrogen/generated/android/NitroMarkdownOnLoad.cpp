@@ -15,10 +15,8 @@
 #include <fbjni/fbjni.h>
 #include <NitroModules/HybridObjectRegistry.hpp>
 
-#include "JHybridMarkdownSessionSpec.hpp"
-#include "JFunc_void.hpp"
 #include "HybridMarkdownParser.hpp"
-#include <NitroModules/DefaultConstructableObject.hpp>
+#include "HybridMarkdownSession.hpp"
 
 namespace margelo::nitro::Markdown {
 
@@ -29,8 +27,7 @@ int initialize(JavaVM* vm) {
 
   return facebook::jni::initialize(vm, [] {
     // Register native JNI methods
-    margelo::nitro::Markdown::JHybridMarkdownSessionSpec::registerNatives();
-    margelo::nitro::Markdown::JFunc_void_cxx::registerNatives();
+
 
     // Register Nitro Hybrid Objects
     HybridObjectRegistry::registerHybridObjectConstructor(
@@ -45,9 +42,10 @@ int initialize(JavaVM* vm) {
     HybridObjectRegistry::registerHybridObjectConstructor(
       "MarkdownSession",
       []() -> std::shared_ptr<HybridObject> {
-        static DefaultConstructableObject<JHybridMarkdownSessionSpec::javaobject> object("com/margelo/nitro/com/nitromarkdown/HybridMarkdownSession");
-        auto instance = object.create();
-        return instance->cthis()->shared();
+        static_assert(std::is_default_constructible_v<HybridMarkdownSession>,
+                      "The HybridObject \"HybridMarkdownSession\" is not default-constructible! "
+                      "Create a public constructor that takes zero arguments to be able to autolink this HybridObject.");
+        return std::make_shared<HybridMarkdownSession>();
       }
     );
   });
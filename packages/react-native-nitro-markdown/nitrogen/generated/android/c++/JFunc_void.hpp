@@ -1,75 +0,0 @@
-///
-/// JFunc_void.hpp
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-#pragma once
-
-#include <fbjni/fbjni.h>
-#include <functional>
-
-#include <functional>
-#include <NitroModules/JNICallable.hpp>
-
-namespace margelo::nitro::Markdown {
-
-  using namespace facebook;
-
-  /**
-   * Represents the Java/Kotlin callback `() -> Unit`.
-   * This can be passed around between C++ and Java/Kotlin.
-   */
-  struct JFunc_void: public jni::JavaClass<JFunc_void> {
-  public:
-    static auto constexpr kJavaDescriptor = "Lcom/margelo/nitro/com/nitromarkdown/Func_void;";
-
-  public:
-    /**
-     * Invokes the function this `JFunc_void` instance holds through JNI.
-     */
-    void invoke() const {
-      static const auto method = javaClassStatic()->getMethod<void()>("invoke");
-      method(self());
-    }
-  };
-
-  /**
-   * An implementation of Func_void that is backed by a C++ implementation (using `std::function<...>`)
-   */
-  class JFunc_void_cxx final: public jni::HybridClass<JFunc_void_cxx, JFunc_void> {
-  public:
-    static jni::local_ref<JFunc_void::javaobject> fromCpp(const std::function<void()>& func) {
-      return JFunc_void_cxx::newObjectCxxArgs(func);
-    }
-
-  public:
-    /**
-     * Invokes the C++ `std::function<...>` this `JFunc_void_cxx` instance holds.
-     */
-    void invoke_cxx() {
-      _func();
-    }
-
-  public:
-    [[nodiscard]]
-    inline const std::function<void()>& getFunction() const {
-      return _func;
-    }
-
-  public:
-    static auto constexpr kJavaDescriptor = "Lcom/margelo/nitro/com/nitromarkdown/Func_void_cxx;";
-    static void registerNatives() {
-      registerHybrid({makeNativeMethod("invoke_cxx", JFunc_void_cxx::invoke_cxx)});
-    }
-
-  private:
-    explicit JFunc_void_cxx(const std::function<void()>& func): _func(func) { }
-
-  private:
-    friend HybridBase;
-    std::function<void()> _func;
-  };
-
-} // namespace margelo::nitro::Markdown
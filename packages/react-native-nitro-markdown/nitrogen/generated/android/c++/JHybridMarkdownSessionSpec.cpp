@@ -1,91 +0,0 @@
-///
-/// JHybridMarkdownSessionSpec.cpp
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-#include "JHybridMarkdownSessionSpec.hpp"
-
-
-
-#include <string>
-#include <functional>
-#include "JFunc_void.hpp"
-#include <NitroModules/JNICallable.hpp>
-
-namespace margelo::nitro::Markdown {
-
-  jni::local_ref<JHybridMarkdownSessionSpec::jhybriddata> JHybridMarkdownSessionSpec::initHybrid(jni::alias_ref<jhybridobject> jThis) {
-    return makeCxxInstance(jThis);
-  }
-
-  void JHybridMarkdownSessionSpec::registerNatives() {
-    registerHybrid({
-      makeNativeMethod("initHybrid", JHybridMarkdownSessionSpec::initHybrid),
-    });
-  }
-
-  size_t JHybridMarkdownSessionSpec::getExternalMemorySize() noexcept {
-    static const auto method = javaClassStatic()->getMethod<jlong()>("getMemorySize");
-    return method(_javaPart);
-  }
-
-  bool JHybridMarkdownSessionSpec::equals(const std::shared_ptr<HybridObject>& other) {
-    if (auto otherCast = std::dynamic_pointer_cast<JHybridMarkdownSessionSpec>(other)) {
-      return _javaPart == otherCast->_javaPart;
-    }
-    return false;
-  }
-
-  void JHybridMarkdownSessionSpec::dispose() noexcept {
-    static const auto method = javaClassStatic()->getMethod<void()>("dispose");
-    method(_javaPart);
-  }
-
-  std::string JHybridMarkdownSessionSpec::toString() {
-    static const auto method = javaClassStatic()->getMethod<jni::JString()>("toString");
-    auto javaString = method(_javaPart);
-    return javaString->toStdString();
-  }
-
-  // Properties
-  double JHybridMarkdownSessionSpec::getHighlightPosition() {
-    static const auto method = javaClassStatic()->getMethod<double()>("getHighlightPosition");
-    auto __result = method(_javaPart);
-    return __result;
-  }
-  void JHybridMarkdownSessionSpec::setHighlightPosition(double highlightPosition) {
-    static const auto method = javaClassStatic()->getMethod<void(double /* highlightPosition */)>("setHighlightPosition");
-    method(_javaPart, highlightPosition);
-  }
-
-  // Methods
-  void JHybridMarkdownSessionSpec::append(const std::string& chunk) {
-    static const auto method = javaClassStatic()->getMethod<void(jni::alias_ref<jni::JString> /* chunk */)>("append");
-    method(_javaPart, jni::make_jstring(chunk));
-  }
-  void JHybridMarkdownSessionSpec::clear() {
-    static const auto method = javaClassStatic()->getMethod<void()>("clear");
-    method(_javaPart);
-  }
-  std::string JHybridMarkdownSessionSpec::getAllText() {
-    static const auto method = javaClassStatic()->getMethod<jni::local_ref<jni::JString>()>("getAllText");
-    auto __result = method(_javaPart);
-    return __result->toStdString();
-  }
-  std::function<void()> JHybridMarkdownSessionSpec::addListener(const std::function<void()>& listener) {
-    static const auto method = javaClassStatic()->getMethod<jni::local_ref<JFunc_void::javaobject>(jni::alias_ref<JFunc_void::javaobject> /* listener */)>("addListener_cxx");
-    auto __result = method(_javaPart, JFunc_void_cxx::fromCpp(listener));
-    return [&]() -> std::function<void()> {
-      if (__result->isInstanceOf(JFunc_void_cxx::javaClassStatic())) [[likely]] {
-        auto downcast = jni::static_ref_cast<JFunc_void_cxx::javaobject>(__result);
-        return downcast->cthis()->getFunction();
-      } else {
-        auto __resultRef = jni::make_global(__result);
-        return JNICallable<JFunc_void, void()>(std::move(__resultRef));
-      }
-    }();
-  }
-
-} // namespace margelo::nitro::Markdown
@@ -1,70 +0,0 @@
-///
-/// HybridMarkdownSessionSpec.hpp
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-#pragma once
-
-#include <NitroModules/JHybridObject.hpp>
-#include <fbjni/fbjni.h>
-#include "HybridMarkdownSessionSpec.hpp"
-
-
-
-
-namespace margelo::nitro::Markdown {
-
-  using namespace facebook;
-
-  class JHybridMarkdownSessionSpec: public jni::HybridClass<JHybridMarkdownSessionSpec, JHybridObject>,
-                                    public virtual HybridMarkdownSessionSpec {
-  public:
-    static auto constexpr kJavaDescriptor = "Lcom/margelo/nitro/com/nitromarkdown/HybridMarkdownSessionSpec;";
-    static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jhybridobject> jThis);
-    static void registerNatives();
-
-  protected:
-    // C++ constructor (called from Java via `initHybrid()`)
-    explicit JHybridMarkdownSessionSpec(jni::alias_ref<jhybridobject> jThis) :
-      HybridObject(HybridMarkdownSessionSpec::TAG),
-      HybridBase(jThis),
-      _javaPart(jni::make_global(jThis)) {}
-
-  public:
-    ~JHybridMarkdownSessionSpec() override {
-      // Hermes GC can destroy JS objects on a non-JNI Thread.
-      jni::ThreadScope::WithClassLoader([&] { _javaPart.reset(); });
-    }
-
-  public:
-    size_t getExternalMemorySize() noexcept override;
-    bool equals(const std::shared_ptr<HybridObject>& other) override;
-    void dispose() noexcept override;
-    std::string toString() override;
-
-  public:
-    inline const jni::global_ref<JHybridMarkdownSessionSpec::javaobject>& getJavaPart() const noexcept {
-      return _javaPart;
-    }
-
-  public:
-    // Properties
-    double getHighlightPosition() override;
-    void setHighlightPosition(double highlightPosition) override;
-
-  public:
-    // Methods
-    void append(const std::string& chunk) override;
-    void clear() override;
-    std::string getAllText() override;
-    std::function<void()> addListener(const std::function<void()>& listener) override;
-
-  private:
-    friend HybridBase;
-    using HybridBase::HybridBase;
-    jni::global_ref<JHybridMarkdownSessionSpec::javaobject> _javaPart;
-  };
-
-} // namespace margelo::nitro::Markdown
@@ -1,78 +0,0 @@
-///
-/// HybridMarkdownSessionSpec.kt
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-package com.margelo.nitro.com.nitromarkdown
-
-import androidx.annotation.Keep
-import com.facebook.jni.HybridData
-import com.facebook.proguard.annotations.DoNotStrip
-import com.margelo.nitro.core.HybridObject
-
-/**
- * A Kotlin class representing the MarkdownSession HybridObject.
- * Implement this abstract class to create Kotlin-based instances of MarkdownSession.
- */
-@DoNotStrip
-@Keep
-@Suppress(
-  "KotlinJniMissingFunction", "unused",
-  "RedundantSuppression", "RedundantUnitReturnType", "SimpleRedundantLet",
-  "LocalVariableName", "PropertyName", "PrivatePropertyName", "FunctionName"
-)
-abstract class HybridMarkdownSessionSpec: HybridObject() {
-  @DoNotStrip
-  private var mHybridData: HybridData = initHybrid()
-
-  init {
-    super.updateNative(mHybridData)
-  }
-
-  override fun updateNative(hybridData: HybridData) {
-    mHybridData = hybridData
-    super.updateNative(hybridData)
-  }
-
-  // Default implementation of `HybridObject.toString()`
-  override fun toString(): String {
-    return "[HybridObject MarkdownSession]"
-  }
-
-  // Properties
-  @get:DoNotStrip
-  @get:Keep
-  @set:DoNotStrip
-  @set:Keep
-  abstract var highlightPosition: Double
-
-  // Methods
-  @DoNotStrip
-  @Keep
-  abstract fun append(chunk: String): Unit
-  
-  @DoNotStrip
-  @Keep
-  abstract fun clear(): Unit
-  
-  @DoNotStrip
-  @Keep
-  abstract fun getAllText(): String
-  
-  abstract fun addListener(listener: () -> Unit): () -> Unit
-  
-  @DoNotStrip
-  @Keep
-  private fun addListener_cxx(listener: Func_void): Func_void {
-    val __result = addListener(listener)
-    return Func_void_java(__result)
-  }
-
-  private external fun initHybrid(): HybridData
-
-  companion object {
-    protected const val TAG = "HybridMarkdownSessionSpec"
-  }
-}
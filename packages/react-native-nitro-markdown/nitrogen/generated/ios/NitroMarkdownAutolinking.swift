@@ -7,19 +7,4 @@
 
 public final class NitroMarkdownAutolinking {
   public typealias bridge = margelo.nitro.Markdown.bridge.swift
-
-  /**
-   * Creates an instance of a Swift class that implements `HybridMarkdownSessionSpec`,
-   * and wraps it in a Swift class that can directly interop with C++ (`HybridMarkdownSessionSpec_cxx`)
-   *
-   * This is generated by Nitrogen and will initialize the class specified
-   * in the `"autolinking"` property of `nitro.json` (in this case, `HybridMarkdownSession`).
-   */
-  public static func createMarkdownSession() -> bridge.std__shared_ptr_HybridMarkdownSessionSpec_ {
-    let hybridObject = HybridMarkdownSession()
-    return { () -> bridge.std__shared_ptr_HybridMarkdownSessionSpec_ in
-      let __cxxWrapped = hybridObject.getCxxWrapper()
-      return __cxxWrapped.getCxxPart()
-    }()
-  }
 }
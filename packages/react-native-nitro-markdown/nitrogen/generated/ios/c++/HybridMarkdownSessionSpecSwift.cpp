@@ -1,11 +0,0 @@
-///
-/// HybridMarkdownSessionSpecSwift.cpp
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-#include "HybridMarkdownSessionSpecSwift.hpp"
-
-namespace margelo::nitro::Markdown {
-} // namespace margelo::nitro::Markdown
@@ -1,108 +0,0 @@
-///
-/// HybridMarkdownSessionSpecSwift.hpp
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-#pragma once
-
-#include "HybridMarkdownSessionSpec.hpp"
-
-// Forward declaration of `HybridMarkdownSessionSpec_cxx` to properly resolve imports.
-namespace NitroMarkdown { class HybridMarkdownSessionSpec_cxx; }
-
-
-
-#include <string>
-#include <functional>
-
-#include "NitroMarkdown-Swift-Cxx-Umbrella.hpp"
-
-namespace margelo::nitro::Markdown {
-
-  /**
-   * The C++ part of HybridMarkdownSessionSpec_cxx.swift.
-   *
-   * HybridMarkdownSessionSpecSwift (C++) accesses HybridMarkdownSessionSpec_cxx (Swift), and might
-   * contain some additional bridging code for C++ <> Swift interop.
-   *
-   * Since this obviously introduces an overhead, I hope at some point in
-   * the future, HybridMarkdownSessionSpec_cxx can directly inherit from the C++ class HybridMarkdownSessionSpec
-   * to simplify the whole structure and memory management.
-   */
-  class HybridMarkdownSessionSpecSwift: public virtual HybridMarkdownSessionSpec {
-  public:
-    // Constructor from a Swift instance
-    explicit HybridMarkdownSessionSpecSwift(const NitroMarkdown::HybridMarkdownSessionSpec_cxx& swiftPart):
-      HybridObject(HybridMarkdownSessionSpec::TAG),
-      _swiftPart(swiftPart) { }
-
-  public:
-    // Get the Swift part
-    inline NitroMarkdown::HybridMarkdownSessionSpec_cxx& getSwiftPart() noexcept {
-      return _swiftPart;
-    }
-
-  public:
-    inline size_t getExternalMemorySize() noexcept override {
-      return _swiftPart.getMemorySize();
-    }
-    bool equals(const std::shared_ptr<HybridObject>& other) override {
-      if (auto otherCast = std::dynamic_pointer_cast<HybridMarkdownSessionSpecSwift>(other)) {
-        return _swiftPart.equals(otherCast->_swiftPart);
-      }
-      return false;
-    }
-    void dispose() noexcept override {
-      _swiftPart.dispose();
-    }
-    std::string toString() override {
-      return _swiftPart.toString();
-    }
-
-  public:
-    // Properties
-    inline double getHighlightPosition() noexcept override {
-      return _swiftPart.getHighlightPosition();
-    }
-    inline void setHighlightPosition(double highlightPosition) noexcept override {
-      _swiftPart.setHighlightPosition(std::forward<decltype(highlightPosition)>(highlightPosition));
-    }
-
-  public:
-    // Methods
-    inline void append(const std::string& chunk) override {
-      auto __result = _swiftPart.append(chunk);
-      if (__result.hasError()) [[unlikely]] {
-        std::rethrow_exception(__result.error());
-      }
-    }
-    inline void clear() override {
-      auto __result = _swiftPart.clear();
-      if (__result.hasError()) [[unlikely]] {
-        std::rethrow_exception(__result.error());
-      }
-    }
-    inline std::string getAllText() override {
-      auto __result = _swiftPart.getAllText();
-      if (__result.hasError()) [[unlikely]] {
-        std::rethrow_exception(__result.error());
-      }
-      auto __value = std::move(__result.value());
-      return __value;
-    }
-    inline std::function<void()> addListener(const std::function<void()>& listener) override {
-      auto __result = _swiftPart.addListener(listener);
-      if (__result.hasError()) [[unlikely]] {
-        std::rethrow_exception(__result.error());
-      }
-      auto __value = std::move(__result.value());
-      return __value;
-    }
-
-  private:
-    NitroMarkdown::HybridMarkdownSessionSpec_cxx _swiftPart;
-  };
-
-} // namespace margelo::nitro::Markdown
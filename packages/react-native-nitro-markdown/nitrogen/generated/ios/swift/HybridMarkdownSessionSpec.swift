@@ -1,59 +0,0 @@
-///
-/// HybridMarkdownSessionSpec.swift
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-import Foundation
-import NitroModules
-
-/// See ``HybridMarkdownSessionSpec``
-public protocol HybridMarkdownSessionSpec_protocol: HybridObject {
-  // Properties
-  var highlightPosition: Double { get set }
-
-  // Methods
-  func append(chunk: String) throws -> Void
-  func clear() throws -> Void
-  func getAllText() throws -> String
-  func addListener(listener: @escaping () -> Void) throws -> () -> Void
-}
-
-public extension HybridMarkdownSessionSpec_protocol {
-  /// Default implementation of ``HybridObject.toString``
-  func toString() -> String {
-    return "[HybridObject MarkdownSession]"
-  }
-}
-
-/// See ``HybridMarkdownSessionSpec``
-open class HybridMarkdownSessionSpec_base {
-  private weak var cxxWrapper: HybridMarkdownSessionSpec_cxx? = nil
-  public init() { }
-  public func getCxxWrapper() -> HybridMarkdownSessionSpec_cxx {
-  #if DEBUG
-    guard self is HybridMarkdownSessionSpec else {
-      fatalError("`self` is not a `HybridMarkdownSessionSpec`! Did you accidentally inherit from `HybridMarkdownSessionSpec_base` instead of `HybridMarkdownSessionSpec`?")
-    }
-  #endif
-    if let cxxWrapper = self.cxxWrapper {
-      return cxxWrapper
-    } else {
-      let cxxWrapper = HybridMarkdownSessionSpec_cxx(self as! HybridMarkdownSessionSpec)
-      self.cxxWrapper = cxxWrapper
-      return cxxWrapper
-    }
-  }
-}
-
-/**
- * A Swift base-protocol representing the MarkdownSession HybridObject.
- * Implement this protocol to create Swift-based instances of MarkdownSession.
- * ```swift
- * class HybridMarkdownSession : HybridMarkdownSessionSpec {
- *   // ...
- * }
- * ```
- */
-public typealias HybridMarkdownSessionSpec = HybridMarkdownSessionSpec_protocol & HybridMarkdownSessionSpec_base
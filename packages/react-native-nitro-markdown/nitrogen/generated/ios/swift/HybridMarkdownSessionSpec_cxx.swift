@@ -1,190 +0,0 @@
-///
-/// HybridMarkdownSessionSpec_cxx.swift
-/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
-/// https://github.com/mrousavy/nitro
-/// Copyright © Marc Rousavy @ Margelo
-///
-
-import Foundation
-import NitroModules
-
-/**
- * A class implementation that bridges HybridMarkdownSessionSpec over to C++.
- * In C++, we cannot use Swift protocols - so we need to wrap it in a class to make it strongly defined.
- *
- * Also, some Swift types need to be bridged with special handling:
- * - Enums need to be wrapped in Structs, otherwise they cannot be accessed bi-directionally (Swift bug: https://github.com/swiftlang/swift/issues/75330)
- * - Other HybridObjects need to be wrapped/unwrapped from the Swift TCxx wrapper
- * - Throwing methods need to be wrapped with a Result<T, Error> type, as exceptions cannot be propagated to C++
- */
-open class HybridMarkdownSessionSpec_cxx {
-  /**
-   * The Swift <> C++ bridge's namespace (`margelo::nitro::Markdown::bridge::swift`)
-   * from `NitroMarkdown-Swift-Cxx-Bridge.hpp`.
-   * This contains specialized C++ templates, and C++ helper functions that can be accessed from Swift.
-   */
-  public typealias bridge = margelo.nitro.Markdown.bridge.swift
-
-  /**
-   * Holds an instance of the `HybridMarkdownSessionSpec` Swift protocol.
-   */
-  private var __implementation: any HybridMarkdownSessionSpec
-
-  /**
-   * Holds a weak pointer to the C++ class that wraps the Swift class.
-   */
-  private var __cxxPart: bridge.std__weak_ptr_HybridMarkdownSessionSpec_
-
-  /**
-   * Create a new `HybridMarkdownSessionSpec_cxx` that wraps the given `HybridMarkdownSessionSpec`.
-   * All properties and methods bridge to C++ types.
-   */
-  public init(_ implementation: any HybridMarkdownSessionSpec) {
-    self.__implementation = implementation
-    self.__cxxPart = .init()
-    /* no base class */
-  }
-
-  /**
-   * Get the actual `HybridMarkdownSessionSpec` instance this class wraps.
-   */
-  @inline(__always)
-  public func getHybridMarkdownSessionSpec() -> any HybridMarkdownSessionSpec {
-    return __implementation
-  }
-
-  /**
-   * Casts this instance to a retained unsafe raw pointer.
-   * This acquires one additional strong reference on the object!
-   */
-  public func toUnsafe() -> UnsafeMutableRawPointer {
-    return Unmanaged.passRetained(self).toOpaque()
-  }
-
-  /**
-   * Casts an unsafe pointer to a `HybridMarkdownSessionSpec_cxx`.
-   * The pointer has to be a retained opaque `Unmanaged<HybridMarkdownSessionSpec_cxx>`.
-   * This removes one strong reference from the object!
-   */
-  public class func fromUnsafe(_ pointer: UnsafeMutableRawPointer) -> HybridMarkdownSessionSpec_cxx {
-    return Unmanaged<HybridMarkdownSessionSpec_cxx>.fromOpaque(pointer).takeRetainedValue()
-  }
-
-  /**
-   * Gets (or creates) the C++ part of this Hybrid Object.
-   * The C++ part is a `std::shared_ptr<HybridMarkdownSessionSpec>`.
-   */
-  public func getCxxPart() -> bridge.std__shared_ptr_HybridMarkdownSessionSpec_ {
-    let cachedCxxPart = self.__cxxPart.lock()
-    if Bool(fromCxx: cachedCxxPart) {
-      return cachedCxxPart
-    } else {
-      let newCxxPart = bridge.create_std__shared_ptr_HybridMarkdownSessionSpec_(self.toUnsafe())
-      __cxxPart = bridge.weakify_std__shared_ptr_HybridMarkdownSessionSpec_(newCxxPart)
-      return newCxxPart
-    }
-  }
-
-  
-
-  /**
-   * Get the memory size of the Swift class (plus size of any other allocations)
-   * so the JS VM can properly track it and garbage-collect the JS object if needed.
-   */
-  @inline(__always)
-  public var memorySize: Int {
-    return MemoryHelper.getSizeOf(self.__implementation) + self.__implementation.memorySize
-  }
-
-  /**
-   * Compares this object with the given [other] object for reference equality.
-   */
-  @inline(__always)
-  public func equals(other: HybridMarkdownSessionSpec_cxx) -> Bool {
-    return self.__implementation === other.__implementation
-  }
-
-  /**
-   * Call dispose() on the Swift class.
-   * This _may_ be called manually from JS.
-   */
-  @inline(__always)
-  public func dispose() {
-    self.__implementation.dispose()
-  }
-
-  /**
-   * Call toString() on the Swift class.
-   */
-  @inline(__always)
-  public func toString() -> String {
-    return self.__implementation.toString()
-  }
-
-  // Properties
-  public final var highlightPosition: Double {
-    @inline(__always)
-    get {
-      return self.__implementation.highlightPosition
-    }
-    @inline(__always)
-    set {
-      self.__implementation.highlightPosition = newValue
-    }
-  }
-
-  // Methods
-  @inline(__always)
-  public final func append(chunk: std.string) -> bridge.Result_void_ {
-    do {
-      try self.__implementation.append(chunk: String(chunk))
-      return bridge.create_Result_void_()
-    } catch (let __error) {
-      let __exceptionPtr = __error.toCpp()
-      return bridge.create_Result_void_(__exceptionPtr)
-    }
-  }
-  
-  @inline(__always)
-  public final func clear() -> bridge.Result_void_ {
-    do {
-      try self.__implementation.clear()
-      return bridge.create_Result_void_()
-    } catch (let __error) {
-      let __exceptionPtr = __error.toCpp()
-      return bridge.create_Result_void_(__exceptionPtr)
-    }
-  }
-  
-  @inline(__always)
-  public final func getAllText() -> bridge.Result_std__string_ {
-    do {
-      let __result = try self.__implementation.getAllText()
-      let __resultCpp = std.string(__result)
-      return bridge.create_Result_std__string_(__resultCpp)
-    } catch (let __error) {
-      let __exceptionPtr = __error.toCpp()
-      return bridge.create_Result_std__string_(__exceptionPtr)
-    }
-  }
-  
-  @inline(__always)
-  public final func addListener(listener: bridge.Func_void) -> bridge.Result_std__function_void____ {
-    do {
-      let __result = try self.__implementation.addListener(listener: { () -> () -> Void in
-        let __wrappedFunction = bridge.wrap_Func_void(listener)
-        return { () -> Void in
-          __wrappedFunction.call()
-        }
-      }())
-      let __resultCpp = { () -> bridge.Func_void in
-        let __closureWrapper = Func_void(__result)
-        return bridge.create_Func_void(__closureWrapper.toUnsafe())
-      }()
-      return bridge.create_Result_std__function_void____(__resultCpp)
-    } catch (let __error) {
-      let __exceptionPtr = __error.toCpp()
-      return bridge.create_Result_std__function_void____(__exceptionPtr)
-    }
-  }
-}
@@ -0,0 +1,86 @@
+///
+/// BatchParseResult.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+#include <string>
+#include <vector>
+
+namespace margelo::nitro::Markdown {
+
+  /**
+   * A struct which can be represented as a JavaScript object (BatchParseResult).
+   */
+  struct BatchParseResult final {
+  public:
+    std::string json     SWIFT_PRIVATE;
+    std::vector<double> offsets     SWIFT_PRIVATE;
+
+  public:
+    BatchParseResult() = default;
+    explicit BatchParseResult(std::string json, std::vector<double> offsets): json(json), offsets(offsets) {}
+
+  public:
+    friend bool operator==(const BatchParseResult& lhs, const BatchParseResult& rhs) = default;
+  };
+
+} // namespace margelo::nitro::Markdown
+
+namespace margelo::nitro {
+
+  // C++ BatchParseResult <> JS BatchParseResult (object)
+  template <>
+  struct JSIConverter<margelo::nitro::Markdown::BatchParseResult> final {
+    static inline margelo::nitro::Markdown::BatchParseResult fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::Markdown::BatchParseResult(
+        JSIConverter<std::string>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "json"))),
+        JSIConverter<std::vector<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offsets")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::Markdown::BatchParseResult& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "json"), JSIConverter<std::string>::toJSI(runtime, arg.json));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "offsets"), JSIConverter<std::vector<double>>::toJSI(runtime, arg.offsets));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::string>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "json")))) return false;
+      if (!JSIConverter<std::vector<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "offsets")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,95 @@
+///
+/// HtmlRenderOptions.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+#include <optional>
+
+namespace margelo::nitro::Markdown {
+
+  /**
+   * A struct which can be represented as a JavaScript object (HtmlRenderOptions).
+   */
+  struct HtmlRenderOptions final {
+  public:
+    std::optional<bool> gfm     SWIFT_PRIVATE;
+    std::optional<bool> math     SWIFT_PRIVATE;
+    std::optional<bool> headingAnchors     SWIFT_PRIVATE;
+    std::optional<bool> mathDelimiters     SWIFT_PRIVATE;
+
+  public:
+    HtmlRenderOptions() = default;
+    explicit HtmlRenderOptions(std::optional<bool> gfm, std::optional<bool> math, std::optional<bool> headingAnchors, std::optional<bool> mathDelimiters): gfm(gfm), math(math), headingAnchors(headingAnchors), mathDelimiters(mathDelimiters) {}
+
+  public:
+    friend bool operator==(const HtmlRenderOptions& lhs, const HtmlRenderOptions& rhs) = default;
+  };
+
+} // namespace margelo::nitro::Markdown
+
+namespace margelo::nitro {
+
+  // C++ HtmlRenderOptions <> JS HtmlRenderOptions (object)
+  template <>
+  struct JSIConverter<margelo::nitro::Markdown::HtmlRenderOptions> final {
+    static inline margelo::nitro::Markdown::HtmlRenderOptions fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::Markdown::HtmlRenderOptions(
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gfm"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "math"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "headingAnchors"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mathDelimiters")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::Markdown::HtmlRenderOptions& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "gfm"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.gfm));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "math"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.math));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "headingAnchors"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.headingAnchors));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "mathDelimiters"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.mathDelimiters));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gfm")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "math")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "headingAnchors")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "mathDelimiters")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
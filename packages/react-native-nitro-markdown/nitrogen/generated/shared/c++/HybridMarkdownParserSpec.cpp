@@ -16,6 +16,20 @@ namespace margelo::nitro::Markdown {
     registerHybrids(this, [](Prototype& prototype) {
       prototype.registerHybridMethod("parse", &HybridMarkdownParserSpec::parse);
       prototype.registerHybridMethod("parseWithOptions", &HybridMarkdownParserSpec::parseWithOptions);
+      prototype.registerHybridMethod("parseBuffer", &HybridMarkdownParserSpec::parseBuffer);
+      prototype.registerHybridMethod("parseFile", &HybridMarkdownParserSpec::parseFile);
+      prototype.registerHybridMethod("parseInlines", &HybridMarkdownParserSpec::parseInlines);
+      prototype.registerHybridMethod("renderHtml", &HybridMarkdownParserSpec::renderHtml);
+      prototype.registerHybridMethod("parseBatch", &HybridMarkdownParserSpec::parseBatch);
+      prototype.registerHybridMethod("getLastParseStats", &HybridMarkdownParserSpec::getLastParseStats);
+      prototype.registerHybridMethod("getMemoryFootprint", &HybridMarkdownParserSpec::getMemoryFootprint);
+      prototype.registerHybridMethod("setCacheCapacity", &HybridMarkdownParserSpec::setCacheCapacity);
+      prototype.registerHybridMethod("getCacheStats", &HybridMarkdownParserSpec::getCacheStats);
+      prototype.registerHybridMethod("clearCache", &HybridMarkdownParserSpec::clearCache);
+      prototype.registerHybridMethod("openAstCache", &HybridMarkdownParserSpec::openAstCache);
+      prototype.registerHybridMethod("saveAstCache", &HybridMarkdownParserSpec::saveAstCache);
+      prototype.registerHybridMethod("closeAstCache", &HybridMarkdownParserSpec::closeAstCache);
+      prototype.registerHybridMethod("trimMemory", &HybridMarkdownParserSpec::trimMemory);
     });
   }
 
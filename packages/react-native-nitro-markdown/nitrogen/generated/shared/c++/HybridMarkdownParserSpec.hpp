@@ -15,9 +15,26 @@
 
 // Forward declaration of `ParserOptions` to properly resolve imports.
 namespace margelo::nitro::Markdown { struct ParserOptions; }
+// Forward declaration of `ParseStats` to properly resolve imports.
+namespace margelo::nitro::Markdown { struct ParseStats; }
+// Forward declaration of `MemoryFootprint` to properly resolve imports.
+namespace margelo::nitro::Markdown { struct MemoryFootprint; }
+// Forward declaration of `ParseCacheStats` to properly resolve imports.
+namespace margelo::nitro::Markdown { struct ParseCacheStats; }
+// Forward declaration of `BatchParseResult` to properly resolve imports.
+namespace margelo::nitro::Markdown { struct BatchParseResult; }
+// Forward declaration of `HtmlRenderOptions` to properly resolve imports.
+namespace margelo::nitro::Markdown { struct HtmlRenderOptions; }
 
 #include <string>
 #include "ParserOptions.hpp"
+#include <NitroModules/ArrayBuffer.hpp>
+#include "ParseStats.hpp"
+#include "MemoryFootprint.hpp"
+#include "ParseCacheStats.hpp"
+#include "BatchParseResult.hpp"
+#include <vector>
+#include "HtmlRenderOptions.hpp"
 
 namespace margelo::nitro::Markdown {
 
@@ -52,6 +69,20 @@ namespace margelo::nitro::Markdown {
       // Methods
       virtual std::string parse(const std::string& text) = 0;
       virtual std::string parseWithOptions(const std::string& text, const ParserOptions& options) = 0;
+      virtual std::string parseBuffer(const std::shared_ptr<ArrayBuffer>& buffer, const ParserOptions& options) = 0;
+      virtual std::string parseFile(const std::string& path, const ParserOptions& options) = 0;
+      virtual std::string parseInlines(double blockId) = 0;
+      virtual std::string renderHtml(const std::string& text, const HtmlRenderOptions& options) = 0;
+      virtual BatchParseResult parseBatch(const std::vector<std::string>& texts, const ParserOptions& options) = 0;
+      virtual ParseStats getLastParseStats() = 0;
+      virtual MemoryFootprint getMemoryFootprint() = 0;
+      virtual void setCacheCapacity(double bytes) = 0;
+      virtual ParseCacheStats getCacheStats() = 0;
+      virtual void clearCache() = 0;
+      virtual bool openAstCache(const std::string& path, double maxBytes) = 0;
+      virtual bool saveAstCache() = 0;
+      virtual void closeAstCache() = 0;
+      virtual void trimMemory(bool critical) = 0;
 
     protected:
       // Hybrid Setup
@@ -0,0 +1,23 @@
+///
+/// HybridMarkdownSessionSnapshotSpec.cpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#include "HybridMarkdownSessionSnapshotSpec.hpp"
+
+namespace margelo::nitro::Markdown {
+
+  void HybridMarkdownSessionSnapshotSpec::loadHybridMethods() {
+    // load base methods/properties
+    HybridObject::loadHybridMethods();
+    // load custom methods/properties
+    registerHybrids(this, [](Prototype& prototype) {
+      prototype.registerHybridGetter("length", &HybridMarkdownSessionSnapshotSpec::getLength);
+      prototype.registerHybridMethod("getAllText", &HybridMarkdownSessionSnapshotSpec::getAllText);
+      prototype.registerHybridMethod("fork", &HybridMarkdownSessionSnapshotSpec::fork);
+    });
+  }
+
+} // namespace margelo::nitro::Markdown
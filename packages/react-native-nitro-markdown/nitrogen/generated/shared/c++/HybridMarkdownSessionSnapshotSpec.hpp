@@ -0,0 +1,66 @@
+///
+/// HybridMarkdownSessionSnapshotSpec.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/HybridObject.hpp>)
+#include <NitroModules/HybridObject.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+// Forward declaration of `HybridMarkdownSessionSpec` to properly resolve imports.
+namespace margelo::nitro::Markdown { class HybridMarkdownSessionSpec; }
+
+#include <string>
+#include <memory>
+#include "HybridMarkdownSessionSpec.hpp"
+
+namespace margelo::nitro::Markdown {
+
+  using namespace margelo::nitro;
+
+  /**
+   * An abstract base class for `MarkdownSessionSnapshot`
+   * Inherit this class to create instances of `HybridMarkdownSessionSnapshotSpec` in C++.
+   * You must explicitly call `HybridObject`'s constructor yourself, because it is virtual.
+   * @example
+   * ```cpp
+   * class HybridMarkdownSessionSnapshot: public HybridMarkdownSessionSnapshotSpec {
+   * public:
+   *   HybridMarkdownSessionSnapshot(...): HybridObject(TAG) { ... }
+   *   // ...
+   * };
+   * ```
+   */
+  class HybridMarkdownSessionSnapshotSpec: public virtual HybridObject {
+    public:
+      // Constructor
+      explicit HybridMarkdownSessionSnapshotSpec(): HybridObject(TAG) { }
+
+      // Destructor
+      ~HybridMarkdownSessionSnapshotSpec() override = default;
+
+    public:
+      // Properties
+      virtual double getLength() = 0;
+
+    public:
+      // Methods
+      virtual std::string getAllText() = 0;
+      virtual std::shared_ptr<HybridMarkdownSessionSpec> fork() = 0;
+
+    protected:
+      // Hybrid Setup
+      void loadHybridMethods() override;
+
+    protected:
+      // Tag for logging
+      static constexpr auto TAG = "MarkdownSessionSnapshot";
+  };
+
+} // namespace margelo::nitro::Markdown
@@ -19,7 +19,13 @@ namespace margelo::nitro::Markdown {
       prototype.registerHybridMethod("append", &HybridMarkdownSessionSpec::append);
       prototype.registerHybridMethod("clear", &HybridMarkdownSessionSpec::clear);
       prototype.registerHybridMethod("getAllText", &HybridMarkdownSessionSpec::getAllText);
+      prototype.registerHybridMethod("getDocument", &HybridMarkdownSessionSpec::getDocument);
       prototype.registerHybridMethod("addListener", &HybridMarkdownSessionSpec::addListener);
+      prototype.registerHybridMethod("snapshot", &HybridMarkdownSessionSpec::snapshot);
+      prototype.registerHybridMethod("fork", &HybridMarkdownSessionSpec::fork);
+      prototype.registerHybridMethod("compact", &HybridMarkdownSessionSpec::compact);
+      prototype.registerHybridMethod("getColdBlockCount", &HybridMarkdownSessionSpec::getColdBlockCount);
+      prototype.registerHybridMethod("getColdBlocks", &HybridMarkdownSessionSpec::getColdBlocks);
     });
   }
 
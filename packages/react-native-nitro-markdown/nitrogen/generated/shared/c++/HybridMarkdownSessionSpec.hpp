@@ -13,10 +13,14 @@
 #error NitroModules cannot be found! Are you sure you installed NitroModules properly?
 #endif
 
-
+// Forward declaration of `HybridMarkdownSessionSnapshotSpec` to properly resolve imports.
+namespace margelo::nitro::Markdown { class HybridMarkdownSessionSnapshotSpec; }
 
 #include <string>
 #include <functional>
+#include <memory>
+#include "HybridMarkdownSessionSnapshotSpec.hpp"
+#include <optional>
 
 namespace margelo::nitro::Markdown {
 
@@ -53,7 +57,13 @@ namespace margelo::nitro::Markdown {
       virtual void append(const std::string& chunk) = 0;
       virtual void clear() = 0;
       virtual std::string getAllText() = 0;
+      virtual std::string getDocument() = 0;
       virtual std::function<void()> addListener(const std::function<void()>& listener) = 0;
+      virtual std::shared_ptr<HybridMarkdownSessionSnapshotSpec> snapshot() = 0;
+      virtual std::shared_ptr<HybridMarkdownSessionSpec> fork() = 0;
+      virtual double compact(std::optional<double> hotBytes) = 0;
+      virtual double getColdBlockCount() = 0;
+      virtual std::string getColdBlocks(double begin, double end) = 0;
 
     protected:
       // Hybrid Setup
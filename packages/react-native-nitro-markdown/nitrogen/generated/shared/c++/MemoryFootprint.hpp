@@ -0,0 +1,103 @@
+///
+/// MemoryFootprint.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::Markdown {
+
+  /**
+   * A struct which can be represented as a JavaScript object (MemoryFootprint).
+   */
+  struct MemoryFootprint final {
+  public:
+    double inputBytes     SWIFT_PRIVATE;
+    double nodeBytes     SWIFT_PRIVATE;
+    double stringBytes     SWIFT_PRIVATE;
+    double scratchBytes     SWIFT_PRIVATE;
+    double cacheBytes     SWIFT_PRIVATE;
+    double totalBytes     SWIFT_PRIVATE;
+
+  public:
+    MemoryFootprint() = default;
+    explicit MemoryFootprint(double inputBytes, double nodeBytes, double stringBytes, double scratchBytes, double cacheBytes, double totalBytes): inputBytes(inputBytes), nodeBytes(nodeBytes), stringBytes(stringBytes), scratchBytes(scratchBytes), cacheBytes(cacheBytes), totalBytes(totalBytes) {}
+
+  public:
+    friend bool operator==(const MemoryFootprint& lhs, const MemoryFootprint& rhs) = default;
+  };
+
+} // namespace margelo::nitro::Markdown
+
+namespace margelo::nitro {
+
+  // C++ MemoryFootprint <> JS MemoryFootprint (object)
+  template <>
+  struct JSIConverter<margelo::nitro::Markdown::MemoryFootprint> final {
+    static inline margelo::nitro::Markdown::MemoryFootprint fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::Markdown::MemoryFootprint(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "inputBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "nodeBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "stringBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scratchBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cacheBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "totalBytes")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::Markdown::MemoryFootprint& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "inputBytes"), JSIConverter<double>::toJSI(runtime, arg.inputBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "nodeBytes"), JSIConverter<double>::toJSI(runtime, arg.nodeBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "stringBytes"), JSIConverter<double>::toJSI(runtime, arg.stringBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "scratchBytes"), JSIConverter<double>::toJSI(runtime, arg.scratchBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "cacheBytes"), JSIConverter<double>::toJSI(runtime, arg.cacheBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "totalBytes"), JSIConverter<double>::toJSI(runtime, arg.totalBytes));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "inputBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "nodeBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "stringBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "scratchBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "cacheBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "totalBytes")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
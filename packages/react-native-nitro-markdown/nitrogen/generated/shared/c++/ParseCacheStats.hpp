@@ -0,0 +1,131 @@
+///
+/// ParseCacheStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::Markdown {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ParseCacheStats).
+   */
+  struct ParseCacheStats final {
+  public:
+    double hits     SWIFT_PRIVATE;
+    double misses     SWIFT_PRIVATE;
+    double evictions     SWIFT_PRIVATE;
+    double entries     SWIFT_PRIVATE;
+    double bytes     SWIFT_PRIVATE;
+    double capacityBytes     SWIFT_PRIVATE;
+    double blockHits     SWIFT_PRIVATE;
+    double blockMisses     SWIFT_PRIVATE;
+    double blockBytes     SWIFT_PRIVATE;
+    double diskHits     SWIFT_PRIVATE;
+    double diskMisses     SWIFT_PRIVATE;
+    double diskEntries     SWIFT_PRIVATE;
+    double diskBytes     SWIFT_PRIVATE;
+
+  public:
+    ParseCacheStats() = default;
+    explicit ParseCacheStats(double hits, double misses, double evictions, double entries, double bytes, double capacityBytes, double blockHits, double blockMisses, double blockBytes, double diskHits, double diskMisses, double diskEntries, double diskBytes): hits(hits), misses(misses), evictions(evictions), entries(entries), bytes(bytes), capacityBytes(capacityBytes), blockHits(blockHits), blockMisses(blockMisses), blockBytes(blockBytes), diskHits(diskHits), diskMisses(diskMisses), diskEntries(diskEntries), diskBytes(diskBytes) {}
+
+  public:
+    friend bool operator==(const ParseCacheStats& lhs, const ParseCacheStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::Markdown
+
+namespace margelo::nitro {
+
+  // C++ ParseCacheStats <> JS ParseCacheStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::Markdown::ParseCacheStats> final {
+    static inline margelo::nitro::Markdown::ParseCacheStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::Markdown::ParseCacheStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "hits"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "misses"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "evictions"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "entries"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "capacityBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockHits"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockMisses"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskHits"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskMisses"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskEntries"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskBytes")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::Markdown::ParseCacheStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "hits"), JSIConverter<double>::toJSI(runtime, arg.hits));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "misses"), JSIConverter<double>::toJSI(runtime, arg.misses));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "evictions"), JSIConverter<double>::toJSI(runtime, arg.evictions));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "entries"), JSIConverter<double>::toJSI(runtime, arg.entries));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "bytes"), JSIConverter<double>::toJSI(runtime, arg.bytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "capacityBytes"), JSIConverter<double>::toJSI(runtime, arg.capacityBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "blockHits"), JSIConverter<double>::toJSI(runtime, arg.blockHits));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "blockMisses"), JSIConverter<double>::toJSI(runtime, arg.blockMisses));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "blockBytes"), JSIConverter<double>::toJSI(runtime, arg.blockBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "diskHits"), JSIConverter<double>::toJSI(runtime, arg.diskHits));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "diskMisses"), JSIConverter<double>::toJSI(runtime, arg.diskMisses));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "diskEntries"), JSIConverter<double>::toJSI(runtime, arg.diskEntries));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "diskBytes"), JSIConverter<double>::toJSI(runtime, arg.diskBytes));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "hits")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "misses")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "evictions")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "entries")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "bytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "capacityBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockHits")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockMisses")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskHits")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskMisses")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskEntries")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "diskBytes")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
@@ -0,0 +1,127 @@
+///
+/// ParseStats.hpp
+/// This file was generated by nitrogen. DO NOT MODIFY THIS FILE.
+/// https://github.com/mrousavy/nitro
+/// Copyright © Marc Rousavy @ Margelo
+///
+
+#pragma once
+
+#if __has_include(<NitroModules/JSIConverter.hpp>)
+#include <NitroModules/JSIConverter.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/NitroDefines.hpp>)
+#include <NitroModules/NitroDefines.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/JSIHelpers.hpp>)
+#include <NitroModules/JSIHelpers.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+#if __has_include(<NitroModules/PropNameIDCache.hpp>)
+#include <NitroModules/PropNameIDCache.hpp>
+#else
+#error NitroModules cannot be found! Are you sure you installed NitroModules properly?
+#endif
+
+
+
+
+
+namespace margelo::nitro::Markdown {
+
+  /**
+   * A struct which can be represented as a JavaScript object (ParseStats).
+   */
+  struct ParseStats final {
+  public:
+    double operations     SWIFT_PRIVATE;
+    double parseTimeMs     SWIFT_PRIVATE;
+    bool budgetExceeded     SWIFT_PRIVATE;
+    double plainTextOffset     SWIFT_PRIVATE;
+    double blockAnalysisMs     SWIFT_PRIVATE;
+    double inlineAnalysisMs     SWIFT_PRIVATE;
+    double astBuildMs     SWIFT_PRIVATE;
+    double serializationMs     SWIFT_PRIVATE;
+    double nodeCount     SWIFT_PRIVATE;
+    double maxDepth     SWIFT_PRIVATE;
+    double outputBytes     SWIFT_PRIVATE;
+    double estimatedAllocations     SWIFT_PRIVATE;
+
+  public:
+    ParseStats() = default;
+    explicit ParseStats(double operations, double parseTimeMs, bool budgetExceeded, double plainTextOffset, double blockAnalysisMs, double inlineAnalysisMs, double astBuildMs, double serializationMs, double nodeCount, double maxDepth, double outputBytes, double estimatedAllocations): operations(operations), parseTimeMs(parseTimeMs), budgetExceeded(budgetExceeded), plainTextOffset(plainTextOffset), blockAnalysisMs(blockAnalysisMs), inlineAnalysisMs(inlineAnalysisMs), astBuildMs(astBuildMs), serializationMs(serializationMs), nodeCount(nodeCount), maxDepth(maxDepth), outputBytes(outputBytes), estimatedAllocations(estimatedAllocations) {}
+
+  public:
+    friend bool operator==(const ParseStats& lhs, const ParseStats& rhs) = default;
+  };
+
+} // namespace margelo::nitro::Markdown
+
+namespace margelo::nitro {
+
+  // C++ ParseStats <> JS ParseStats (object)
+  template <>
+  struct JSIConverter<margelo::nitro::Markdown::ParseStats> final {
+    static inline margelo::nitro::Markdown::ParseStats fromJSI(jsi::Runtime& runtime, const jsi::Value& arg) {
+      jsi::Object obj = arg.asObject(runtime);
+      return margelo::nitro::Markdown::ParseStats(
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "operations"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "parseTimeMs"))),
+        JSIConverter<bool>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "budgetExceeded"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "plainTextOffset"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockAnalysisMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "inlineAnalysisMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "astBuildMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "serializationMs"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "nodeCount"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxDepth"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outputBytes"))),
+        JSIConverter<double>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "estimatedAllocations")))
+      );
+    }
+    static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::Markdown::ParseStats& arg) {
+      jsi::Object obj(runtime);
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "operations"), JSIConverter<double>::toJSI(runtime, arg.operations));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "parseTimeMs"), JSIConverter<double>::toJSI(runtime, arg.parseTimeMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "budgetExceeded"), JSIConverter<bool>::toJSI(runtime, arg.budgetExceeded));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "plainTextOffset"), JSIConverter<double>::toJSI(runtime, arg.plainTextOffset));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "blockAnalysisMs"), JSIConverter<double>::toJSI(runtime, arg.blockAnalysisMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "inlineAnalysisMs"), JSIConverter<double>::toJSI(runtime, arg.inlineAnalysisMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "astBuildMs"), JSIConverter<double>::toJSI(runtime, arg.astBuildMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "serializationMs"), JSIConverter<double>::toJSI(runtime, arg.serializationMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "nodeCount"), JSIConverter<double>::toJSI(runtime, arg.nodeCount));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxDepth"), JSIConverter<double>::toJSI(runtime, arg.maxDepth));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "outputBytes"), JSIConverter<double>::toJSI(runtime, arg.outputBytes));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "estimatedAllocations"), JSIConverter<double>::toJSI(runtime, arg.estimatedAllocations));
+      return obj;
+    }
+    static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
+      if (!value.isObject()) {
+        return false;
+      }
+      jsi::Object obj = value.getObject(runtime);
+      if (!nitro::isPlainObject(runtime, obj)) {
+        return false;
+      }
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "operations")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "parseTimeMs")))) return false;
+      if (!JSIConverter<bool>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "budgetExceeded")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "plainTextOffset")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "blockAnalysisMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "inlineAnalysisMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "astBuildMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "serializationMs")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "nodeCount")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxDepth")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "outputBytes")))) return false;
+      if (!JSIConverter<double>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "estimatedAllocations")))) return false;
+      return true;
+    }
+  };
+
+} // namespace margelo::nitro
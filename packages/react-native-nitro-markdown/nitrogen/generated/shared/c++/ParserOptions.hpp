@@ -41,10 +41,14 @@ namespace margelo::nitro::Markdown {
   public:
     std::optional<bool> gfm     SWIFT_PRIVATE;
     std::optional<bool> math     SWIFT_PRIVATE;
+    std::optional<double> maxOperations     SWIFT_PRIVATE;
+    std::optional<double> maxParseTimeMs     SWIFT_PRIVATE;
+    std::optional<bool> deferInlines     SWIFT_PRIVATE;
+    std::optional<bool> collectStats     SWIFT_PRIVATE;
 
   public:
     ParserOptions() = default;
-    explicit ParserOptions(std::optional<bool> gfm, std::optional<bool> math): gfm(gfm), math(math) {}
+    explicit ParserOptions(std::optional<bool> gfm, std::optional<bool> math, std::optional<double> maxOperations, std::optional<double> maxParseTimeMs, std::optional<bool> deferInlines, std::optional<bool> collectStats): gfm(gfm), math(math), maxOperations(maxOperations), maxParseTimeMs(maxParseTimeMs), deferInlines(deferInlines), collectStats(collectStats) {}
 
   public:
     friend bool operator==(const ParserOptions& lhs, const ParserOptions& rhs) = default;
@@ -61,13 +65,21 @@ namespace margelo::nitro {
       jsi::Object obj = arg.asObject(runtime);
       return margelo::nitro::Markdown::ParserOptions(
         JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gfm"))),
-        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "math")))
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "math"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxOperations"))),
+        JSIConverter<std::optional<double>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxParseTimeMs"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "deferInlines"))),
+        JSIConverter<std::optional<bool>>::fromJSI(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "collectStats")))
       );
     }
     static inline jsi::Value toJSI(jsi::Runtime& runtime, const margelo::nitro::Markdown::ParserOptions& arg) {
       jsi::Object obj(runtime);
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "gfm"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.gfm));
       obj.setProperty(runtime, PropNameIDCache::get(runtime, "math"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.math));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxOperations"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.maxOperations));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "maxParseTimeMs"), JSIConverter<std::optional<double>>::toJSI(runtime, arg.maxParseTimeMs));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "deferInlines"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.deferInlines));
+      obj.setProperty(runtime, PropNameIDCache::get(runtime, "collectStats"), JSIConverter<std::optional<bool>>::toJSI(runtime, arg.collectStats));
       return obj;
     }
     static inline bool canConvert(jsi::Runtime& runtime, const jsi::Value& value) {
@@ -80,6 +92,10 @@ namespace margelo::nitro {
       }
       if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "gfm")))) return false;
       if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "math")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxOperations")))) return false;
+      if (!JSIConverter<std::optional<double>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "maxParseTimeMs")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "deferInlines")))) return false;
+      if (!JSIConverter<std::optional<bool>>::canConvert(runtime, obj.getProperty(runtime, PropNameIDCache::get(runtime, "collectStats")))) return false;
       return true;
     }
   };
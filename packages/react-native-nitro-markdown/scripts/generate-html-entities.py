@@ -0,0 +1,140 @@
+#!/usr/bin/env python3
+"""
+Generates cpp/core/HtmlEntityTable.hpp: a minimal perfect hash over the HTML5
+named character references (the ones terminated by ';', which is all md4c
+reports as entities).
+
+Lookup, mirrored by HtmlEntities.cpp:
+  bucket = fnv1a(name, 0) % BUCKET_COUNT
+  d = DISPLACEMENTS[bucket]
+  slot = -d - 1 if d < 0 else fnv1a(name, d) % ENTRY_COUNT
+  ENTRIES[slot].name == name ? ENTRIES[slot].utf8 : not an entity
+
+Usage: python3 scripts/generate-html-entities.py
+"""
+
+import html.entities
+import os
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+
+
+def fnv1a(data: bytes, seed: int) -> int:
+    h = (FNV_OFFSET ^ seed) & 0xFFFFFFFF
+    for byte in data:
+        h ^= byte
+        h = (h * FNV_PRIME) & 0xFFFFFFFF
+    return h
+
+
+def build(names):
+    n = len(names)
+    bucket_count = (n + 3) // 4
+    buckets = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[fnv1a(name, 0) % bucket_count].append(name)
+
+    slots = [None] * n
+    displacements = [0] * bucket_count
+    order = sorted(range(bucket_count), key=lambda b: len(buckets[b]), reverse=True)
+
+    pending = []
+    for b in order:
+        keys = buckets[b]
+        if len(keys) == 0:
+            continue
+        if len(keys) == 1:
+            pending.append(b)
+            continue
+        d = 1
+        while True:
+            candidate = [fnv1a(k, d) % n for k in keys]
+            if len(set(candidate)) == len(keys) and all(slots[s] is None for s in candidate):
+                break
+            d += 1
+        for k, s in zip(keys, candidate):
+            slots[s] = k
+        displacements[b] = d
+
+    # Single-key buckets go straight into the remaining free slots.
+    free = iter([i for i, s in enumerate(slots) if s is None])
+    for b in pending:
+        s = next(free)
+        slots[s] = buckets[b][0]
+        displacements[b] = -s - 1
+
+    return bucket_count, displacements, slots
+
+
+def cpp_string(data: bytes) -> str:
+    # Octal escapes always take exactly three digits, so unlike \x they can be
+    # followed by any character.
+    out = ''
+    for byte in data:
+        if 0x20 <= byte < 0x7F and chr(byte) not in '"\\?':
+            out += chr(byte)
+        else:
+            out += '\\%03o' % byte
+    return '"' + out + '"'
+
+
+def main():
+    table = {
+        name[:-1].encode('ascii'): value.encode('utf-8')
+        for name, value in html.entities.html5.items()
+        if name.endswith(';')
+    }
+    names = sorted(table)
+    bucket_count, displacements, slots = build(names)
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    path = os.path.join(root, 'cpp', 'core', 'HtmlEntityTable.hpp')
+
+    lines = [
+        '///',
+        '/// HtmlEntityTable.hpp',
+        '/// This file was generated by scripts/generate-html-entities.py. DO NOT MODIFY THIS FILE.',
+        '///',
+        '',
+        '#pragma once',
+        '',
+        '#include <cstddef>',
+        '#include <cstdint>',
+        '',
+        'namespace NitroMarkdown::HtmlEntityTable {',
+        '',
+        'struct Entry {',
+        '    const char* name;',
+        '    const char* utf8;',
+        '};',
+        '',
+        'inline constexpr uint32_t kEntryCount = %d;' % len(slots),
+        'inline constexpr uint32_t kBucketCount = %d;' % bucket_count,
+        'inline constexpr size_t kMaxNameLength = %d;' % max(len(n) for n in names),
+        '',
+        'inline constexpr int32_t kDisplacements[kBucketCount] = {',
+    ]
+    for i in range(0, bucket_count, 12):
+        lines.append('    ' + ', '.join(str(d) for d in displacements[i:i + 12]) + ',')
+    lines += [
+        '};',
+        '',
+        'inline constexpr Entry kEntries[kEntryCount] = {',
+    ]
+    for name in slots:
+        lines.append('    {"%s", %s},' % (name.decode('ascii'), cpp_string(table[name])))
+    lines += [
+        '};',
+        '',
+        '} // namespace NitroMarkdown::HtmlEntityTable',
+        '',
+    ]
+
+    with open(path, 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+    print('Wrote %d entities to %s' % (len(slots), path))
+
+
+if __name__ == '__main__':
+    main()
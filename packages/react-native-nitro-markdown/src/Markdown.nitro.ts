@@ -3,10 +3,185 @@ import type { HybridObject } from 'react-native-nitro-modules';
 export interface ParserOptions {
   gfm?: boolean;
   math?: boolean;
+  /**
+   * Maximum parser work units (roughly lines, inline marks and links examined)
+   * for a single parse. When exceeded, the rest of the input is rendered as
+   * plain text. `0` or unset means unlimited.
+   */
+  maxOperations?: number;
+  /**
+   * Maximum wall-clock time for a single parse in milliseconds. When exceeded,
+   * the rest of the input is rendered as plain text. `0` or unset means unlimited.
+   */
+  maxParseTimeMs?: number;
+  /**
+   * Emit only the block structure. Paragraphs, headings and table cells get a
+   * `blockId` and their source range instead of inline children; materialize
+   * them with `parseInlines(blockId)` when they become visible.
+   */
+  deferInlines?: boolean;
+  /**
+   * Record phase timings and tree shape for `getLastParseStats()`. Cheap
+   * enough to leave on in production (a few percent of parse time).
+   */
+  collectStats?: boolean;
+}
+
+export interface HtmlRenderOptions {
+  gfm?: boolean;
+  math?: boolean;
+  /**
+   * Give headings an `id` made from their text, GitHub style, so that
+   * `#fragment` links reach them. Repeated ids get `-1`, `-2`, ... appended.
+   */
+  headingAnchors?: boolean;
+  /**
+   * Write math as `\(...\)` and `\[...\]` for MathJax or KaTeX auto-render
+   * instead of `<span class="math math-inline">` and `math-display` spans.
+   */
+  mathDelimiters?: boolean;
+}
+
+export interface ParseStats {
+  /** Parser work units spent (see `maxOperations`). */
+  operations: number;
+  /** Total native parse time in milliseconds, excluding serialization. */
+  parseTimeMs: number;
+  /** Whether a budget was exceeded and the rest was rendered as plain text. */
+  budgetExceeded: boolean;
+  /** Index into the parsed string where the plain-text fallback starts when `budgetExceeded` is set. */
+  plainTextOffset: number;
+  // The fields below are only filled in with `collectStats: true`.
+  /** Time md4c spent finding block boundaries. */
+  blockAnalysisMs: number;
+  /** Time md4c spent analyzing inline markup. */
+  inlineAnalysisMs: number;
+  /** Remaining parse time: emitting events and building AST nodes. */
+  astBuildMs: number;
+  /** Time spent serializing the AST for JS. */
+  serializationMs: number;
+  nodeCount: number;
+  maxDepth: number;
+  /** Size of the serialized AST in bytes. */
+  outputBytes: number;
+  /**
+   * Heap allocations made for the AST, estimated from its shape: one per
+   * node, children array growth and out-of-line string. Not a count of real
+   * allocations, which release builds do not track.
+   */
+  estimatedAllocations: number;
+}
+
+/**
+ * Native memory a parser keeps between calls, in bytes. Mostly the tree of
+ * the last parse, which stays alive for `parseInlines()`.
+ */
+export interface MemoryFootprint {
+  /** Source text kept for `parseInlines()` after a `deferInlines` parse. */
+  inputBytes: number;
+  /** AST nodes and their child arrays. */
+  nodeBytes: number;
+  /** Text, URLs and other string payloads of the nodes. */
+  stringBytes: number;
+  /** Parser working buffers kept between calls. */
+  scratchBytes: number;
+  /** Cached parse results and serializations. */
+  cacheBytes: number;
+  totalBytes: number;
+}
+
+/** Counters of the parse result cache, see `setCacheCapacity()`. */
+export interface ParseCacheStats {
+  hits: number;
+  misses: number;
+  /** Entries dropped to stay within the capacity. */
+  evictions: number;
+  entries: number;
+  /** Memory held by the cached results. */
+  bytes: number;
+  capacityBytes: number;
+  /** Top-level blocks taken unchanged from an earlier parse. */
+  blockHits: number;
+  /** Top-level blocks that had to be parsed. */
+  blockMisses: number;
+  /** Memory held by the memoized blocks and their JSON. */
+  blockBytes: number;
+  /** Results loaded from the file opened with `openAstCache()`. */
+  diskHits: number;
+  diskMisses: number;
+  /** Results in the cache file plus those added since it was opened. */
+  diskEntries: number;
+  /** Size of the mapped cache file. */
+  diskBytes: number;
+}
+
+/** Documents parsed by `parseBatch()`, serialized into one string. */
+export interface BatchParseResult {
+  /** JSON array with the AST of each document, in input order. */
+  json: string;
+  /**
+   * Where each document's JSON starts in `json`, followed by the length of
+   * `json`, so `json.slice(offsets[i], offsets[i + 1] - 1)` is document `i`.
+   */
+  offsets: number[];
 }
 
 export interface MarkdownParser
   extends HybridObject<{ ios: 'c++'; android: 'c++' }> {
   parse(text: string): string;
   parseWithOptions(text: string, options: ParserOptions): string;
+  /**
+   * Parse UTF-8 bytes, e.g. a downloaded document, without turning them
+   * into a JS string. Source offsets in the result count bytes.
+   */
+  parseBuffer(buffer: ArrayBuffer, options: ParserOptions): string;
+  /**
+   * Parse a UTF-8 file, memory-mapped instead of read. With `deferInlines`
+   * the mapping stays open for `parseInlines()` until the next parse.
+   * Source offsets in the result count bytes.
+   */
+  parseFile(path: string, options: ParserOptions): string;
+  parseInlines(blockId: number): string;
+  /**
+   * Render markdown to HTML straight from the native parser, without an
+   * AST. Text and attributes are escaped, raw HTML is rendered as text and
+   * `javascript:` and similar URLs are dropped, so the output is safe to
+   * embed.
+   */
+  renderHtml(text: string, options: HtmlRenderOptions): string;
+  /**
+   * Parse many documents in one call, on several native threads when the
+   * batch is large enough. Results come from the parse caches where
+   * possible. `deferInlines` is not supported.
+   */
+  parseBatch(texts: string[], options: ParserOptions): BatchParseResult;
+  /** Stats of the last parse or `parseInlines` call. */
+  getLastParseStats(): ParseStats;
+  /** Native memory held by this parser; also reported to the JS GC. */
+  getMemoryFootprint(): MemoryFootprint;
+  /**
+   * Bound the cache of parse results, keyed by a hash of the text and
+   * options, and separately the memo of unchanged top-level blocks. Each
+   * defaults to 4 MiB; `0` disables both.
+   */
+  setCacheCapacity(bytes: number): void;
+  getCacheStats(): ParseCacheStats;
+  clearCache(): void;
+  /**
+   * Memory-map a file of parse results persisted by `saveAstCache()`.
+   * Results found there are returned without parsing; new ones are added
+   * until the next save. Returns whether the file held a valid cache; a
+   * missing file, or one written by another version, starts out empty.
+   */
+  openAstCache(path: string, maxBytes: number): boolean;
+  /** Write the cache back to its file, keeping at most `maxBytes`. */
+  saveAstCache(): boolean;
+  /** Unmap the cache file and drop results that were not saved. */
+  closeAstCache(): void;
+  /**
+   * Give back native memory that can be rebuilt: spare parser buffers and
+   * idle parsers, and with `critical` also the parse caches. Reaches every
+   * native parser and session host in the process.
+   */
+  trimMemory(critical: boolean): void;
 }
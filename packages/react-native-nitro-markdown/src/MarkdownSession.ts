@@ -1,7 +1,11 @@
 import { NitroModules } from "react-native-nitro-modules";
-import type { MarkdownSession as MarkdownSessionSpec } from "./specs/MarkdownSession.nitro";
+import type {
+  MarkdownSession as MarkdownSessionSpec,
+  MarkdownSessionSnapshot as MarkdownSessionSnapshotSpec,
+} from "./specs/MarkdownSession.nitro";
 
 export type MarkdownSession = MarkdownSessionSpec;
+export type MarkdownSessionSnapshot = MarkdownSessionSnapshotSpec;
 
 export function createMarkdownSession(): MarkdownSession {
   return NitroModules.createHybridObject<MarkdownSession>("MarkdownSession");
@@ -1,4 +1,22 @@
-import { parseMarkdown, parseMarkdownWithOptions, MarkdownNode } from '../index';
+import {
+  parseMarkdown,
+  parseMarkdownWithOptions,
+  parseInlines,
+  parseMarkdownBatch,
+  parseMarkdownBuffer,
+  parseMarkdownFile,
+  renderMarkdownToHtml,
+  getLastParseStats,
+  getMemoryFootprint,
+  setParseCacheCapacity,
+  getParseCacheStats,
+  clearParseCache,
+  openAstCache,
+  saveAstCache,
+  closeAstCache,
+  trimNativeMemory,
+  MarkdownNode,
+} from '../index';
 import { mockParser } from './setup';
 
 describe('parseMarkdown', () => {
@@ -423,3 +441,145 @@ describe('parseMarkdownWithOptions', () => {
   });
 });
 
+
+describe('parseInlines', () => {
+  beforeEach(() => {
+    jest.clearAllMocks();
+  });
+
+  it('materializes a deferred block by id', () => {
+    const node = parseInlines(3);
+    expect(mockParser.parseInlines).toHaveBeenCalledWith(3);
+    expect(node.blockId).toBe(3);
+    expect(node.children![0].content).toBe('block 3');
+  });
+});
+
+describe('getLastParseStats', () => {
+  it('returns the native stats of the last parse', () => {
+    parseMarkdownWithOptions('# Hi', { collectStats: true });
+    const stats = getLastParseStats();
+    expect(mockParser.getLastParseStats).toHaveBeenCalled();
+    expect(stats.nodeCount).toBe(3);
+    expect(stats.serializationMs).toBeGreaterThan(0);
+  });
+});
+
+describe('getMemoryFootprint', () => {
+  it('returns the native memory held by the parser', () => {
+    const footprint = getMemoryFootprint();
+    expect(mockParser.getMemoryFootprint).toHaveBeenCalled();
+    expect(footprint.totalBytes).toBe(
+      footprint.inputBytes +
+        footprint.nodeBytes +
+        footprint.stringBytes +
+        footprint.scratchBytes +
+        footprint.cacheBytes
+    );
+  });
+});
+
+describe('parseMarkdownBatch', () => {
+  it('returns one document per text, in order', () => {
+    const documents = parseMarkdownBatch(['first', 'second']);
+    expect(mockParser.parseBatch).toHaveBeenCalledWith(['first', 'second'], {});
+    expect(documents).toHaveLength(2);
+    expect(documents[0].type).toBe('document');
+    expect(documents[1].children?.[0].content).toBe('second');
+  });
+
+  it('forwards options', () => {
+    parseMarkdownBatch(['a'], { gfm: false });
+    expect(mockParser.parseBatch).toHaveBeenCalledWith(['a'], { gfm: false });
+  });
+
+  it('handles an empty batch', () => {
+    expect(parseMarkdownBatch([])).toEqual([]);
+  });
+});
+
+describe('buffer and file input', () => {
+  it('parses the bytes of an ArrayBuffer', () => {
+    const bytes = new TextEncoder().encode('Hello buffer');
+    const buffer = new ArrayBuffer(bytes.length);
+    new Uint8Array(buffer).set(bytes);
+    const ast = parseMarkdownBuffer(buffer);
+    expect(mockParser.parseBuffer).toHaveBeenCalledWith(buffer, {});
+    expect(ast.type).toBe('document');
+  });
+
+  it('forwards file paths and options', () => {
+    const ast = parseMarkdownFile('/docs/guide.md', { deferInlines: true });
+    expect(mockParser.parseFile).toHaveBeenCalledWith('/docs/guide.md', {
+      deferInlines: true,
+    });
+    expect(ast.type).toBe('document');
+  });
+
+  it('throws when the file cannot be read', () => {
+    expect(() => parseMarkdownFile('/missing')).toThrow('cannot read');
+  });
+});
+
+describe('renderMarkdownToHtml', () => {
+  it('returns the native HTML', () => {
+    expect(renderMarkdownToHtml('Hello')).toBe('<p>Hello</p>\n');
+    expect(mockParser.renderHtml).toHaveBeenCalledWith('Hello', {});
+  });
+
+  it('forwards options', () => {
+    renderMarkdownToHtml('# Title', {
+      headingAnchors: true,
+      mathDelimiters: true,
+    });
+    expect(mockParser.renderHtml).toHaveBeenCalledWith('# Title', {
+      headingAnchors: true,
+      mathDelimiters: true,
+    });
+  });
+});
+
+describe('parse cache', () => {
+  it('forwards capacity and clear calls to the native parser', () => {
+    setParseCacheCapacity(1024);
+    expect(mockParser.setCacheCapacity).toHaveBeenCalledWith(1024);
+    clearParseCache();
+    expect(mockParser.clearCache).toHaveBeenCalled();
+  });
+
+  it('returns the native cache counters', () => {
+    const stats = getParseCacheStats();
+    expect(mockParser.getCacheStats).toHaveBeenCalled();
+    expect(stats.hits).toBe(3);
+    expect(stats.bytes).toBeLessThanOrEqual(stats.capacityBytes);
+  });
+});
+
+describe('AST cache file', () => {
+  it('opens the file with a default size limit', () => {
+    expect(openAstCache('/cache/markdown.bin')).toBe(true);
+    expect(mockParser.openAstCache).toHaveBeenCalledWith(
+      '/cache/markdown.bin',
+      32 * 1024 * 1024
+    );
+  });
+
+  it('forwards save and close calls to the native parser', () => {
+    expect(saveAstCache()).toBe(true);
+    expect(mockParser.saveAstCache).toHaveBeenCalled();
+    closeAstCache();
+    expect(mockParser.closeAstCache).toHaveBeenCalled();
+  });
+});
+
+describe('trimNativeMemory', () => {
+  it('asks for a moderate trim by default', () => {
+    trimNativeMemory();
+    expect(mockParser.trimMemory).toHaveBeenCalledWith(false);
+  });
+
+  it('forwards critical pressure', () => {
+    trimNativeMemory(true);
+    expect(mockParser.trimMemory).toHaveBeenCalledWith(true);
+  });
+});
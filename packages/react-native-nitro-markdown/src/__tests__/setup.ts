@@ -453,6 +453,81 @@ const mockParser = {
   parseWithOptions: jest.fn((text: string, options: MockParserOptions) =>
     JSON.stringify(createMockASTWithOptions(text, options))
   ),
+  parseBuffer: jest.fn((buffer: ArrayBuffer, options: MockParserOptions) =>
+    JSON.stringify(
+      createMockASTWithOptions(new TextDecoder().decode(buffer), options)
+    )
+  ),
+  parseFile: jest.fn((path: string) => {
+    if (!path.endsWith(".md")) {
+      throw new Error(`parseFile cannot read ${path}`);
+    }
+    return JSON.stringify(createMockAST(`# ${path}`));
+  }),
+  parseInlines: jest.fn((blockId: number) =>
+    JSON.stringify({
+      type: "paragraph",
+      blockId,
+      children: [createTextNode(`block ${blockId}`)],
+    })
+  ),
+  renderHtml: jest.fn((text: string) => `<p>${text}</p>\n`),
+  parseBatch: jest.fn((texts: string[]) => {
+    const documents = texts.map((text) =>
+      JSON.stringify({ type: "document", children: [createTextNode(text)] })
+    );
+    const offsets: number[] = [];
+    let offset = 1;
+    documents.forEach((document) => {
+      offsets.push(offset);
+      offset += document.length + 1;
+    });
+    offsets.push(Math.max(2, offset));
+    return { json: `[${documents.join(",")}]`, offsets };
+  }),
+  getLastParseStats: jest.fn(() => ({
+    operations: 12,
+    parseTimeMs: 0.5,
+    budgetExceeded: false,
+    plainTextOffset: 0,
+    blockAnalysisMs: 0.1,
+    inlineAnalysisMs: 0.2,
+    astBuildMs: 0.2,
+    serializationMs: 0.1,
+    nodeCount: 3,
+    maxDepth: 3,
+    outputBytes: 64,
+    estimatedAllocations: 5,
+  })),
+  getMemoryFootprint: jest.fn(() => ({
+    inputBytes: 0,
+    nodeBytes: 480,
+    stringBytes: 32,
+    scratchBytes: 300,
+    cacheBytes: 0,
+    totalBytes: 812,
+  })),
+  setCacheCapacity: jest.fn(),
+  getCacheStats: jest.fn(() => ({
+    hits: 3,
+    misses: 1,
+    evictions: 0,
+    entries: 1,
+    bytes: 256,
+    capacityBytes: 4194304,
+    blockHits: 5,
+    blockMisses: 2,
+    blockBytes: 1024,
+    diskHits: 2,
+    diskMisses: 1,
+    diskEntries: 40,
+    diskBytes: 65536,
+  })),
+  clearCache: jest.fn(),
+  openAstCache: jest.fn(() => true),
+  saveAstCache: jest.fn(() => true),
+  closeAstCache: jest.fn(),
+  trimMemory: jest.fn(),
 };
 
 jest.mock("react-native-nitro-modules", () => ({
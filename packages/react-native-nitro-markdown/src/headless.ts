@@ -11,9 +11,24 @@
  * ```
  */
 import { NitroModules } from "react-native-nitro-modules";
-import type { MarkdownParser, ParserOptions } from "./Markdown.nitro";
+import type {
+  MarkdownParser,
+  ParserOptions,
+  ParseStats,
+  MemoryFootprint,
+  ParseCacheStats,
+  BatchParseResult,
+  HtmlRenderOptions,
+} from "./Markdown.nitro";
 
-export type { ParserOptions } from "./Markdown.nitro";
+export type {
+  ParserOptions,
+  ParseStats,
+  MemoryFootprint,
+  ParseCacheStats,
+  BatchParseResult,
+  HtmlRenderOptions,
+} from "./Markdown.nitro";
 
 /**
  * Represents a node in the Markdown AST (Abstract Syntax Tree).
@@ -71,6 +86,12 @@ export interface MarkdownNode {
   isHeader?: boolean;
   /** Text alignment for table cells: 'left', 'center', or 'right'. */
   align?: string;
+  /** Set when inline parsing was deferred; pass to `parseInlines` to materialize the children. */
+  blockId?: number;
+  /** Start of the deferred block's inline source, as an index into the parsed string or a byte offset into a parsed buffer or file. */
+  sourceStart?: number;
+  /** End of the deferred block's inline source, as an index into the parsed string or a byte offset into a parsed buffer or file. */
+  sourceEnd?: number;
   /** Nested child nodes for hierarchical elements like paragraphs, lists, and tables. */
   children?: MarkdownNode[];
 }
@@ -91,7 +112,7 @@ export function parseMarkdown(text: string): MarkdownNode {
 /**
  * Parse markdown text with custom options.
  * @param text - The markdown text to parse
- * @param options - Parser options (gfm, math)
+ * @param options - Parser options (gfm, math, parse budgets)
  * @returns The root node of the parsed AST
  */
 export function parseMarkdownWithOptions(
@@ -102,5 +123,171 @@ export function parseMarkdownWithOptions(
   return JSON.parse(jsonStr) as MarkdownNode;
 }
 
+/**
+ * Parse UTF-8 markdown from an ArrayBuffer, e.g. a fetched response body,
+ * without creating a JS string of it. Throws if it is larger than 2 GiB.
+ * @param buffer - The UTF-8 encoded markdown
+ * @param options - Parser options; source offsets count bytes
+ * @returns The root node of the parsed AST
+ */
+export function parseMarkdownBuffer(
+  buffer: ArrayBuffer,
+  options: ParserOptions = {}
+): MarkdownNode {
+  const jsonStr = MarkdownParserModule.parseBuffer(buffer, options);
+  return JSON.parse(jsonStr) as MarkdownNode;
+}
+
+/**
+ * Parse a UTF-8 markdown file, e.g. a bundled or downloaded document. The
+ * file is memory-mapped natively and never read into a JS string. Throws if
+ * the file cannot be read or is larger than 2 GiB.
+ * @param path - Absolute path of the file
+ * @param options - Parser options; source offsets count bytes
+ * @returns The root node of the parsed AST
+ */
+export function parseMarkdownFile(
+  path: string,
+  options: ParserOptions = {}
+): MarkdownNode {
+  const jsonStr = MarkdownParserModule.parseFile(path, options);
+  return JSON.parse(jsonStr) as MarkdownNode;
+}
+
+/**
+ * Parse many documents in one native call, e.g. the history of a
+ * conversation. Large batches are spread over several native threads, and
+ * documents parsed before are taken from the parse caches.
+ * @param texts - The markdown documents to parse
+ * @param options - Parser options; `deferInlines` is not supported
+ * @returns The root node of each document, in input order
+ */
+export function parseMarkdownBatch(
+  texts: string[],
+  options: ParserOptions = {}
+): MarkdownNode[] {
+  const { json } = MarkdownParserModule.parseBatch(texts, options);
+  return JSON.parse(json) as MarkdownNode[];
+}
+
+/**
+ * Materialize the inline children of a block deferred by the last parse with
+ * `deferInlines: true`, e.g. when the block scrolls into view.
+ * @param blockId - The `blockId` of the deferred block
+ * @returns The block node with its inline children
+ */
+export function parseInlines(blockId: number): MarkdownNode {
+  const jsonStr = MarkdownParserModule.parseInlines(blockId);
+  return JSON.parse(jsonStr) as MarkdownNode;
+}
+
+/**
+ * Render markdown to an HTML string natively, e.g. for a WebView preview,
+ * an email or a share sheet. No AST is built or sent to JS. The output is
+ * escaped and drops script URLs, so it can be embedded as it is.
+ * @param text - The markdown text to render
+ * @param options - Dialect, heading anchors and how to wrap math
+ * @returns The HTML fragment, without `<html>` or `<body>`
+ */
+export function renderMarkdownToHtml(
+  text: string,
+  options: HtmlRenderOptions = {}
+): string {
+  return MarkdownParserModule.renderHtml(text, options);
+}
+
+/**
+ * Timings and counters of the last native parse. Pass `collectStats: true`
+ * to `parseMarkdownWithOptions` for the phase breakdown and tree shape.
+ * @returns Stats of the last parse, including JSON serialization
+ */
+export function getLastParseStats(): ParseStats {
+  return MarkdownParserModule.getLastParseStats();
+}
+
+/**
+ * Native memory held by the shared parser, mostly the tree of the last parse.
+ * @returns Bytes by category and their total
+ */
+export function getMemoryFootprint(): MemoryFootprint {
+  return MarkdownParserModule.getMemoryFootprint();
+}
+
+/**
+ * Set the memory budget of the native parse result cache. Parsing the same
+ * text with the same options again returns the cached result, which makes
+ * remounting finished messages cheap. Top-level blocks that are unchanged
+ * from an earlier parse, e.g. of an edited message, are reused from a memo
+ * with the same budget. Parses with `deferInlines` or `collectStats` use
+ * neither.
+ * @param bytes - Capacity of each in bytes (default 4 MiB); `0` disables both
+ */
+export function setParseCacheCapacity(bytes: number): void {
+  MarkdownParserModule.setCacheCapacity(bytes);
+}
+
+/**
+ * Hit, miss and eviction counters of the native parse result cache.
+ * @returns Counters and current size of the cache
+ */
+export function getParseCacheStats(): ParseCacheStats {
+  return MarkdownParserModule.getCacheStats();
+}
+
+/**
+ * Drop all cached parse results. The counters are kept.
+ */
+export function clearParseCache(): void {
+  MarkdownParserModule.clearCache();
+}
+
+/**
+ * Open a persistent cache of parse results, e.g. in the app's cache
+ * directory. The file is memory-mapped, so a history of finished messages
+ * loads on the next launch without parsing. Results are validated against
+ * the text and the parser version; a stale or damaged file is ignored and
+ * overwritten by the next save.
+ * @param path - Cache file; created by `saveAstCache()` if missing
+ * @param maxBytes - Size limit of the file (default 32 MiB)
+ * @returns Whether the file held a valid cache
+ */
+export function openAstCache(
+  path: string,
+  maxBytes: number = 32 * 1024 * 1024
+): boolean {
+  return MarkdownParserModule.openAstCache(path, maxBytes);
+}
+
+/**
+ * Write the results parsed since `openAstCache()` to the cache file, ahead
+ * of the ones it already held. Call it when the app goes to the background.
+ * @returns Whether the file was written
+ */
+export function saveAstCache(): boolean {
+  return MarkdownParserModule.saveAstCache();
+}
+
+/**
+ * Unmap the cache file and drop results that were not saved.
+ */
+export function closeAstCache(): void {
+  MarkdownParserModule.closeAstCache();
+}
+
+/**
+ * Give back native memory after an OS memory warning. Parsers shrink their
+ * working buffers, which also happens on its own once a large document is
+ * followed by small ones; with `critical` the parse caches are dropped too.
+ *
+ * @example
+ * ```ts
+ * AppState.addEventListener('memoryWarning', () => trimNativeMemory(true));
+ * ```
+ * @param critical - Also drop cached parse results
+ */
+export function trimNativeMemory(critical: boolean = false): void {
+  MarkdownParserModule.trimMemory(critical);
+}
+
 export { MarkdownParser };
 
@@ -12,6 +12,12 @@ export { DefaultMarkdownRenderer } from "./default-markdown-renderer";
  */
 export { Markdown } from "./markdown";
 
+/**
+ * Renders an already parsed document, e.g. from `MarkdownSession.getDocument()`.
+ */
+export { MarkdownTree } from "./markdown";
+export type { MarkdownTreeProps } from "./markdown";
+
 /**
  * Markdown component that supports streaming updates.
  */
@@ -43,5 +49,8 @@ export { MathInline, MathBlock } from "./renderers/math";
 
 // Streaming API
 export { createMarkdownSession } from "./MarkdownSession";
-export type { MarkdownSession } from "./MarkdownSession";
+export type {
+  MarkdownSession,
+  MarkdownSessionSnapshot,
+} from "./MarkdownSession";
 export { useMarkdownSession, useStream } from "./use-markdown-stream";
@@ -1,32 +1,44 @@
 import { useState, useEffect, type FC } from "react";
-import { Markdown, type MarkdownProps } from "./markdown";
+import { MarkdownTree, type MarkdownTreeProps } from "./markdown";
+import type { MarkdownNode } from "./headless";
 import type { MarkdownSession } from "./specs/MarkdownSession.nitro";
 
-export interface MarkdownStreamProps extends Omit<MarkdownProps, "children"> {
+export interface MarkdownStreamProps extends Omit<MarkdownTreeProps, "ast"> {
   /**
-   * The active MarkdownSession to stream content from.
+   * The active MarkdownSession to stream content from. Its tree is parsed
+   * natively with GFM and math enabled.
    */
   session: MarkdownSession;
 }
 
+const readDocument = (session: MarkdownSession): MarkdownNode | null => {
+  try {
+    return JSON.parse(session.getDocument()) as MarkdownNode;
+  } catch (error) {
+    console.error("Failed to parse markdown:", error);
+    return null;
+  }
+};
+
 /**
  * A component that renders streaming Markdown from a MarkdownSession.
- * It efficiently subscribes to session updates to minimize parent re-renders.
+ * It renders the tree the session publishes after each background
+ * reparse, so the text is not parsed again in JS.
  */
 export const MarkdownStream: FC<MarkdownStreamProps> = ({
   session,
   ...props
 }) => {
-  const [text, setText] = useState(() => session.getAllText());
+  const [ast, setAst] = useState(() => readDocument(session));
 
   useEffect(() => {
     // Ensure initial state is synced
-    setText(session.getAllText());
+    setAst(readDocument(session));
 
     return session.addListener(() => {
-      setText(session.getAllText());
+      setAst(readDocument(session));
     });
   }, [session]);
 
-  return <Markdown {...props}>{text}</Markdown>;
+  return <MarkdownTree {...props} ast={ast} />;
 };
@@ -57,9 +57,7 @@ export interface MarkdownProps {
 export const Markdown: FC<MarkdownProps> = ({
   children,
   options,
-  renderers = {},
-  theme: userTheme,
-  style,
+  ...props
 }) => {
   const ast = useMemo(() => {
     try {
@@ -73,6 +71,26 @@ export const Markdown: FC<MarkdownProps> = ({
     }
   }, [children, options]);
 
+  return <MarkdownTree ast={ast} {...props} />;
+};
+
+export interface MarkdownTreeProps
+  extends Omit<MarkdownProps, "children" | "options"> {
+  /**
+   * The parsed document, or null to show a parse error.
+   */
+  ast: MarkdownNode | null;
+}
+
+/**
+ * Renders an already parsed document, e.g. the tree of a MarkdownSession.
+ */
+export const MarkdownTree: FC<MarkdownTreeProps> = ({
+  ast,
+  renderers = {},
+  theme: userTheme,
+  style,
+}) => {
   const theme = useMemo(
     () => ({ ...defaultMarkdownTheme, ...userTheme }),
     [userTheme]
@@ -1,16 +1,72 @@
 import type { HybridObject } from "react-native-nitro-modules";
 
+/**
+ * A streaming document. Sessions live in one native host shared by every
+ * JS runtime, which reparses a session in the background as text is
+ * appended while it has listeners: only the blocks around the end of the
+ * text are parsed again, and the parsers and memory budget for trees are
+ * shared across sessions.
+ */
 export interface MarkdownSession
-  extends HybridObject<{ ios: "swift"; android: "kotlin" }> {
+  extends HybridObject<{ ios: "c++"; android: "c++" }> {
   // Buffer operations
   append(chunk: string): void;
   clear(): void;
+  /** All of the text, decompressing history moved out by `compact()`. */
   getAllText(): string;
+  /**
+   * JSON of the tree of all text appended so far, the same shape `parse()`
+   * returns. Returns the tree the background reparse published if it is
+   * current, and otherwise parses on the calling thread. After `compact()`
+   * it covers only the text that is still hot, and its children follow the
+   * `getColdBlockCount()` cold blocks. Throws once a reparse of the session
+   * failed, as `append()` does, until `clear()`.
+   */
+  getDocument(): string;
 
   // Karaoke highlighting (native rendering)
   // Nitro generates getter/setter for properties automatically
   highlightPosition: number;
 
-  // Listener for view updates
+  /**
+   * Called after `clear()` and whenever the background reparse has
+   * published a new tree, which `getDocument()` then returns at once.
+   * Returns a function that removes the listener.
+   */
   addListener(listener: () => void): () => void;
+
+  /**
+   * The session's state now, e.g. before an answer that may be regenerated.
+   * Takes constant time: the text and tree are shared, not copied.
+   */
+  snapshot(): MarkdownSessionSnapshot;
+  /**
+   * A new session with this one's text and tree that appends independently.
+   * Listeners and `highlightPosition` are not copied.
+   */
+  fork(): MarkdownSession;
+
+  /**
+   * For sessions that run for hours: compresses the text of finished blocks
+   * that end before the last `hotBytes` of text (64 KiB by default) and
+   * drops their trees. Returns the bytes of text compacted.
+   */
+  compact(hotBytes?: number): number;
+  /** Number of blocks moved out by `compact()`. */
+  getColdBlockCount(): number;
+  /**
+   * JSON array of the trees of cold blocks `[begin, end)`, parsed again from
+   * their compressed text, e.g. when they are scrolled back into view.
+   */
+  getColdBlocks(begin: number, end: number): string;
+}
+
+/** An immutable state of a `MarkdownSession`, from `snapshot()`. */
+export interface MarkdownSessionSnapshot
+  extends HybridObject<{ ios: "c++"; android: "c++" }> {
+  /** Length of the text in UTF-8 bytes. */
+  readonly length: number;
+  getAllText(): string;
+  /** A new session that goes on from this state. */
+  fork(): MarkdownSession;
 }